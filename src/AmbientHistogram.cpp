@@ -0,0 +1,172 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "AmbientHistogram.h"
+
+#define DAY_MS (24UL * 60 * 60 * 1000)
+#define SAMPLE_MS (AMBIENT_SAMPLE_MINUTES * 60UL * 1000)
+
+namespace
+{
+  // Position of the highest bit set in x, x > 0.
+  uint8_t highestBit(uint16_t x)
+  {
+    uint8_t bit = 0;
+    while (x >>= 1)
+      bit++;
+    return bit;
+  }
+
+  // snprintf() that appends at `length`, and keeps counting past the end of
+  // the buffer.
+  void append(char *out, size_t size, size_t &length, const char *format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(length < size ? out + length : nullptr,
+                      length < size ? size - length : 0, format, args);
+    va_end(args);
+    if (n > 0)
+      length += n;
+  }
+} // namespace
+
+AmbientHistogram::AmbientHistogram()
+{
+  memset(_counts, 0, sizeof(_counts));
+}
+
+uint8_t AmbientHistogram::binOf(uint16_t value)
+{
+  // value + 1 is 1 to 4096: the octave is its highest bit, the quarter the
+  // two bits below it.
+  uint16_t x = value + 1;
+  uint8_t octave = highestBit(x);
+  uint8_t quarter = octave >= 2 ? (x >> (octave - 2)) & 3 : (x << (2 - octave)) & 3;
+  uint8_t bin = octave * 4 + quarter;
+  return bin < BINS ? bin : BINS - 1;
+}
+
+uint16_t AmbientHistogram::binStart(uint8_t bin)
+{
+  uint8_t octave = bin / 4;
+  uint8_t quarter = bin % 4;
+  return (((4 + quarter) << octave) >> 2) - 1;
+}
+
+void AmbientHistogram::rollOver(unsigned long nowMs)
+{
+  while (nowMs - _dayStartMs >= DAY_MS)
+  {
+    _dayStartMs += DAY_MS;
+    _today = (_today + 1) % AMBIENT_DAYS;
+    memset(_counts[_today], 0, sizeof(_counts[_today]));
+  }
+}
+
+bool AmbientHistogram::record(unsigned long nowMs, uint16_t value)
+{
+  if (!_started)
+  {
+    _started = true;
+    _dayStartMs = nowMs;
+  }
+  else if (nowMs - _lastSampleMs < SAMPLE_MS)
+  {
+    return false;
+  }
+  _lastSampleMs = nowMs;
+
+  rollOver(nowMs);
+  uint16_t &count = _counts[_today][binOf(value)];
+  if (count < UINT16_MAX)
+    count++;
+  return true;
+}
+
+uint16_t AmbientHistogram::count(uint8_t daysAgo, uint8_t bin) const
+{
+  if (daysAgo >= AMBIENT_DAYS || bin >= BINS)
+    return 0;
+  return _counts[(_today + AMBIENT_DAYS - daysAgo) % AMBIENT_DAYS][bin];
+}
+
+uint32_t AmbientHistogram::samples() const
+{
+  uint32_t total = 0;
+  for (uint8_t day = 0; day < AMBIENT_DAYS; day++)
+    for (uint8_t bin = 0; bin < BINS; bin++)
+      total += _counts[day][bin];
+  return total;
+}
+
+AmbientCalibration AmbientHistogram::calibrate() const
+{
+  AmbientCalibration calibration = {0, 4095, 0, false};
+
+  uint32_t merged[BINS];
+  uint32_t total = 0;
+  for (uint8_t bin = 0; bin < BINS; bin++)
+  {
+    merged[bin] = 0;
+    for (uint8_t day = 0; day < AMBIENT_DAYS; day++)
+      merged[bin] += _counts[day][bin];
+    total += merged[bin];
+  }
+  if (total < AMBIENT_MIN_SAMPLES)
+    return calibration;
+
+  // Bins where the cumulative count reaches 5%, 50% and 95% of the samples.
+  uint32_t cumulative = 0;
+  uint8_t lowBin = BINS, medianBin = BINS, highBin = BINS;
+  for (uint8_t bin = 0; bin < BINS; bin++)
+  {
+    cumulative += merged[bin];
+    if (lowBin == BINS && cumulative * 20 >= total)
+      lowBin = bin;
+    if (medianBin == BINS && cumulative * 2 >= total)
+      medianBin = bin;
+    if (highBin == BINS && cumulative * 20 >= total * 19)
+      highBin = bin;
+  }
+
+  // the lowest bins all start at 0
+  uint16_t highEnd = highBin + 1 < BINS ? binStart(highBin + 1) : 4096;
+  calibration.low = binStart(lowBin);
+  calibration.high = highEnd > calibration.low + 1 ? highEnd - 1 : calibration.low + 1;
+  uint16_t medianEnd = medianBin + 1 < BINS ? binStart(medianBin + 1) : 4096;
+  calibration.hysteresis = (medianEnd - binStart(medianBin)) / 2;
+  if (calibration.hysteresis < 2)
+    calibration.hysteresis = 2;
+  calibration.valid = true;
+  return calibration;
+}
+
+size_t AmbientHistogram::toJson(char *out, size_t size) const
+{
+  size_t length = 0;
+  if (size > 0)
+    out[0] = '\0';
+
+  append(out, size, length, "{\"sampleMinutes\":%d,\"binStart\":[", AMBIENT_SAMPLE_MINUTES);
+  for (uint8_t bin = 0; bin < BINS; bin++)
+    append(out, size, length, bin == 0 ? "%u" : ",%u", binStart(bin));
+
+  // Most recent period first.
+  append(out, size, length, "],\"days\":[");
+  for (uint8_t day = 0; day < AMBIENT_DAYS; day++)
+  {
+    append(out, size, length, day == 0 ? "[" : ",[");
+    for (uint8_t bin = 0; bin < BINS; bin++)
+      append(out, size, length, bin == 0 ? "%u" : ",%u", count(day, bin));
+    append(out, size, length, "]");
+  }
+
+  AmbientCalibration calibration = calibrate();
+  append(out, size, length,
+         "],\"calibration\":{\"valid\":%s,\"low\":%u,\"high\":%u,\"hysteresis\":%u}}",
+         calibration.valid ? "true" : "false", calibration.low, calibration.high,
+         calibration.hysteresis);
+  return length;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Minutes between two samples of the histogram.
+#define AMBIENT_SAMPLE_MINUTES 1
+// Number of 24 hour periods kept, the current one included.
+#define AMBIENT_DAYS 7
+// Samples needed before calibrate() trusts the histogram (6 hours).
+#define AMBIENT_MIN_SAMPLES (6 * 60 / AMBIENT_SAMPLE_MINUTES)
+
+// Mapping of the light sensor derived from the histogram.
+struct AmbientCalibration
+{
+  // Filtered ADC values taken as darkest and brightest.
+  uint16_t low;
+  uint16_t high;
+  // Change of the ADC value [counts] to ignore.
+  uint16_t hysteresis;
+  // Whether there were enough samples; if not, the fields are the defaults.
+  bool valid;
+};
+
+/*
+ * Histogram of the ambient light over the last AMBIENT_DAYS days of uptime.
+ *
+ * Takes one filtered light sensor value every AMBIENT_SAMPLE_MINUTES, and
+ * counts it in one of BINS bins spaced a quarter octave apart: a bin covers
+ * about 19% of the values above it, which matches how we perceive light.
+ * Each 24 hour period has its own row of counts, the oldest row is reused for
+ * the next period, so the memory used is fixed.
+ *
+ * The class does not depend on Arduino, and time is passed in. To try the
+ * calibration on the host, compile AmbientHistogram.cpp and replay readings
+ * recorded with AMBIENT_LOG_SAMPLES (see BrightnessController.cpp):
+ *
+ *   AmbientHistogram histogram;
+ *   while (scanf("ambient %lu %hu\n", &ms, &value) == 2)
+ *     histogram.record(ms, value);
+ *   AmbientCalibration calibration = histogram.calibrate();
+ */
+class AmbientHistogram
+{
+public:
+  // 12 octaves of ADC values, 4 bins each. ADC values below 3 are too
+  // coarse for quarter octaves, so some of the lowest bins stay empty.
+  static const uint8_t BINS = 48;
+
+  AmbientHistogram();
+
+  // Offers the filtered ADC value (0 to 4095) at uptime `nowMs`. Only one
+  // value per AMBIENT_SAMPLE_MINUTES is counted. Returns true if it was.
+  bool record(unsigned long nowMs, uint16_t value);
+
+  // Bin of an ADC value, and the lowest ADC value in a bin.
+  static uint8_t binOf(uint16_t value);
+  static uint16_t binStart(uint8_t bin);
+
+  // Count of bin `bin`, `daysAgo` periods before the current one.
+  uint16_t count(uint8_t daysAgo, uint8_t bin) const;
+  // Samples over all days kept.
+  uint32_t samples() const;
+
+  // Derives the mapping of the sensor from the distribution: the 5th and the
+  // 95th percentile become the darkest and the brightest values, and the
+  // hysteresis is half the width of the bin of the median.
+  AmbientCalibration calibrate() const;
+
+  // Writes the histogram and the calibration as JSON, snprintf() style:
+  // returns the length it needs, and writes at most `size` - 1 characters.
+  size_t toJson(char *out, size_t size) const;
+
+private:
+  // Starts a new 24 hour period if the current one is over.
+  void rollOver(unsigned long nowMs);
+
+  uint16_t _counts[AMBIENT_DAYS][BINS];
+  // Row of the current period.
+  uint8_t _today = 0;
+  unsigned long _dayStartMs = 0;
+  unsigned long _lastSampleMs = 0;
+  bool _started = false;
+};
@@ -0,0 +1,155 @@
+#include <Arduino.h>
+
+#include "AnimationTimeline.h"
+
+AnimationTimeline::AnimationTimeline(uint16_t slotCount)
+    : _slotCount(slotCount), _activeCount(0), _slots(new Slot[slotCount])
+{
+  for (int i = 0; i < _slotCount; i++)
+  {
+    _slots[i].active = false;
+    _slots[i].started = false;
+    _slots[i].hasNext = false;
+  }
+}
+
+AnimationTimeline::~AnimationTimeline()
+{
+  delete[] _slots;
+}
+
+void AnimationTimeline::activate_(Slot &slot)
+{
+  if (!slot.active)
+  {
+    slot.active = true;
+    _activeCount++;
+  }
+}
+
+void AnimationTimeline::deactivate_(Slot &slot)
+{
+  if (slot.active)
+  {
+    slot.active = false;
+    _activeCount--;
+  }
+  slot.hasNext = false;
+  slot.current.update = nullptr;
+  slot.next.update = nullptr;
+}
+
+void AnimationTimeline::start(uint16_t index, uint32_t durationUs,
+                              TimelineCallback update, uint32_t delayUs)
+{
+  startAt(index, micros() + delayUs, durationUs, update);
+}
+
+void AnimationTimeline::startAt(uint16_t index, uint32_t startUs,
+                                uint32_t durationUs, TimelineCallback update)
+{
+  Slot &slot = _slots[index];
+  slot.current.startUs = startUs;
+  slot.current.durationUs = durationUs;
+  slot.current.update = update;
+  slot.started = false;
+  slot.hasNext = false;
+  slot.next.update = nullptr;
+  activate_(slot);
+}
+
+void AnimationTimeline::chain(uint16_t index, uint32_t durationUs,
+                              TimelineCallback update, uint32_t delayUs)
+{
+  Slot &slot = _slots[index];
+  if (!slot.active)
+  {
+    start(index, durationUs, update, delayUs);
+    return;
+  }
+  slot.next.durationUs = durationUs;
+  slot.next.update = update;
+  slot.nextDelayUs = delayUs;
+  slot.hasNext = true;
+}
+
+void AnimationTimeline::stop(uint16_t index)
+{
+  deactivate_(_slots[index]);
+}
+
+void AnimationTimeline::stopAll()
+{
+  for (int i = 0; i < _slotCount; i++)
+    deactivate_(_slots[i]);
+}
+
+bool AnimationTimeline::isActive(uint16_t index) const
+{
+  return _slots[index].active;
+}
+
+void AnimationTimeline::update()
+{
+  update(micros());
+}
+
+void AnimationTimeline::update(uint32_t nowUs)
+{
+  if (_activeCount == 0)
+    return;
+
+  for (uint16_t index = 0; index < _slotCount; index++)
+  {
+    Slot &slot = _slots[index];
+    if (!slot.active)
+      continue;
+
+    // Loops only to move on to a chained animation that should already be
+    // running as well.
+    while (true)
+    {
+      Animation &animation = slot.current;
+      int32_t elapsed = static_cast<int32_t>(nowUs - animation.startUs);
+      if (elapsed < 0)
+        break; // still delayed
+
+      TimelineParam param;
+      param.index = index;
+      if (static_cast<uint32_t>(elapsed) < animation.durationUs)
+      {
+        param.progress = static_cast<float>(elapsed) / animation.durationUs;
+        param.state = slot.started ? TimelineState::Progress : TimelineState::Started;
+        slot.started = true;
+        animation.update(param);
+        break;
+      }
+
+      // The animation is over. Run the callback for the start if it was
+      // never called (e.g. zero duration), then for the end.
+      if (!slot.started)
+      {
+        param.progress = 0.0f;
+        param.state = TimelineState::Started;
+        animation.update(param);
+      }
+      param.progress = 1.0f;
+      param.state = TimelineState::Completed;
+      animation.update(param);
+
+      if (!slot.hasNext)
+      {
+        deactivate_(slot);
+        break;
+      }
+
+      // The follow-up starts relative to the planned end, not to now.
+      uint32_t endUs = animation.startUs + animation.durationUs;
+      slot.current = slot.next;
+      slot.current.startUs = endUs + slot.nextDelayUs;
+      slot.next.update = nullptr;
+      slot.hasNext = false;
+      slot.started = false;
+    }
+  }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+#include <stdint.h>
+
+// Where an animation is in its lifetime when its callback runs.
+enum class TimelineState
+{
+  Started,
+  Progress,
+  Completed
+};
+
+struct TimelineParam
+{
+  // 0.0 at the start of the animation, 1.0 at the end.
+  float progress;
+  // Slot of the animation (the pixel index for the display).
+  uint16_t index;
+  TimelineState state;
+};
+
+typedef std::function<void(const TimelineParam &)> TimelineCallback;
+
+//
+// Runs one animation per slot against a microsecond clock (micros()).
+//
+// Every animation has an absolute start time, and its progress is computed
+// from that start time at each update. A late update therefore only skips
+// intermediate steps, it never stretches the animation. Animations can be
+// delayed, and a follow-up animation can be chained to a slot; it starts
+// exactly when the current one ends (plus its own delay), whenever the
+// update that notices the end happens to run.
+//
+// Time values are 32-bit microseconds and wrap after ~71 minutes, so single
+// delays and durations must stay below ~35 minutes.
+//
+class AnimationTimeline
+{
+public:
+  explicit AnimationTimeline(uint16_t slotCount);
+  ~AnimationTimeline();
+
+  AnimationTimeline(const AnimationTimeline &) = delete;
+  AnimationTimeline &operator=(const AnimationTimeline &) = delete;
+
+  // Starts an animation in `index` after `delayUs`, replacing whatever the
+  // slot was doing (a chained follow-up is dropped as well).
+  void start(uint16_t index, uint32_t durationUs, TimelineCallback update,
+             uint32_t delayUs = 0);
+
+  // Same as start(), with an absolute start time in micros() units.
+  void startAt(uint16_t index, uint32_t startUs, uint32_t durationUs,
+               TimelineCallback update);
+
+  // Queues an animation to start `delayUs` after the current animation of
+  // the slot ends. Starts it right away (after the delay) if the slot is idle.
+  // Replaces a previously chained animation.
+  void chain(uint16_t index, uint32_t durationUs, TimelineCallback update,
+             uint32_t delayUs = 0);
+
+  void stop(uint16_t index);
+  void stopAll();
+
+  // True if the slot has a running, delayed or chained animation.
+  bool isActive(uint16_t index) const;
+  // True if any slot is active.
+  bool isAnimating() const { return _activeCount > 0; }
+
+  // Runs the callbacks of all active animations for the time `nowUs`.
+  void update(uint32_t nowUs);
+  void update();
+
+  uint16_t slotCount() const { return _slotCount; }
+
+private:
+  struct Animation
+  {
+    uint32_t startUs;
+    uint32_t durationUs;
+    TimelineCallback update;
+  };
+
+  struct Slot
+  {
+    Animation current;
+    // Follow-up, with its delay relative to the end of `current`.
+    Animation next;
+    uint32_t nextDelayUs;
+    bool active;
+    bool started;
+    bool hasNext;
+  };
+
+  void activate_(Slot &slot);
+  void deactivate_(Slot &slot);
+
+  uint16_t _slotCount;
+  uint16_t _activeCount;
+  Slot *_slots;
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <AsyncUDP.h>
+#include <esp_timer.h>
+#include <lwip/dns.h>
+#include <lwip/tcpip.h>
+
+#include <atomic>
+
+#include "SntpTransport.h"
+
+//
+// SntpTransport on AsyncUDP, with a connection per server. The answers are
+// handed back from the AsyncUDP task as soon as they arrive.
+//
+// Names are looked up for every request, so a pool name can give another
+// server each time, but send() never waits for the DNS server. lwIP's DNS is
+// only safe on the tcpip thread, so send() posts the lookup there and returns
+// false, with resolving() true until the name is found (from the cache, right
+// away) or not. SntpClient then sends the request again from the main loop,
+// and it goes to the address just found.
+//
+class AsyncUdpTransport : public SntpTransport
+{
+public:
+  bool send(uint8_t server, const char *host, uint16_t port,
+            const uint8_t *data, size_t length, int64_t &sentUs) override
+  {
+    if (server >= SNTP_MAX_SERVERS)
+      return false;
+    Lookup &lookup = _lookups[server];
+    uint8_t state = lookup.state.load(std::memory_order_acquire);
+    if (state == LOOKUP_RUNNING)
+      return false;
+    if (state == LOOKUP_IDLE || host != lookup.host)
+    {
+      lookup.host = host;
+      lookup.state.store(LOOKUP_RUNNING, std::memory_order_release);
+      if (tcpip_callback(startLookup, &lookup) != ERR_OK)
+        lookup.state.store(LOOKUP_IDLE, std::memory_order_relaxed);
+      return false;
+    }
+
+    // the next request looks the name up again
+    lookup.state.store(LOOKUP_IDLE, std::memory_order_relaxed);
+    uint32_t address = lookup.address.load(std::memory_order_relaxed);
+    if (address == 0)
+      return false;
+
+    AsyncUDP &udp = _udp[server];
+    udp.close();
+    if (!udp.connect(IPAddress(address), port))
+      return false;
+    udp.onPacket([this, server](AsyncUDPPacket &packet) {
+      deliver(server, packet.data(), packet.length(), esp_timer_get_time());
+    });
+    sentUs = esp_timer_get_time();
+    return udp.write(data, length) == length;
+  }
+
+  bool resolving(uint8_t server) const override
+  {
+    return server < SNTP_MAX_SERVERS &&
+           _lookups[server].state.load(std::memory_order_acquire) == LOOKUP_RUNNING;
+  }
+
+private:
+  enum LookupState : uint8_t
+  {
+    LOOKUP_IDLE,
+    LOOKUP_RUNNING,
+    LOOKUP_DONE,
+  };
+
+  // The lookup of the name of one server. The main loop owns it unless it
+  // is LOOKUP_RUNNING, the tcpip thread sets the address and makes it
+  // LOOKUP_DONE.
+  struct Lookup
+  {
+    const char *host = nullptr;
+    std::atomic<uint8_t> state{LOOKUP_IDLE};
+    // IPv4 address in network order, 0 if the name was not found.
+    std::atomic<uint32_t> address{0};
+  };
+
+  // Runs on the tcpip thread.
+  static void startLookup(void *arg)
+  {
+    Lookup *lookup = static_cast<Lookup *>(arg);
+    ip_addr_t found;
+    err_t err = dns_gethostbyname(lookup->host, &found, lookedUp, lookup);
+    if (err == ERR_OK)
+      lookedUp(lookup->host, &found, lookup);
+    else if (err != ERR_INPROGRESS)
+      lookedUp(lookup->host, nullptr, lookup);
+  }
+
+  // Runs on the tcpip thread, `found` is null if the name was not found.
+  static void lookedUp(const char *, const ip_addr_t *found, void *arg)
+  {
+    Lookup *lookup = static_cast<Lookup *>(arg);
+    lookup->address.store(found != nullptr && IP_IS_V4(found) ? ip_2_ip4(found)->addr : 0,
+                          std::memory_order_relaxed);
+    lookup->state.store(LOOKUP_DONE, std::memory_order_release);
+  }
+
+  AsyncUDP _udp[SNTP_MAX_SERVERS];
+  Lookup _lookups[SNTP_MAX_SERVERS];
+};
@@ -2,6 +2,10 @@
 
 #define MIN_DIM 100
 
+// Define to print every histogram sample as "ambient <uptime ms> <value>", to
+// record the light of a room and replay it on the host (see AmbientHistogram).
+// #define AMBIENT_LOG_SAMPLES
+
 BrightnessController::BrightnessController() {}
 
 void BrightnessController::setup()
@@ -12,24 +16,50 @@ void BrightnessController::setup()
 
 void BrightnessController::loop()
 {
-  lightSensor_.loop();
+  const uint16_t sensorValue = lightSensor_.value();
+  if (ambient_.record(millis(), sensorValue))
+  {
+#ifdef AMBIENT_LOG_SAMPLES
+    Serial.printf("ambient %lu %u\n", millis(), sensorValue);
+#endif
+    calibration_ = ambient_.calibrate();
+  }
 
-  if (lightSensor_.sensitivity == 0)
+  if (lightSensor_.sensitivity() == 0)
   {
-    RgbColor gamma_corrected = gammaAdjust(original_);
-    changed_ = corrected_ != gamma_corrected;
+    dim_ = 255;
+    RgbColor gamma_corrected = correct(original_);
+    changed_ = changed_ || corrected_ != gamma_corrected;
     corrected_ = gamma_corrected;
+    dirty_ = false;
     return;
   }
 
-  float dim = (255 - MIN_DIM) * lightSensor_.reading() + MIN_DIM;
-  RgbColor newColor = gammaAdjust(original_.Dim(static_cast<int>(dim)));
+  // within the noise of the room's light, keep the value the level is from
+  if (!calibration_.valid ||
+      abs(static_cast<int>(sensorValue) - lastValue_) >= calibration_.hysteresis)
+  {
+    lastValue_ = sensorValue;
+  }
+  uint16_t value = lastValue_;
+  if (calibration_.valid)
+  {
+    // stretch the light levels seen in the room over the whole curve
+    value = constrain(value, calibration_.low, calibration_.high);
+    value = static_cast<uint32_t>(value - calibration_.low) * 4095 /
+            (calibration_.high - calibration_.low);
+  }
+
+  dim_ = MIN_DIM + ((255 - MIN_DIM) * lightSensor_.response(value) + 127) / 255;
+  RgbColor newColor = correct(original_);
 
-  if (abs(corrected_.CalculateBrightness() - newColor.CalculateBrightness()) < 5.)
+  if (!dirty_ &&
+      abs(static_cast<int>(corrected_.CalculateBrightness()) - newColor.CalculateBrightness()) < 5)
   {
     return; // don't adjust for small changes.
   }
 
+  dirty_ = false;
+  changed_ = changed_ || corrected_ != newColor;
   corrected_ = newColor;
-  changed_ = true;
 }
@@ -3,6 +3,7 @@
 #include <NeoPixelAnimator.h>
 #include <NeoPixelBus.h>
 
+#include "AmbientHistogram.h"
 #include "LDRReader.h"
 
 /* An 8-bit gamma-correction table from the Adafruit NeoPixel lib.
@@ -38,6 +39,11 @@ static const uint8_t PROGMEM gammaTable_[256] = {
 // Create this object and then call setup() to initialize it and then invoke
 // loop() as often as possible.
 //
+// The light sensor values are kept in a histogram over the last days. Once it
+// has enough samples, the darkest and brightest light seen in the room map to
+// the full dim range, and changes smaller than the noise around the usual
+// light level are ignored.
+//
 class BrightnessController
 {
 public:
@@ -46,16 +52,42 @@ public:
   void setup();
   void loop();
 
-  void setSensorSensitivity(int value) { lightSensor_.sensitivity = value; };
+  // The next loop() applies the level of the new sensitivity, however small
+  // the change.
+  void setSensorSensitivity(int value)
+  {
+    lightSensor_.setSensitivity(value);
+    dirty_ = true;
+  };
+  // Current [mA] through the LEDs of the frame being shown, to take their
+  // light out of the sensor readings.
+  void setLedCurrent(uint32_t milliamps) { lightSensor_.setLedCurrent(milliamps < UINT16_MAX ? milliamps : UINT16_MAX); }
+  // Whether the corrected color changed since the last call.
   bool hasChanged()
   {
     bool res = changed_;
     changed_ = false;
     return res;
   };
-  void setOriginalColor(RgbColor color) { original_ = color; }
+  // Takes the current dim level at once, so that a transition right after
+  // goes to the new color. hasChanged() reports it like a change of
+  // brightness, for the clock mode to show it.
+  void setOriginalColor(RgbColor color)
+  {
+    original_ = color;
+    RgbColor corrected = correct(original_);
+    changed_ = changed_ || corrected != corrected_;
+    corrected_ = corrected;
+  }
   RgbColor getCorrectedColor() { return corrected_; };
 
+  const AmbientHistogram &ambientHistogram() const { return ambient_; }
+  const AmbientCalibration &calibration() const { return calibration_; }
+
+  // Dims and gamma corrects any color with the level of the last loop() call.
+  // Lets animations with many colors share one sensor sample per frame.
+  RgbColor correct(RgbColor color) const { return gammaAdjust(color.Dim(dim_)); }
+
   /*!
     @brief   A gamma-correction function for RgbColor. Makes color
              transitions appear more perceptially correct.
@@ -86,9 +118,20 @@ private:
   // Original color dimmed according to the current sensor reading.
   RgbColor corrected_;
 
-  // Dirty flag.
-  bool changed_;
+  // Dim level derived from the last sensor reading (255 == not dimmed).
+  uint8_t dim_ = 255;
+
+  // Whether the corrected color changed since the last hasChanged().
+  bool changed_ = false;
+  // Whether the next loop() must apply its level, even a small change.
+  bool dirty_ = false;
 
   // The light sensor.
   LDRReader lightSensor_;
+
+  // Ambient light over the last days, and the mapping derived from it.
+  AmbientHistogram ambient_;
+  AmbientCalibration calibration_ = {0, 4095, 0, false};
+  // Sensor value the dim level was last derived from.
+  uint16_t lastValue_ = 0;
 };
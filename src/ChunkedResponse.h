@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+// Bytes collected before a chunk is sent.
+#define CHUNKED_RESPONSE_BUFFER 512
+
+//
+// Writes an HTTP response of unknown length in chunks (chunked transfer
+// encoding), as it is rendered.
+//
+// The text is collected in a buffer on the stack of the handler, and sent
+// whenever it is full: however long the page, it takes no more memory than
+// the buffer. Text in flash is copied straight from there.
+//
+//   ChunkedResponse response(server);
+//   response.begin(200, "text/html");
+//   response.write("<p>");
+//   response.writeEscaped(value);
+//   response.end();
+//
+class ChunkedResponse
+{
+public:
+  explicit ChunkedResponse(WebServer &server) : _server(server) {}
+
+  ~ChunkedResponse() { end(); }
+
+  // Sends the status and the headers.
+  void begin(int code, const char *type)
+  {
+    _server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server.send(code, type, "");
+    _open = true;
+  }
+
+  void write(const char *text) { write(text, strlen(text)); }
+
+  void write(const char *text, size_t length)
+  {
+    while (length > 0)
+    {
+      size_t n = min(length, sizeof(_buffer) - _length);
+      memcpy(_buffer + _length, text, n);
+      _length += n;
+      text += n;
+      length -= n;
+      if (_length == sizeof(_buffer))
+        flush();
+    }
+  }
+
+  void write(int value)
+  {
+    char text[12];
+    write(text, snprintf(text, sizeof(text), "%d", value));
+  }
+
+  // Writes text to go in an HTML attribute (quoted with ' or ") or element.
+  void writeEscaped(const char *text)
+  {
+    if (text == nullptr)
+      return;
+    for (const char *p = text;; p++)
+    {
+      const char *entity = nullptr;
+      switch (*p)
+      {
+      case '&': entity = "&amp;"; break;
+      case '<': entity = "&lt;"; break;
+      case '>': entity = "&gt;"; break;
+      case '"': entity = "&quot;"; break;
+      case '\'': entity = "&#39;"; break;
+      }
+      if (entity == nullptr && *p != '\0')
+        continue;
+      write(text, p - text);
+      if (*p == '\0')
+        return;
+      write(entity);
+      text = p + 1;
+    }
+  }
+
+  // Sends what is in the buffer.
+  void flush()
+  {
+    if (_length > 0)
+      _server.sendContent(_buffer, _length);
+    _length = 0;
+  }
+
+  // Sends the rest, and the empty chunk that ends the response.
+  void end()
+  {
+    if (!_open)
+      return;
+    flush();
+    _server.sendContent("", 0);
+    _open = false;
+  }
+
+private:
+  WebServer &_server;
+  char _buffer[CHUNKED_RESPONSE_BUFFER];
+  size_t _length = 0;
+  bool _open = false;
+};
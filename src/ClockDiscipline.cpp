@@ -0,0 +1,142 @@
+#include <math.h>
+
+#include "ClockDiscipline.h"
+
+#define US_PER_S 1000000.0
+
+void ClockDiscipline::addSample(int64_t nowUs, int64_t utcUs)
+{
+  const bool synced = isSynced();
+  const int64_t before = synced ? utc(nowUs) : 0;
+
+  _samples[_next] = {nowUs, utcUs - nowUs};
+  _next = (_next + 1) % DISCIPLINE_SAMPLES;
+  if (_count < DISCIPLINE_SAMPLES)
+    _count++;
+  _fit();
+
+  // slew from where utc() was to the new estimate
+  double correction = nowUs + _model(nowUs) - before;
+  if (!synced || fabs(correction) > DISCIPLINE_STEP_US)
+  {
+    if (synced)
+    {
+      // the reference jumped (or this clock did): the history is no use
+      _samples[0] = {nowUs, utcUs - nowUs};
+      _count = 1;
+      _next = 1 % DISCIPLINE_SAMPLES;
+      _fit();
+    }
+    correction = 0;
+  }
+  _slewStartUs = nowUs;
+  _slewUs = correction;
+}
+
+void ClockDiscipline::_fit()
+{
+  double meanNow = 0;
+  double meanOffset = 0;
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    meanNow += _samples[i].nowUs - _samples[0].nowUs;
+    meanOffset += _samples[i].offsetUs - _samples[0].offsetUs;
+  }
+  meanNow /= _count;
+  meanOffset /= _count;
+  _meanUs = _samples[0].nowUs + static_cast<int64_t>(meanNow);
+  _intercept = _samples[0].offsetUs + meanOffset;
+
+  // in seconds and microseconds, to keep the sums small
+  double sxx = 0, sxy = 0;
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    double x = (_samples[i].nowUs - _meanUs) / US_PER_S;
+    double y = _samples[i].offsetUs - _intercept;
+    sxx += x * x;
+    sxy += x * y;
+  }
+  _sxx = sxx;
+  _slopePpm = sxx > 0 ? sxy / sxx : 0;
+
+  // the spread around the line needs a third sample, and is never taken to
+  // be better than a sync can be
+  _sigmaUs = DISCIPLINE_NOISE_US;
+  if (_count > 2)
+  {
+    double sse = 0;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+      double x = (_samples[i].nowUs - _meanUs) / US_PER_S;
+      double residual = _samples[i].offsetUs - _intercept - _slopePpm * x;
+      sse += residual * residual;
+    }
+    double sigma = sqrt(sse / (_count - 2));
+    if (sigma > _sigmaUs)
+      _sigmaUs = sigma;
+  }
+}
+
+double ClockDiscipline::_model(int64_t nowUs) const
+{
+  return _intercept + _slopePpm * ((nowUs - _meanUs) / US_PER_S);
+}
+
+double ClockDiscipline::_slewLeft(int64_t nowUs) const
+{
+  double slewed = DISCIPLINE_MAX_SLEW_PPM * ((nowUs - _slewStartUs) / US_PER_S);
+  if (slewed >= fabs(_slewUs))
+    return 0;
+  return _slewUs > 0 ? _slewUs - slewed : _slewUs + slewed;
+}
+
+int64_t ClockDiscipline::utc(int64_t nowUs) const
+{
+  return nowUs + static_cast<int64_t>(llround(_model(nowUs) - _slewLeft(nowUs)));
+}
+
+int64_t ClockDiscipline::uncertaintyUs(int64_t nowUs) const
+{
+  if (!isSynced())
+    return INT64_MAX;
+  return static_cast<int64_t>(_modelError(nowUs) + fabs(_slewLeft(nowUs)));
+}
+
+double ClockDiscipline::_modelError(int64_t nowUs) const
+{
+  double age = (nowUs - lastSample()) / US_PER_S;
+  double error;
+  if (_count < 2 || _sxx <= 0)
+  {
+    // one sync: nothing is known about the frequency yet
+    error = _sigmaUs + DISCIPLINE_CRYSTAL_PPM * age;
+  }
+  else
+  {
+    // prediction error of the line, growing away from the samples
+    double x = (nowUs - _meanUs) / US_PER_S;
+    error = _sigmaUs * sqrt(1.0 / _count + x * x / _sxx);
+  }
+  return error;
+}
+
+uint32_t ClockDiscipline::holdoverSeconds(int64_t budgetUs, uint32_t maxSeconds) const
+{
+  if (!isSynced())
+    return 0;
+
+  // after the last sync the error of the estimate only grows: bisect
+  const int64_t last = lastSample();
+  uint32_t low = 0, high = maxSeconds;
+  if (_modelError(last + static_cast<int64_t>(high) * 1000000) <= budgetUs)
+    return high;
+  while (high - low > 1)
+  {
+    uint32_t middle = low + (high - low) / 2;
+    if (_modelError(last + static_cast<int64_t>(middle) * 1000000) <= budgetUs)
+      low = middle;
+    else
+      high = middle;
+  }
+  return low;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+
+// Number of syncs the frequency is estimated from.
+#define DISCIPLINE_SAMPLES 8
+// Error [us] of a single sync, e.g. half the round trip to an NTP server.
+#define DISCIPLINE_NOISE_US 5000
+// Frequency error [ppm] assumed until it is measured: the crystal tolerance.
+#define DISCIPLINE_CRYSTAL_PPM 50
+// Fastest rate [ppm] a correction is slewed at, like adjtime().
+#define DISCIPLINE_MAX_SLEW_PPM 500
+// Corrections larger than this [us] are stepped, and start a new history.
+#define DISCIPLINE_STEP_US 1000000
+
+//
+// Keeps UTC on the monotonic clock (esp_timer_get_time()) between syncs.
+//
+// Every sync records the offset between the monotonic clock and UTC. A least
+// squares line through the last DISCIPLINE_SAMPLES offsets gives the
+// frequency error of the crystal and the offset at any time, and the spread
+// of the offsets around the line how far the estimate can be trusted.
+//
+// When a sync moves the estimate, the correction is slewed at most
+// DISCIPLINE_MAX_SLEW_PPM rather than stepped, so utc() never jumps and
+// never runs backwards; only corrections over DISCIPLINE_STEP_US are stepped.
+//
+// The class does not depend on Arduino. Times are passed in, in
+// microseconds.
+//
+class ClockDiscipline
+{
+public:
+  // Records that UTC was `utcUs` at monotonic time `nowUs`.
+  void addSample(int64_t nowUs, int64_t utcUs);
+
+  // Whether there was a sync at all.
+  bool isSynced() const { return _count > 0; }
+  uint8_t sampleCount() const { return _count; }
+  // Monotonic time [us] of the last sync.
+  int64_t lastSample() const { return _samples[(_next + DISCIPLINE_SAMPLES - 1) % DISCIPLINE_SAMPLES].nowUs; }
+
+  // UTC [us since the epoch] at monotonic time `nowUs`.
+  int64_t utc(int64_t nowUs) const;
+
+  // Estimated frequency error of the monotonic clock [ppm], positive if it
+  // runs slow.
+  float driftPpm() const { return _slopePpm; }
+
+  // Estimated error [us] of utc(nowUs).
+  int64_t uncertaintyUs(int64_t nowUs) const;
+
+  // Time [s] from the last sync until the uncertainty of the estimate reaches
+  // `budgetUs`, up to `maxSeconds`. Tells how long the next sync can wait.
+  uint32_t holdoverSeconds(int64_t budgetUs, uint32_t maxSeconds) const;
+
+private:
+  // Offset of UTC from the monotonic clock [us] at `nowUs`, by the fit.
+  double _model(int64_t nowUs) const;
+  // Error [us] of the fit at `nowUs`.
+  double _modelError(int64_t nowUs) const;
+  // Correction [us] still to be slewed at `nowUs`.
+  double _slewLeft(int64_t nowUs) const;
+  void _fit();
+
+  struct Sample
+  {
+    int64_t nowUs;
+    int64_t offsetUs;
+  };
+  Sample _samples[DISCIPLINE_SAMPLES];
+  uint8_t _count = 0;
+  uint8_t _next = 0;
+
+  // The fit: offset = _intercept + _slopePpm * (now - _meanUs) / 1e6, with
+  // _sxx the sum of squares of (now - _meanUs) [s^2] and _sigmaUs the error
+  // of one offset.
+  int64_t _meanUs = 0;
+  double _intercept = 0;
+  float _slopePpm = 0;
+  double _sxx = 0;
+  double _sigmaUs = DISCIPLINE_NOISE_US;
+
+  // Correction being slewed: `_slewUs` at `_slewStartUs`.
+  int64_t _slewStartUs = 0;
+  double _slewUs = 0;
+};
@@ -4,35 +4,65 @@
 
 #include "ClockFace.h"
 
-// static
-int ClockFace::pixelCount()
+template <typename TGrid>
+ClockFaceT<TGrid>::ClockFaceT(LightSensorPosition position) : _hour(-1), _minute(-1), _second(-1),
+                                                              _position(position), _state(TGrid::PixelCount),
+                                                              _previousState(TGrid::PixelCount),
+                                                              _segmentCount(0), _previousSegmentCount(0)
 {
-  return NEOPIXEL_COUNT;
-}
-
-ClockFace::ClockFace(LightSensorPosition position) : _hour(-1), _minute(-1), _second(-1),
-                                                     _position(position), _state(NEOPIXEL_COUNT){};
+  memset(_segments, 0, sizeof(_segments));
+  memset(_previousSegments, 0, sizeof(_previousSegments));
+  updatePixelPositions();
+};
 
-void ClockFace::setLightSensorPosition(LightSensorPosition position)
+template <typename TGrid>
+void ClockFaceT<TGrid>::setLightSensorPosition(LightSensorPosition position)
 {
   _position = position;
+  updatePixelPositions();
 }
 
-uint16_t ClockFace::map(int16_t x, int16_t y)
+template <typename TGrid>
+void ClockFaceT<TGrid>::updatePixelPositions()
+{
+  for (int x = 0; x < TGrid::Width; x++)
+  {
+    for (int y = 0; y < TGrid::Height; y++)
+    {
+      uint16_t pixel = map(x, y);
+      _pixelX[pixel] = x;
+      _pixelY[pixel] = y;
+    }
+  }
+
+  const int right = TGrid::Width - 1;
+  const int bottom = TGrid::Height - 1;
+  _pixelX[mapMinute(TopLeft)] = 0;
+  _pixelY[mapMinute(TopLeft)] = 0;
+  _pixelX[mapMinute(TopRight)] = right;
+  _pixelY[mapMinute(TopRight)] = 0;
+  _pixelX[mapMinute(BottomLeft)] = 0;
+  _pixelY[mapMinute(BottomLeft)] = bottom;
+  _pixelX[mapMinute(BottomRight)] = right;
+  _pixelY[mapMinute(BottomRight)] = bottom;
+}
+
+template <typename TGrid>
+uint16_t ClockFaceT<TGrid>::map(int16_t x, int16_t y)
 {
   switch (_position)
   {
   case LightSensorPosition::Top:
   {
     static NeoTopology<ColumnMajorAlternating90Layout> sensor_on_top(
-        NEOPIXEL_ROWS, NEOPIXEL_COLUMNS);
-    return sensor_on_top.Map(x, y) + NEOPIXEL_SIGNALS;
+        TGrid::Width, TGrid::Height);
+    return sensor_on_top.Map(x, y) + TGrid::Signals;
   }
   case LightSensorPosition::Bottom:
   {
     static NeoTopology<ColumnMajorAlternating270Layout> sensor_on_bottom(
-        NEOPIXEL_ROWS, NEOPIXEL_COLUMNS);
-    return sensor_on_bottom.Map(x, y) + NEOPIXEL_SIGNALS;
+        TGrid::Width, TGrid::Height);
+    return sensor_on_bottom.Map(x, y) + TGrid::Signals;
   }
   default:
     DCHECK(false, static_cast<int>(_position));
@@ -40,7 +70,8 @@ uint16_t ClockFace::map(int16_t x, int16_t y)
   return 0;
 }
 
-uint16_t ClockFace::mapMinute(Corners corner)
+template <typename TGrid>
+uint16_t ClockFaceT<TGrid>::mapMinute(Corners corner)
 {
   switch (_position)
   {
@@ -54,18 +85,38 @@ uint16_t ClockFace::mapMinute(Corners corner)
   return 0;
 }
 
+template <typename TGrid>
+void ClockFaceT<TGrid>::clearState()
+{
+  _previousState = _state;
+  memcpy(_previousSegments, _segments, sizeof(_segments));
+  _previousSegmentCount = _segmentCount;
+
+  for (int i = 0; i < TGrid::PixelCount; i++)
+    _state[i] = false;
+  memset(_segments, 0, sizeof(_segments));
+  _segmentCount = 0;
+}
+
 // Lit a segment in updateState.
-void ClockFace::updateSegment(int x, int y, int length)
+template <typename TGrid>
+void ClockFaceT<TGrid>::updateSegment(int x, int y, int length)
 {
+  _segmentCount++;
   for (int i = x; i <= x + length - 1; i++)
-    _state[map(i, y)] = true;
+  {
+    uint16_t pixel = map(i, y);
+    _state[pixel] = true;
+    _segments[pixel] = _segmentCount;
+  }
 }
 
 // Find a sequence of letters on the board [PUBLIC]
 // return value: whether or not a solution was found
 // input: word (string) to be found
 // output: the sequence of bits on the board corresponding to the input string (int[]), to be allocated by caller
-bool ClockFace::determineLetterSequence(String str, uint16_t *stateElems, int *nElems)
+template <typename TGrid>
+bool ClockFaceT<TGrid>::determineLetterSequence(String str, uint16_t *stateElems, int *nElems)
 {
   coord bestSolution[PUZZLE_MAX_SEQUENCE];
   coord runningSolution[PUZZLE_MAX_SEQUENCE];
@@ -75,8 +126,8 @@ bool ClockFace::determineLetterSequence(String str, uint16_t *stateElems, int *n
   int runningNumElems = 0;
 
   // print the board letters for debugging
-  // for (int x=0; x<NEOPIXEL_COLUMNS; x++) {
-  //   for (int y=0; y<NEOPIXEL_ROWS; y++) {
+  // for (int x=0; x<TGrid::Height; x++) {
+  //   for (int y=0; y<TGrid::Width; y++) {
   //     Serial.printf("%c ", _letters[x][y]);
   //   }
   //   Serial.printf("\n");
@@ -84,8 +135,7 @@ bool ClockFace::determineLetterSequence(String str, uint16_t *stateElems, int *n
   
   // Reset the state to all off/black. 
   // We do this to make sure that -if Display:: calls _update...() the last know state is empty and no clock time is shown
-  for (int i = 0; i < NEOPIXEL_COUNT; i++)
-    _state[i] = false;
+  clearState();
 
   findLetterSequence(str, &bestCost, bestSolution, &bestNumElems, runningCost, runningSolution, runningNumElems);
   Serial.printf("ClockFace::determineLetterSequence(%s) score:%d\n", str, bestCost);
@@ -109,7 +159,8 @@ bool ClockFace::determineLetterSequence(String str, uint16_t *stateElems, int *n
 }
 
 // Check if the given (x,y) coordinate is in the list of given coordinates
-bool ClockFace::coordInList(int x, int y, coord *coordList, int nElems)
+template <typename TGrid>
+bool ClockFaceT<TGrid>::coordInList(int x, int y, coord *coordList, int nElems)
 {
   for (int i=0; i<nElems; i++) {
     if (x == coordList[i].x && y == coordList[i].y) return true;
@@ -120,7 +171,8 @@ bool ClockFace::coordInList(int x, int y, coord *coordList, int nElems)
 // Given a sequence of letters, find a solution with the shortest path between them.
 // NOTE: This is a recursive function
 // return value: sequence of coordinates that make up the given sequence
-void ClockFace::findLetterSequence(String str, int *bestCost, coord *bestSolution, int *bestNumElems, int runningCost, coord *runningSolution, int runningNumElems)
+template <typename TGrid>
+void ClockFaceT<TGrid>::findLetterSequence(String str, int *bestCost, coord *bestSolution, int *bestNumElems, int runningCost, coord *runningSolution, int runningNumElems)
 {
   if (str == "") { // end of search (no more letters to search for in the word)
     // update best* params if current solution is better
@@ -154,8 +206,8 @@ void ClockFace::findLetterSequence(String str, int *bestCost, coord *bestSolutio
   str.remove(0, 1); // remove the first character from string so we can pass on the rest recursively
 
   // go over the board and find all instances of our search character (if not used previously)
-  for (int x=0; x<NEOPIXEL_COLUMNS; x++) {
-    for (int y=0; y<NEOPIXEL_ROWS; y++) {
+  for (int x=0; x<TGrid::Height; x++) {
+    for (int y=0; y<TGrid::Width; y++) {
       if (_letters[x][y] == c && !coordInList(x, y, runningSolution, runningNumElems)) {
         if (runningNumElems > 0) {
           // determine the distance between this letter and the previous (if any)
@@ -174,6 +226,10 @@ void ClockFace::findLetterSequence(String str, int *bestCost, coord *bestSolutio
   }
 }
 
+// The grid of the faces below. A face of another size instantiates
+// ClockFaceT for its grid next to it.
+template class ClockFaceT<WordClockGrid>;
+
 //
 // Constants to match the ClockFace.
 //
@@ -236,16 +292,16 @@ FrenchClockFace::FrenchClockFace(LightSensorPosition position) : ClockFace(posit
 {
   // fill the array of letters. This is used for finding words in puzzle-mode
   int i=0;
-  strncpy(_letters[i++], "ILBESTJDEUX", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "QUATRETROIS", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "NEUFUNESEPT", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "HUITSIXCINQ", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "MIDIXMINUIT", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "ONZEWHEURES", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "MOINSYLEDIX", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "ETTROISDEMI", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "VINGT-CINQK", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "QUARTSPILE!", NEOPIXEL_ROWS);
+  strncpy(_letters[i++], "ILBESTJDEUX", WordClockGrid::Width);
+  strncpy(_letters[i++], "QUATRETROIS", WordClockGrid::Width);
+  strncpy(_letters[i++], "NEUFUNESEPT", WordClockGrid::Width);
+  strncpy(_letters[i++], "HUITSIXCINQ", WordClockGrid::Width);
+  strncpy(_letters[i++], "MIDIXMINUIT", WordClockGrid::Width);
+  strncpy(_letters[i++], "ONZEWHEURES", WordClockGrid::Width);
+  strncpy(_letters[i++], "MOINSYLEDIX", WordClockGrid::Width);
+  strncpy(_letters[i++], "ETTROISDEMI", WordClockGrid::Width);
+  strncpy(_letters[i++], "VINGT-CINQK", WordClockGrid::Width);
+  strncpy(_letters[i++], "QUARTSPILE!", WordClockGrid::Width);
 }
 
 bool FrenchClockFace::stateForTime(int hour, int minute, int second, bool show_ampm)
@@ -259,10 +315,8 @@ bool FrenchClockFace::stateForTime(int hour, int minute, int second, bool show_a
 
   DLOGLN("update state");
 
-  // TODO move to a more convenient place
   // Reset the board to all black
-  for (int i = 0; i < NEOPIXEL_COUNT; i++)
-    _state[i] = false;
+  clearState();
 
   int leftover = minute % 5;
   minute = minute - leftover;
@@ -465,16 +519,16 @@ EnglishClockFace::EnglishClockFace(LightSensorPosition position) : ClockFace(pos
 {
   // fill the array of letters. This is used for finding words in puzzle-mode
   int i=0;
-  strncpy(_letters[i++], "ITLISASAMPM", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "ACQUARTERDC", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "TWENTYFIVEX", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "HALFSTENJTO", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "PASTEBUNINE", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "ONESIXTHREE", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "FOURFIVETWO", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "EIGHTELEVEN", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "SEVENTWELVE", NEOPIXEL_ROWS);
-  strncpy(_letters[i++], "TENSZOCLOCK", NEOPIXEL_ROWS);
+  strncpy(_letters[i++], "ITLISASAMPM", WordClockGrid::Width);
+  strncpy(_letters[i++], "ACQUARTERDC", WordClockGrid::Width);
+  strncpy(_letters[i++], "TWENTYFIVEX", WordClockGrid::Width);
+  strncpy(_letters[i++], "HALFSTENJTO", WordClockGrid::Width);
+  strncpy(_letters[i++], "PASTEBUNINE", WordClockGrid::Width);
+  strncpy(_letters[i++], "ONESIXTHREE", WordClockGrid::Width);
+  strncpy(_letters[i++], "FOURFIVETWO", WordClockGrid::Width);
+  strncpy(_letters[i++], "EIGHTELEVEN", WordClockGrid::Width);
+  strncpy(_letters[i++], "SEVENTWELVE", WordClockGrid::Width);
+  strncpy(_letters[i++], "TENSZOCLOCK", WordClockGrid::Width);
 }
 
 bool EnglishClockFace::stateForTime(int hour, int minute, int second, bool show_ampm)
@@ -486,14 +540,13 @@ bool EnglishClockFace::stateForTime(int hour, int minute, int second, bool show_
   _hour = hour;
   _minute = minute;
   _show_ampm = show_ampm;
-  Serial.printf("EnglishClockFace::stateForTime() time:%02d:%02d:%02d\n",
-                hour, minute, second);
+  DLOGF("EnglishClockFace::stateForTime() time:%02d:%02d:%02d\n",
+        hour, minute, second);
 
   DLOGLN("update state");
 
   // Reset the board to all black
-  for (int i = 0; i < NEOPIXEL_COUNT; i++)
-    _state[i] = false;
+  clearState();
 
   int leftover = minute % 5;
   minute = minute - leftover;
@@ -2,23 +2,19 @@
 
 #include <vector>
 
-// The number of LEDs connected before the start of the matrix.
-#define NEOPIXEL_SIGNALS 4
-
-// Matrix dimensions.
-#define NEOPIXEL_ROWS 11
-#define NEOPIXEL_COLUMNS 10
-
-// Number of LEDs on the whole strip.
-#define NEOPIXEL_COUNT (NEOPIXEL_ROWS * NEOPIXEL_COLUMNS + NEOPIXEL_SIGNALS)
+#include "GridSize.h"
 
 // max length of word to be found in the board
 #define PUZZLE_MAX_SEQUENCE 20
 
-class ClockFace
+// A clock face for a letter matrix of TGrid (see GridSize.h).
+template <typename TGrid>
+class ClockFaceT
 {
 public:
-  static int pixelCount();
+  typedef TGrid Grid;
+
+  static int pixelCount() { return TGrid::PixelCount; }
 
   // The orientation of the clock is infered from where the light sensor is.
   enum class LightSensorPosition
@@ -27,7 +23,7 @@ public:
     Top
   };
 
-  ClockFace(LightSensorPosition position);
+  ClockFaceT(LightSensorPosition position);
 
   // Rotates the display.
   void setLightSensorPosition(LightSensorPosition position);
@@ -37,17 +33,45 @@ public:
   // in which case the state is not updated.
   virtual bool stateForTime(int hour, int minute, int second, bool show_ampm) = 0;
 
+  // Forgets the time of the last update, so that the next stateForTime()
+  // updates the state whatever the time.
+  void resetTime() { _hour = _minute = _second = -1; }
+
   // Returns the state of all LEDs as pixels. Updated when updateStateForTime()
   // is called.
   const std::vector<bool> &getState() { return _state; };
 
+  // The state before the last update, to know which pixels turn on or off.
+  const std::vector<bool> &getPreviousState() { return _previousState; };
+
+  // Words lit in the current (or previous) state are numbered from 1 in the
+  // order the face lights them. Returns the word of a pixel, 0 if the pixel is
+  // not part of a word (e.g. off, or a minute corner).
+  uint8_t segmentOf(uint16_t pixel) const { return _segments[pixel]; }
+  uint8_t previousSegmentOf(uint16_t pixel) const { return _previousSegments[pixel]; }
+  uint8_t segmentCount() const { return _segmentCount; }
+  uint8_t previousSegmentCount() const { return _previousSegmentCount; }
+
+  // Grid position of a pixel, (0, 0) being the top left letter. The minute
+  // corners report the position of the letter in their corner.
+  uint8_t pixelX(uint16_t pixel) const { return _pixelX[pixel]; }
+  uint8_t pixelY(uint16_t pixel) const { return _pixelY[pixel]; }
+  // Returns the pixel of the letter at a grid position.
+  uint16_t pixelAt(int16_t x, int16_t y) { return map(x, y); }
+
   // public puzzle mode word finder function
   bool determineLetterSequence(String str, uint16_t *stateElems, int *nElems);
 
 protected:
+  // Turns all LEDs off, keeping the current state as the previous one.
+  void clearState();
+
   // Lights up a segment in the state.
   void updateSegment(int x, int y, int length);
 
+  // Fills _pixelX and _pixelY for the current orientation.
+  void updatePixelPositions();
+
   // Returns the index of the LED in the strip given a position on the grid.
   uint16_t map(int16_t x, int16_t y);
 
@@ -73,6 +97,17 @@ protected:
 
   // Stores the bits of the clock that need to be turned on.
   std::vector<bool> _state;
+  std::vector<bool> _previousState;
+
+  // Word number of every pixel, see segmentOf().
+  uint8_t _segments[TGrid::PixelCount];
+  uint8_t _previousSegments[TGrid::PixelCount];
+  uint8_t _segmentCount;
+  uint8_t _previousSegmentCount;
+
+  // Grid position of every pixel, see pixelX().
+  uint8_t _pixelX[TGrid::PixelCount];
+  uint8_t _pixelY[TGrid::PixelCount];
 
   //////////////////////////////////////////////////////////////////////////////////
   // Declarations & defines for puzzle-mode where a sequence of letters is shown 
@@ -84,7 +119,7 @@ protected:
   };
 
   // 2D array of the letter-elements of the clock (top left == 0,0)
-  char _letters[NEOPIXEL_COLUMNS][NEOPIXEL_ROWS];
+  char _letters[TGrid::Height][TGrid::Width];
 
   // recursive function to find best match for a word on the board
   void findLetterSequence(String str, int *bestCost, coord *bestSolution, int *bestNumElems, int runningCost, coord *runningSolution, int runningNumElems);
@@ -93,6 +128,9 @@ protected:
   bool coordInList(int x, int y, coord *coordList, int nElems);
 };
 
+// The faces below are all 11x10.
+typedef ClockFaceT<WordClockGrid> ClockFace;
+
 class FrenchClockFace : public ClockFace
 {
 public:
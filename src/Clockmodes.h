@@ -1,28 +1,25 @@
 #pragma once
 
-#include <Arduino.h>
+#include "ColorTestMode.h"
+#include "ModeRegistry.h"
+#include "PuzzleMode.h"
+#include "RealTimeMode.h"
+#include "StressMode.h"
 
-const char clockmode0[] PROGMEM = "ClockMode/Real Clock";
-const char clockmode1[] PROGMEM = "ClockMode/Color Test";
-const char clockmode2[] PROGMEM = "ClockMode/Word Puzzle";
-
-const char modeval0[] PROGMEM = "0";
-const char modeval1[] PROGMEM = "1";
-const char modeval2[] PROGMEM = "2";
-
-const char *const clockmode[] PROGMEM = {clockmode0, clockmode1, clockmode2};
-const char *const modeval[] PROGMEM = {modeval0, modeval1, modeval2};
-const char clockModeOptions[] PROGMEM = "data-options='ClockMode/Real Clock|ClockMode/Color Test|ClockMode/Word Puzzle'";
-
-// Clock display mode.
-enum class ClockMode {
+// Clock display modes, numbered in this order (the clock mode setting of the
+// web page stores the number). To add a mode, write its type (see
+// ModeRegistry) and list it here.
+template <typename TGrid>
+using ClockModes = ModeRegistry<
     // Show current time.
-    REAL_TIME,
+    RealTimeMode,
     // Color test animation mode
-    COLOR_TEST,
+    ColorTestMode<TGrid>,
     // Word finder puzzle mode
-    PUZZLE_MODE,
-
-    // Largest numeric value of a clock mode.
-    MAX_VALUE = PUZZLE_MODE,
-};
\ No newline at end of file
+    PuzzleMode<TGrid>,
+    // Synthetic times at the stress rate, to benchmark the rendering (see
+    // StressMode)
+    StressMode<FastTimeStress>,
+    StressMode<RandomStress>,
+    StressMode<CycleHoursStress>,
+    StressMode<Cycle5MinsStress>>;
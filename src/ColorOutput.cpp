@@ -0,0 +1,24 @@
+#include "ColorOutput.h"
+
+uint8_t ColorOutput<RgbwColor>::toWhite_[3][256];
+uint8_t ColorOutput<RgbwColor>::fromWhite_[3][256];
+
+void ColorOutput<RgbwColor>::setup()
+{
+  static bool initialized = false;
+  if (initialized)
+    return;
+
+  const uint8_t whitePoint[3] = {RGBW_WHITE_POINT};
+  for (int channel = 0; channel < 3; channel++)
+  {
+    const uint16_t point = whitePoint[channel] > 0 ? whitePoint[channel] : 1;
+    for (int level = 0; level < 256; level++)
+    {
+      uint16_t white = level * 255 / point;
+      toWhite_[channel][level] = white > 255 ? 255 : white;
+      fromWhite_[channel][level] = level * whitePoint[channel] / 255;
+    }
+  }
+  initialized = true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <NeoPixelBus.h>
+
+// RGB equivalent of the white LED of RGBW strips, at full power. The default
+// matches a warm white (~3000K) die, as found on SK6812 WWA strips.
+#ifndef RGBW_WHITE_POINT
+#define RGBW_WHITE_POINT 255, 197, 143
+#endif
+
+//
+// Converts the RGB frames the display renders into the color object of the
+// LED strip's feature, and tells how much each converted pixel loads the
+// supply (sum of the channel levels, see PowerBudget).
+//
+template <typename TColorObject>
+struct ColorOutput;
+
+template <>
+struct ColorOutput<RgbColor>
+{
+  static void setup() {}
+  static RgbColor fromRgb(const RgbColor &color) { return color; }
+  static uint16_t load(const RgbColor &color) { return color.R + color.G + color.B; }
+};
+
+//
+// RGBW strips: the part of a color the white LED can produce is moved to the
+// white channel. A single white die uses about a third of the current of the
+// three color dies for the same light.
+//
+// The white LED is not neutral, so the largest white level whose light fits
+// in the color is taken (per channel: level * 255 / white point, then the
+// minimum), and the white light is subtracted from the color channels. Both
+// steps are table lookups.
+//
+template <>
+struct ColorOutput<RgbwColor>
+{
+  // Builds the lookup tables from RGBW_WHITE_POINT.
+  static void setup();
+
+  static RgbwColor fromRgb(const RgbColor &color)
+  {
+    uint8_t white = toWhite_[0][color.R];
+    if (toWhite_[1][color.G] < white)
+      white = toWhite_[1][color.G];
+    if (toWhite_[2][color.B] < white)
+      white = toWhite_[2][color.B];
+
+    return RgbwColor(color.R - fromWhite_[0][white],
+                     color.G - fromWhite_[1][white],
+                     color.B - fromWhite_[2][white],
+                     white);
+  }
+
+  static uint16_t load(const RgbwColor &color)
+  {
+    return color.R + color.G + color.B + color.W;
+  }
+
+private:
+  // Highest white level that fits in a channel level, per channel.
+  static uint8_t toWhite_[3][256];
+  // Channel level produced by a white level, per channel.
+  static uint8_t fromWhite_[3][256];
+};
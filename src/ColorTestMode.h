@@ -0,0 +1,138 @@
+#pragma once
+
+#include <NeoPixelBus.h>
+
+#include "AnimationTimeline.h"
+#include "FastRandom.h"
+#include "Sequence.h"
+
+//
+// Color test: pixels light up in colors around the hue circle, one every
+// POPULATION_THRESHOLD ms (a Sequence), and fade out. The corners are kept
+// animated all the time. Drawn on the effect layer.
+//
+template <typename TGrid>
+class ColorTestMode
+{
+public:
+  static constexpr char label[] = "ClockMode/Color Test";
+
+  template <typename TDisplay>
+  void enter(TDisplay &display)
+  {
+    // fade the clock to black underneath the effect
+    display.transition(400, true);
+    _buildHueWheel(COLOR_TEST_LUMINANCE);
+    _random.setSeed(display.colorTestSeed() != 0 ? display.colorTestSeed() : esp_random());
+    _hue = 0;
+    Serial.printf("ColorTestMode::enter() seed=%u\n", _random.seed());
+    _sequence.restart(micros());
+  }
+
+  // One frame of the color test. The frame is committed once, by the display.
+  template <typename TDisplay>
+  void tick(TDisplay &display)
+  {
+    // a single light sensor sample for all pixels started in this frame
+    display.brightnessController().loop();
+
+    // a new pixel every POPULATION_THRESHOLD, on the dot
+    SEQ_BEGIN(_sequence, micros());
+    for (;;) {
+      _pixelStart(display);
+      SEQ_SLEEP_MS(_sequence, POPULATION_THRESHOLD);
+    }
+    SEQ_END(_sequence);
+  }
+
+  template <typename TDisplay>
+  void exit(TDisplay &display)
+  {
+    display.animations(TDisplay::Compositor::EFFECT).stopAll();
+    display.layer(TDisplay::Compositor::EFFECT).clear();
+  }
+
+private:
+  static const uint8_t POPULATION_THRESHOLD = 60; // delay [ms] between new pixel animations
+  static const uint16_t COLOR_TEST_FADE_MIN = 1700; // shortest fade [ms] of a pixel
+  static const uint16_t COLOR_TEST_FADE_MAX = 2100; // longest fade [ms] of a pixel
+  static constexpr float COLOR_TEST_LUMINANCE = 0.4f; // 0.0 = black, 0.25 is normal, 0.5 is bright
+
+  // fill the hue wheel with fully saturated colors of the given luminance
+  // Param: float luminance (0..1)
+  //        0.0 = black, 0.25 is normal, 0.5 is bright
+  void _buildHueWheel(float luminance)
+  {
+    if (luminance == _hueWheelLuminance) {
+      return;
+    }
+    for (int hue = 0; hue < 256; hue++) {
+      _hueWheel[hue] = RgbColor(HslColor(hue / 256.0f, 1.0f, luminance));
+    }
+    _hueWheelLuminance = luminance;
+  }
+
+  // pick a new pixel and start its animation
+  template <typename TDisplay>
+  void _pixelStart(TDisplay &display)
+  {
+    // The corner pixels should always be animated (to support matching the
+    //  faceplate corner holes over the corner LEDs)
+    AnimationTimeline &animations = display.animations(TDisplay::Compositor::EFFECT);
+    for (int i = 0; i < TGrid::Signals; i++) {
+      if (!animations.isActive(i)) {
+        _animatePixel(display, i);
+      }
+    }
+
+    // pick a random pixel from the rest of the pixels
+    uint16_t pixel = _random.below(TGrid::PixelCount - TGrid::Signals) + TGrid::Signals;
+
+    if (!animations.isActive(pixel)) {
+      _animatePixel(display, pixel);
+    }
+  }
+
+  // pick random time and next Hue color to animate the given pixel
+  template <typename TDisplay>
+  void _animatePixel(TDisplay &display, uint16_t pixel)
+  {
+    // Take the next color from the hue wheel and dim it according to the
+    // light sensor value sampled at the start of this frame.
+    typename TDisplay::Layer &effect = display.layer(TDisplay::Compositor::EFFECT);
+    effect.setPixel(pixel, display.brightnessController().correct(_hueWheel[_hue++]));
+
+    // fade to black
+    uint32_t time = _random.between(COLOR_TEST_FADE_MIN, COLOR_TEST_FADE_MAX); // time in ms
+    _startColor[pixel] = effect.getPixel(pixel);
+
+    TDisplay *target = &display;
+    TimelineCallback blendAnimUpdate = [this, target](const TimelineParam &param) {
+      // this gets called for each animation on every time step
+      // progress will start at 0.0 and end at 1.0
+      // we use the blend function on the RgbColor to mix
+      // color based on the progress given to us in the animation
+      RgbColor updatedColor = RgbColor::LinearBlend(
+          _startColor[param.index], RgbColor(0), param.progress);
+
+      // apply the color to the pixel
+      target->layer(TDisplay::Compositor::EFFECT).setPixel(param.index, updatedColor);
+    };
+
+    display.animations(TDisplay::Compositor::EFFECT).startAt(pixel, _sequence.deadline(), time * 1000UL, blendAnimUpdate);
+  }
+
+  Sequence _sequence;
+  uint8_t _hue = 0;
+
+  // Fully saturated colors around the hue circle, at _hueWheelLuminance.
+  // Saves a HslColor to RgbColor conversion for every animated pixel.
+  RgbColor _hueWheel[256];
+  float _hueWheelLuminance = -1.0f;
+
+  // Picks pixels and durations. Seeded on every start of the color test.
+  FastRandom _random;
+
+  // Color every pixel fades out from.
+  RgbColor _startColor[TGrid::PixelCount];
+};
@@ -0,0 +1,158 @@
+#include "Compositor.h"
+
+namespace
+{
+  // Scales an 8-bit channel by an 8-bit factor (255 == 1.0).
+  inline uint8_t scale8(uint8_t value, uint8_t factor)
+  {
+    return (static_cast<uint16_t>(value) * (factor + 1)) >> 8;
+  }
+
+  // Moves `from` towards `to` by `alpha` (255 == all the way).
+  inline uint8_t lerp8(uint8_t from, uint8_t to, uint8_t alpha)
+  {
+    return from + ((static_cast<int16_t>(to) - from) * (alpha + 1) >> 8);
+  }
+
+  inline uint8_t addSaturate8(uint8_t a, uint8_t b)
+  {
+    uint16_t sum = static_cast<uint16_t>(a) + b;
+    return sum > 255 ? 255 : sum;
+  }
+
+  inline bool isBlack(const RgbColor &color)
+  {
+    return color.R == 0 && color.G == 0 && color.B == 0;
+  }
+
+  RgbColor blend(const RgbColor &below, const RgbColor &above,
+                 uint8_t alpha, BlendMode mode)
+  {
+    switch (mode)
+    {
+    case BlendMode::Add:
+      return RgbColor(addSaturate8(below.R, scale8(above.R, alpha)),
+                      addSaturate8(below.G, scale8(above.G, alpha)),
+                      addSaturate8(below.B, scale8(above.B, alpha)));
+    case BlendMode::Multiply:
+      return RgbColor(lerp8(below.R, scale8(below.R, above.R), alpha),
+                      lerp8(below.G, scale8(below.G, above.G), alpha),
+                      lerp8(below.B, scale8(below.B, above.B), alpha));
+    case BlendMode::Normal:
+    default:
+      if (isBlack(above))
+        return below;
+      return RgbColor(lerp8(below.R, above.R, alpha),
+                      lerp8(below.G, above.G, alpha),
+                      lerp8(below.B, above.B, alpha));
+    }
+  }
+} // namespace
+
+template <uint16_t TPixelCount>
+LayerT<TPixelCount>::LayerT() {}
+
+template <uint16_t TPixelCount>
+void LayerT<TPixelCount>::setPixel(uint16_t index, const RgbColor &color)
+{
+  RgbColor &pixel = _pixels[index];
+  if (pixel == color)
+    return;
+
+  if (isBlack(pixel))
+    _litCount++;
+  else if (isBlack(color))
+    _litCount--;
+
+  pixel = color;
+  _dirty = true;
+}
+
+template <uint16_t TPixelCount>
+void LayerT<TPixelCount>::clear()
+{
+  if (_litCount == 0)
+    return;
+
+  for (int i = 0; i < TPixelCount; i++)
+    _pixels[i] = RgbColor(0);
+  _litCount = 0;
+  _dirty = true;
+}
+
+template <uint16_t TPixelCount>
+void LayerT<TPixelCount>::setAlpha(uint8_t alpha)
+{
+  if (_alpha != alpha)
+  {
+    _alpha = alpha;
+    _dirty = true;
+  }
+}
+
+template <uint16_t TPixelCount>
+void LayerT<TPixelCount>::setBlendMode(BlendMode mode)
+{
+  if (_mode != mode)
+  {
+    _mode = mode;
+    _dirty = true;
+  }
+}
+
+template <uint16_t TPixelCount>
+CompositorT<TPixelCount>::CompositorT()
+{
+  // The effect layer is drawn on top of the clock by default.
+  _layers[EFFECT].setBlendMode(BlendMode::Add);
+}
+
+template <uint16_t TPixelCount>
+bool CompositorT<TPixelCount>::compose()
+{
+  // Collect the layers that take part in this pass. A clean layer keeps its
+  // previous contribution, so if all of them are clean the output is still
+  // valid.
+  Layer *active[LAYER_COUNT];
+  int activeCount = 0;
+  bool dirty = false;
+
+  for (int i = 0; i < LAYER_COUNT; i++)
+  {
+    Layer &layer = _layers[i];
+    dirty |= layer._dirty;
+    layer._dirty = false;
+
+    // A multiply layer with nothing on it would black out everything below,
+    // so only skip it when it is fully transparent.
+    bool empty = layer._mode == BlendMode::Multiply ? layer._alpha == 0
+                                                    : layer.isEmpty();
+    if (!empty)
+      active[activeCount++] = &layer;
+  }
+
+  if (!dirty)
+    return false;
+
+  _changedCount = 0;
+  for (int index = 0; index < TPixelCount; index++)
+  {
+    RgbColor color(0);
+    for (int i = 0; i < activeCount; i++)
+    {
+      const Layer &layer = *active[i];
+      color = blend(color, layer._pixels[index], layer._alpha, layer._mode);
+    }
+    if (_output[index] != color)
+    {
+      _output[index] = color;
+      _changed[_changedCount++] = index;
+    }
+  }
+  return true;
+}
+
+#define INSTANTIATE_COMPOSITOR(grid)   \
+  template class LayerT<grid::PixelCount>; \
+  template class CompositorT<grid::PixelCount>;
+FOR_EACH_GRID(INSTANTIATE_COMPOSITOR)
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <NeoPixelBus.h>
+
+#include "GridSize.h"
+
+// How the pixels of a layer are combined with the layers below it.
+enum class BlendMode
+{
+  // Lit pixels replace what is below, weighted by the layer alpha. Black
+  // pixels are transparent, so a layer only covers what it draws.
+  Normal,
+  // Pixels are added to what is below (saturating), scaled by the layer alpha.
+  Add,
+  // What is below is multiplied by the pixels, weighted by the layer alpha.
+  Multiply
+};
+
+//
+// A single layer of the display: a small framebuffer with an alpha and a
+// blend mode. Writing pixels marks the layer dirty so the compositor knows it
+// has to redo the blending.
+//
+template <uint16_t TPixelCount>
+class LayerT
+{
+public:
+  LayerT();
+
+  void setPixel(uint16_t index, const RgbColor &color);
+  RgbColor getPixel(uint16_t index) const { return _pixels[index]; }
+
+  // Turns all pixels of the layer off.
+  void clear();
+
+  // Opacity of the layer, 0 (invisible) to 255 (opaque).
+  void setAlpha(uint8_t alpha);
+  uint8_t alpha() const { return _alpha; }
+
+  void setBlendMode(BlendMode mode);
+  BlendMode blendMode() const { return _mode; }
+
+  // True when the layer cannot change the output (nothing drawn or no alpha).
+  bool isEmpty() const { return _alpha == 0 || _litCount == 0; }
+
+private:
+  template <uint16_t>
+  friend class CompositorT;
+
+  RgbColor _pixels[TPixelCount];
+  uint8_t _alpha = 255;
+  BlendMode _mode = BlendMode::Normal;
+
+  // Number of pixels that are not black, to skip layers with nothing on them.
+  uint16_t _litCount = 0;
+
+  // Set on every change, cleared by the compositor after blending.
+  bool _dirty = true;
+};
+
+//
+// Stacks a fixed set of layers on top of each other into one output buffer.
+//
+// Layers are blended bottom to top in a single pass over the pixels. When no
+// layer changed since the previous pass, compose() does nothing, and empty
+// layers are left out of the pass altogether.
+//
+template <uint16_t TPixelCount>
+class CompositorT
+{
+public:
+  typedef LayerT<TPixelCount> Layer;
+
+  // The layers, from bottom to top.
+  enum LayerId
+  {
+    // The clock face (time, puzzle words).
+    BASE,
+    // Animations drawn over (or instead of) the clock face.
+    EFFECT,
+    // Status indications that should stay visible in every mode.
+    OVERLAY,
+
+    LAYER_COUNT
+  };
+
+  CompositorT();
+
+  Layer &layer(LayerId id) { return _layers[id]; }
+
+  // Blends all layers into the output buffer. Returns false, leaving the
+  // output untouched, if no layer changed since the last call.
+  bool compose();
+
+  // Result of the last compose().
+  const RgbColor *output() const { return _output; }
+
+  // Pixels whose output changed in the last compose() that returned true.
+  const uint16_t *changedPixels() const { return _changed; }
+  uint16_t changedCount() const { return _changedCount; }
+
+private:
+  Layer _layers[LAYER_COUNT];
+  RgbColor _output[TPixelCount];
+  uint16_t _changed[TPixelCount];
+  uint16_t _changedCount = 0;
+};
@@ -0,0 +1,86 @@
+#include "ConfigPage.h"
+
+namespace
+{
+  const char PAGE_START[] PROGMEM =
+      "<!DOCTYPE html><html lang=\"en\"><head><meta charset=\"UTF-8\"/>"
+      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1, "
+      "user-scalable=no\"/><title>";
+  const char HEAD_END[] PROGMEM =
+      "</title>\n";
+  const char BODY_START[] PROGMEM =
+      "</head><body>";
+  const char FORM_START[] PROGMEM =
+      "<div style=\"text-align:left;display:inline-block;min-width:260px;\">\n"
+      "<form action=\"\" method=\"post\">"
+      "<input type=\"hidden\" name=\"iotSave\" value=\"true\">"
+      "<fieldset id=\"iwcSys\"><legend>System configuration</legend>\n";
+  const char FORM_END[] PROGMEM =
+      "</fieldset><button type=\"submit\">Apply</button></form>\n"
+      "<div style=\"font-size: .6em;\">Firmware config version '";
+  const char PAGE_END[] PROGMEM =
+      "'</div>\n"
+      "</div></body></html>\n";
+} // namespace
+
+void ConfigPage::begin(const char *thingName)
+{
+  _response.write(PAGE_START);
+  _response.writeEscaped(thingName);
+  _response.write(HEAD_END);
+}
+
+void ConfigPage::beginForm(const char *bodyInner)
+{
+  _response.write(BODY_START);
+  _response.write(bodyInner);
+  _response.write(FORM_START);
+}
+
+void ConfigPage::parameter(IotWebConfParameter *param)
+{
+  if (!param->visible)
+    return;
+  if (param->getId() == nullptr)
+  {
+    // a separator starts the next group
+    _response.write("</fieldset><fieldset><legend>");
+    _response.writeEscaped(param->label);
+    _response.write("</legend>\n");
+    return;
+  }
+
+  _response.write(param->errorMessage != nullptr ? "<div class=\"de\">" : "<div>");
+  _response.write("<label for=\"");
+  _response.write(param->getId());
+  _response.write("\">");
+  _response.writeEscaped(param->label);
+  _response.write("</label><input type=\"");
+  _response.write(param->type);
+  _response.write("\" id=\"");
+  _response.write(param->getId());
+  _response.write("\" name=\"");
+  _response.write(param->getId());
+  _response.write("\" maxlength=\"");
+  _response.write(param->length - 1);
+  _response.write("\" placeholder=\"");
+  _response.writeEscaped(param->placeholder);
+  _response.write("\" value=\"");
+  // passwords are not sent back, an empty one keeps the old
+  if (strcmp(param->type, "password") != 0)
+    _response.writeEscaped(param->valueBuffer);
+  _response.write("\" ");
+  if (param->customHtml != nullptr)
+    _response.write(param->customHtml);
+  _response.write("/><div class=\"em\">");
+  _response.writeEscaped(param->errorMessage);
+  _response.write("</div></div>\n");
+}
+
+void ConfigPage::end(const char *version)
+{
+  _response.write(FORM_END);
+  _response.writeEscaped(version);
+  _response.write(PAGE_END);
+  _response.end();
+}
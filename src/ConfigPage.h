@@ -0,0 +1,41 @@
+#pragma once
+
+#include <IotWebConf.h>
+
+#include "ChunkedResponse.h"
+
+//
+// The configuration page, sent as it is rendered (see ChunkedResponse).
+//
+// The markup is that of IotWebConf's own form: same ids, names, error classes
+// and fieldsets, so its script and its handleConfig() take the posted form as
+// theirs. handleConfig() only saves a form that carries the hidden iotSave
+// field, which beginForm() writes.
+//
+//   ChunkedResponse response(server);
+//   response.begin(200, "text/html");
+//   ConfigPage page(response);
+//   page.begin(thingName);
+//   response.write(headElements);
+//   page.beginForm(bodyInner);
+//   page.parameter(param); // for every parameter
+//   page.end(version);
+//
+class ConfigPage
+{
+public:
+  explicit ConfigPage(ChunkedResponse &response) : _response(response) {}
+
+  // Everything up to the end of the title. The head elements go after it.
+  void begin(const char *thingName);
+  // Ends the head, writes `bodyInner` at the start of the body, and starts
+  // the form with the group of the system parameters.
+  void beginForm(const char *bodyInner);
+  // Writes the row of a parameter, or starts a new group for a separator.
+  void parameter(IotWebConfParameter *param);
+  // Ends the form and the page, with the config version under it.
+  void end(const char *version);
+
+private:
+  ChunkedResponse &_response;
+};
@@ -2,58 +2,124 @@
 
 #include "Display.h"
 
-Display::Display(ClockFace &clockFace, uint8_t pin)
+template <typename TColorFeature, typename TGrid>
+DisplayT<TColorFeature, TGrid>::DisplayT(ClockFaceT<TGrid> &clockFace, OutputBackend<OutputColor> &output)
     : _clockFace(clockFace),
-      _pixels(ClockFace::pixelCount(), pin),
-      _animations(ClockFace::pixelCount(), NEO_CENTISECONDS),
-      _wordPixelsLen(0),
-      _wordPixelsIdx(0) {
-  animationState = new MyAnimationState[ClockFace::pixelCount()];
+      _output(output),
+      _animations{AnimationTimeline(TGrid::PixelCount),
+                  AnimationTimeline(TGrid::PixelCount),
+                  AnimationTimeline(TGrid::PixelCount)} {
+  static_assert(Compositor::LAYER_COUNT == 3, "one timeline per layer");
+  ColorOutput<OutputColor>::setup();
 }
 
-void Display::setup()
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::setup()
 {
-  _pixels.Begin();
+  _output.begin();
   _brightnessController.setup();
 }
 
-void Display::loop()
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::loop()
 {
-  switch(clock_mode_) {
-    case ClockMode::COLOR_TEST:
-      _colorTestLoop();
-      break;
-    case ClockMode::PUZZLE_MODE:
-      _puzzleModeLoop();
-      break;
-    case ClockMode::REAL_TIME:
-    default:
-      _updateClockRealTime();
-      break;
+  _modes.tick(*this);
+  uint32_t nowUs = micros();
+  for (AnimationTimeline &animations : _animations)
+    animations.update(nowUs);
+  _commit();
+}
+
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::_commit()
+{
+  // account for the energy used at the current draw, before it changes
+  _power.accumulate(millis());
+
+  bool composed = _compositor.compose();
+  if (composed) {
+    // only the pixels that changed are converted for the strip and update
+    // the current estimate
+    const RgbColor *output = _compositor.output();
+    const uint16_t *changed = _compositor.changedPixels();
+    for (int i = 0; i < _compositor.changedCount(); i++) {
+      uint16_t index = changed[i];
+      _frame[index] = ColorOutput<OutputColor>::fromRgb(output[index]);
+      _power.setPixelLoad(index, ColorOutput<OutputColor>::load(_frame[index]));
+    }
+  }
+
+  uint8_t scale = _power.scale();
+  bool drawn = false;
+  if (scale != _outputScale) {
+    // the limit kicked in or changed, so every pixel needs the new scale
+    _outputScale = scale;
+    for (int index = 0; index < TGrid::PixelCount; index++)
+      _output.setPixel(index, _frame[index].Dim(scale));
+    drawn = true;
+  } else if (composed && _compositor.changedCount() > 0) {
+    const uint16_t *changed = _compositor.changedPixels();
+    for (int i = 0; i < _compositor.changedCount(); i++)
+      _output.setPixel(changed[i], scale == 255 ? _frame[changed[i]] : _frame[changed[i]].Dim(scale));
+    drawn = true;
+  }
+  if (drawn) {
+    // the frame kept for a busy output is never shown as such
+    if (_commitPending)
+      _droppedFrames++;
+    _commitPending = true;
+  }
+
+  // don't wait for the previous frame to be sent, the next loop() tries again
+  if (_commitPending && _output.beginCommit()) {
+    _commitPending = false;
+    _committedFrames++;
+    // the light sensor compensates for the light of the frame from now on
+    _brightnessController.setLedCurrent(_power.lightMilliamps());
   }
+}
 
-  // for all modes not using one_time initialization, we set one_time back to true
-  if (clock_mode_ != ClockMode::COLOR_TEST && clock_mode_ != ClockMode::PUZZLE_MODE)
-    firstTimeUpdate = true;
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::setPowerLimit(uint16_t milliamps)
+{
+  // the new scale is picked up by the next _commit()
+  _power.setLimit(milliamps);
 }
 
-void Display::setColor(const RgbColor &color)
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::setColor(const RgbColor &color)
 {
   DLOGLN("Updating color");
-  Serial.printf("Display::setColor(%d,%d,%d), current=(%d,%d,%d)\n", color.R, color.G, color.B, _color.R, _color.G, _color.B);
+  DLOGF("Display::setColor(%d,%d,%d), current=(%d,%d,%d)\n", color.R, color.G, color.B, _color.R, _color.G, _color.B);
   if (_color != color) {
     _color = color;
+    // Shown by the clock mode, like a change of brightness: a transition
+    // here would cut short the fade of the time (see RealTimeMode).
     _brightnessController.setOriginalColor(color);
-    _update(60);
   }
 }
 
-void Display::setFindWord(char *value, int len) {
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::setFindWord(char *value, int len) {
   // strncpy(_findWord, value, len);
   _findWord = String(value);
 }
 
-void Display::updateWithTime(int hour, int minute, int second, int animationSpeed)
+template <typename TColorFeature, typename TGrid>
+String DisplayT<TColorFeature, TGrid>::takeFindWord() {
+  String word = _findWord;
+  _findWord = String();
+  return word;
+}
+
+template <typename TColorFeature, typename TGrid>
+bool DisplayT<TColorFeature, TGrid>::updateWithTime(int hour, int minute, int second, int animationSpeed)
+{
+  return updateWithTimeAt(micros(), hour, minute, second, animationSpeed);
+}
+
+template <typename TColorFeature, typename TGrid>
+bool DisplayT<TColorFeature, TGrid>::updateWithTimeAt(uint32_t startUs, int hour, int minute, int second, int animationSpeed)
 {
   //Serial.printf("=>Display::updateWithTime(%d,%d,%d,%d)\n", hour, minute, second, animationSpeed);
 
@@ -66,272 +132,48 @@ void Display::updateWithTime(int hour, int minute, int second, int animationSpee
     DLOG(":");
     DLOGLN(minute);
 
-    _update(animationSpeed);
+    transitionAt(startUs, animationSpeed, false, _transitionStyle);
+    return true;
   }
+  return false;
 }
 
-void Display::_updateClockRealTime() {
-  //struct tm: tm_year, tm_mon, tm_mday, tm_hour, tm_min, tm_sec
-  struct tm timeinfo;
-
-  //Serial.printf("=>Display::_updateClockRealTime()\n");
-
-  // NOTE: the second arg in getLocalTime() is the max [ms] the function waits 
-  //       for the time to be received from the NTP server. Be aware to set it to
-  //       a low value to prevent blocking issues!
-  //       See the following resources:
-  // https://github.com/espressif/arduino-esp32/blob/34125cee1d1c6a81cd1da07de27ce69d851f9389/cores/esp32/esp32-hal-time.c#L87
-  // https://techtutorialsx.com/2021/09/01/esp32-system-time-and-sntp/
-  // https://www.lucadentella.it/en/2017/05/11/esp32-17-sntp/
-  getLocalTime(&timeinfo, 10); 
-  updateWithTime(timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-
-  // now check if the brightness has changed and if so, 
-  // animate the change in brightness
-  _brightnessController.loop();
-  _animations.UpdateAnimations();
-  if (_brightnessController.hasChanged())
-  {
-    // RVG for later: we only need to update according to brightness if 
-    // the previous call to _clockFace.stateForTime() was false (no change in time value)
-    _update(30); // Update in 300 ms
-  }
-  _pixels.Show();
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::transition(int animationSpeed, bool fadeToBlack, TransitionStyle style)
+{
+  transitionAt(micros(), animationSpeed, fadeToBlack, style);
 }
 
-void Display::_update(int animationSpeed, bool fadeToBlack)
+template <typename TColorFeature, typename TGrid>
+void DisplayT<TColorFeature, TGrid>::transitionAt(uint32_t startUs, int animationSpeed, bool fadeToBlack, TransitionStyle style)
 {
-  Serial.printf("=>Display::_update(%d,%d)\n", animationSpeed, fadeToBlack);
+  DLOGF("=>Display::transition(%d,%d,%d)\n", animationSpeed, fadeToBlack, static_cast<int>(style));
 
-  _animations.StopAll();
+  AnimationTimeline &animations = _animations[Compositor::BASE];
+  animations.stopAll();
   static const RgbColor black = RgbColor(0x00, 0x00, 0x00);
 
+  // When each pixel starts fading is worked out once for the whole transition
+  uint16_t fadeDuration = buildTransitionDelays(style, _clockFace, animationSpeed, _delayMap);
+
   // For all the LED animate a change from the current visible state to the new
   // one.
+  Layer &base = _compositor.layer(Compositor::BASE);
   const std::vector<bool> &state = _clockFace.getState();
   for (int index = 0; index < state.size(); index++)
   {
-    RgbColor originalColor = _pixels.GetPixelColor(index);
+    RgbColor originalColor = base.getPixel(index);
     RgbColor targetColor = (state[index] && !fadeToBlack) ? _brightnessController.getCorrectedColor() : black;
 
-    AnimUpdateCallback animUpdate = [=](const AnimationParam &param) {
+    TimelineCallback animUpdate = [=](const TimelineParam &param) {
       float progress = NeoEase::QuadraticIn(param.progress);
       RgbColor updatedColor = RgbColor::LinearBlend(
           originalColor, targetColor, progress);
-      _pixels.SetPixelColor(index, updatedColor);
+      _compositor.layer(Compositor::BASE).setPixel(index, updatedColor);
     };
-    _animations.StartAnimation(index, animationSpeed, animUpdate);
+    animations.startAt(index, startUs + _delayMap[index] * 1000UL, fadeDuration * 1000UL, animUpdate);
   }
 }
 
-//======== Color test animation functions ========
-
-// pick a new pixel and start its animation
-// Param: float luminance (0..1)
-//        0.0 = black, 0.25 is normal, 0.5 is bright
-void Display::_colorTestPixelStart(float luminance) {
-  // The 4 corner pixels should always be animated (to support matching the
-  //  faceplate corner holes over the corner LEDs)
-  for (int i = 0; i < 4; i++) {
-    if (!_animations.IsAnimationActive(i)) {
-      _colorTestAnimatePixel(i, luminance);
-    }
-  }
-
-  // pick a random pixel from the rest of the pixels
-  uint16_t pixel = random(_clockFace.pixelCount() - 4) + 4;
-
-  if (!_animations.IsAnimationActive(pixel)) {
-    _colorTestAnimatePixel(pixel, luminance);
-  }
-}
-
-// pick random time and next Hue color to animate the given pixel
-void Display::_colorTestAnimatePixel(uint16_t pixel, float luminance) {
-  // we use HslColor object as it allows us to easily pick a color
-  // with the same saturation and luminance 
-  //  leds[pos] += CHSV( gHue + random8(64), 200, 255);
-
-  RgbColor startingRgbColor = RgbColor(HslColor(gHue++ / 255.0f, 1.0f, luminance));
-  // set this color as the original color in the BrightnessController
-  _brightnessController.setOriginalColor(startingRgbColor);
-  // update brightness according to lightsensor value
-  _brightnessController.loop();
-  //  set that as the startingColor
-  _pixels.SetPixelColor(pixel, _brightnessController.getCorrectedColor());
-  _pixels.Show();
-
-  // fade to black
-  uint16_t time = random(170, 210); // time in centiseconds!! See Display::Display()
-  animationState[pixel].StartingColor = _pixels.GetPixelColor(pixel);
-  animationState[pixel].EndingColor = RgbColor(0);
-
-  AnimUpdateCallback blendAnimUpdate = [=](const AnimationParam &param) {
-    // this gets called for each animation on every time step
-    // progress will start at 0.0 and end at 1.0
-    // we use the blend function on the RgbColor to mix
-    // color based on the progress given to us in the animation
-    RgbColor updatedColor = RgbColor::LinearBlend(
-        animationState[param.index].StartingColor,
-        animationState[param.index].EndingColor,
-        param.progress);
-
-    // apply the color to the pixel
-    _pixels.SetPixelColor(param.index, updatedColor);
-  };
-
-  _animations.StartAnimation(pixel, time, blendAnimUpdate);
-}
-
-void Display::_colorTestLoop() {
-  if (firstTimeUpdate) {
-    // call _update() but fade all pixels to black
-    _update(40, true);
-    firstTimeUpdate = false;
-  }
-
-  if (millis() - t_lastPixelStart > POPULATION_THRESHOLD) {
-      _colorTestPixelStart(0.4f);
-      t_lastPixelStart = millis();
-  }
-
-  if (_animations.IsAnimating())
-  {
-      // the normal loop just needs these two to run the active animations
-      _animations.UpdateAnimations();
-      _pixels.Show();
-  }
-}
-
-//======== Puzzle mode functions ========
-
-// Given a pixel, fade it in to the current color
-void Display::_puzzleModeAnimatePixel(uint16_t pixel, int animationSpeed) {
-  // update brightness according to lightsensor value
-  _brightnessController.loop();
-
-  RgbColor originalColor = _pixels.GetPixelColor(pixel);
-  RgbColor targetColor = _brightnessController.getCorrectedColor();
-
-  AnimUpdateCallback blendAnimUpdate = [=](const AnimationParam &param) {
-    // this gets called for each animation on every time step
-    // progress will start at 0.0 and end at 1.0
-    // we use the blend function on the RgbColor to mix
-    // color based on the progress given to us in the animation
-    float progress = NeoEase::CubicOut(param.progress);
-    RgbColor updatedColor = RgbColor::LinearBlend(
-        originalColor, targetColor, progress);
-
-    // apply the color to the pixel
-    _pixels.SetPixelColor(param.index, updatedColor);
-  };
-
-  _animations.StartAnimation(pixel, animationSpeed, blendAnimUpdate);
-}
-
-// main loop for puzzle mode. Take either the word from the configuration portal or from Serial input
-// and tell the ClockFace to search for the word in the clock board and if found, show it.
-void Display::_puzzleModeLoop() {
-  static String str;
-  static PuzzleState puzzleState = PUZZLE_F2B;
-
-  if (firstTimeUpdate) {
-    puzzleState = PUZZLE_F2B;
-    firstTimeUpdate = false;
-  }
-
-  //Serial.printf("_puzzleModeLoop() puzzleState=(%d)\n", puzzleState);
-
-  if (puzzleState == PUZZLE_F2B) {
-    // call _update() but fade all pixels to black
-    _update(PUZZLE_DURATION_F2B, true); // create animations to fade board to black
-    puzzleState = PUZZLE_IDLE_AFTER_F2B;
-  }
-
-  // this block is to make sure that animations complete (incl fade to black) before continuing
-  if (_animations.IsAnimating()) {
-    // the normal loop just needs these two to run the active animations
-    _animations.UpdateAnimations();
-    _pixels.Show();
-    t_lastAnimation = millis();
-    return; // no other action until animations complete
-  }
-  
-  // This block makes sure we wait for the right duration after an animation is finished
-  // we use the puzzle state to control this
-  if (puzzleState == PUZZLE_IDLE_AFTER_F2B) {
-    //Serial.printf("_puzzleModeLoop() millis()=(%d) t_lastAnimation=(%d)\n", millis(), t_lastAnimation);
-    if (millis() - t_lastAnimation > PUZZLE_DELAY_AFTER_F2B) { // timeout
-      puzzleState = PUZZLE_ANIMATELETTER;
-    }
-    else { // we wait till delay AFTER F2B is done
-      return;
-    }
-  }
-
-  if (puzzleState == PUZZLE_IDLE_BEFORE_F2B) {
-    if (millis() - t_lastAnimation > PUZZLE_DELAY_BEFORE_F2B) { // timeout
-      puzzleState = PUZZLE_F2B;
-      return;
-    }
-    else { // we wait till delay BEFORE F2B is done
-      return;
-    }
-  }
-
-  // Now check if there are any letters that need to be faded in.
-  // Every letter is shown one by one with a delay between each letter
-  if (puzzleState == PUZZLE_ANIMATELETTER && _wordPixelsLen > 0) {
-    if (_wordPixelsIdx < _wordPixelsLen) { // still letters waiting
-      _puzzleModeAnimatePixel(_wordPixels[_wordPixelsIdx], PUZZLE_DURATION_LETTER);
-      Serial.printf("  Animating (%c)\n", str[_wordPixelsIdx]);
-      _wordPixelsIdx++;
-    }
-    else { // we're at the end, reset the word
-      _wordPixelsLen = 0;
-      _wordPixelsIdx = 0;
-      str = String();
-      // puzzleState = PUZZLE_IDLE_BEFORE_F2B;
-    }
-    return; // no other action until we're done with the letters
-  }
-
-  // this block is to determine the search string/word
-  if (!_findWord.equals("")) { // the internal parameter _findWord is set from the webinterface
-    str = _findWord;
-    _findWord = String(); // empty _findWord to prevent looping
-  } else { // Check Serial line
-    if (Serial.available()) { // data incoming on the serial input
-      // NOTE on readString using Serial !!
-      // using VSCode's serial monitor imposes different behavior than when using the ArduinoIDEs serial monitor
-      // ArduinoIDE allows you to set linefeed(\r) and carriage return(\n) separately.
-      // When using ArduinoIDE serial monitor, set to "No line ending" for code below to work correclty
-      // The VSC monitor sends \r\n as part of the string to the code, which add 2 characters to the string
-      // We solve this by trimming the string.
-      str = Serial.readString(); // Serial.readString() or Serial.readStringUntil('\n');
-    }
-  }
-
-  //str = String("escape"); // for testing
-  str.trim();
-  str.toUpperCase();
-  if (str.length() > 0) {
-    Serial.printf("Display::_puzzleModeLoop() str=(%s) len=%d\n", str, str.length());
-
-    if (_clockFace.determineLetterSequence(str, _wordPixels, &_wordPixelsLen)) {
-      puzzleState = PUZZLE_F2B; // fade all pixels to black
-      // NOTE: we don't do anything with _wordPixels here. After fade2black, the letters are processed
-
-      // for now, animate lighting up all letters together in found soluton
-      // for (int i = 0; i < str.length(); i++) {
-      //   _puzzleModeAnimatePixel(_wordPixels[i], 50);
-      // }
-    }
-    else { // add animations to light up corner pixels to indicate NOT FOUND
-      _update(40, true); // first set all pixels to fade to black...
-      for (int i = 0; i < 4; i++) {
-        _puzzleModeAnimatePixel(i, 30); // ...overwrite animations for corners to fade in
-      }
-    }
-  }
-}
\ No newline at end of file
+// The display the clock is built with, see Display in Display.h.
+template class DisplayT<NEOPIXEL_FEATURE, NEOPIXEL_GRID>;
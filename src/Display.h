@@ -1,22 +1,59 @@
 #pragma once
 
-#include <NeoPixelAnimator.h>
 #include <NeoPixelBrightnessBus.h>
 
+#include "AnimationTimeline.h"
 #include "BrightnessController.h"
+#include "ClockDiscipline.h"
 #include "ClockFace.h"
 #include "Clockmodes.h"
+#include "ColorOutput.h"
+#include "Compositor.h"
+#include "GridSize.h"
+#include "MinuteClock.h"
+#include "OutputBackend.h"
+#include "PowerBudget.h"
+#include "RtcClock.h"
+#include "StressMetrics.h"
+#include "Transitions.h"
 
 // The pin to control the matrix
 #define NEOPIXEL_PIN 32
 
-//
-#define TIME_CHANGE_ANIMATION_SPEED 300
+// Number of strips the matrix is split over, and their pins in strip order.
+// See ParallelOutput.
+#ifndef NEOPIXEL_CHANNELS
+#define NEOPIXEL_CHANNELS 1
+#endif
+#ifndef NEOPIXEL_PINS
+#define NEOPIXEL_PINS NEOPIXEL_PIN
+#endif
 
-class Display
+//
+// Renders the clock and its animations on the LED strip.
+//
+// Everything is rendered in RGB. TColorFeature is the NeoPixelBus feature of
+// the strip (e.g. NeoGrbFeature or NeoGrbwFeature); the last stage converts
+// the frame to it, see ColorOutput. TGrid is the size of the matrix (see
+// GridSize.h).
+//
+// Frames go to an OutputBackend without waiting for the previous frame to be
+// sent. If it is still on the wire, the new frame is kept and committed by a
+// later loop(), with whatever was drawn in the meantime.
+//
+template <typename TColorFeature, typename TGrid = WordClockGrid>
+class DisplayT
 {
 public:
-  Display(ClockFace &clockFace, uint8_t pin = NEOPIXEL_PIN);
+  typedef CompositorT<TGrid::PixelCount> Compositor;
+  typedef typename Compositor::Layer Layer;
+  typedef PowerBudgetT<TGrid::PixelCount> PowerBudget;
+  typedef ClockModes<TGrid> Modes;
+
+  // Color object of the strip, e.g. RgbColor or RgbwColor.
+  typedef typename TColorFeature::ColorObject OutputColor;
+
+  DisplayT(ClockFaceT<TGrid> &clockFace, OutputBackend<OutputColor> &output);
 
   void setup();
   void loop();
@@ -28,96 +65,170 @@ public:
   // Sets whether to show AM/PM information on the display.
   void setShowAmPm(bool show_ampm) { _show_ampm = show_ampm; }
 
-  // Sets the clock mode.
-  void setClockMode(ClockMode mode) { clock_mode_ = mode; }
+  // Sets the clock mode, see Clockmodes.h.
+  void setClockMode(uint8_t mode) { _modes.select(mode); }
+
+  // Sets how the clock face changes from one time to the next.
+  void setTransitionStyle(TransitionStyle style) { _transitionStyle = style; }
 
   // Sets the Word to find in puzzle mode
   void setFindWord(char *value, int len);
 
+  // Sets the seed of the color test animation, so a run can be replayed. The
+  // seed is applied when the color test (re)starts. 0 picks a random seed.
+  void setColorTestSeed(uint32_t seed) { _colorTestSeed = seed; }
+
+  // Sets the updates per second of the stress modes, 0 for one every frame.
+  void setStressRate(uint16_t rate) { _stressRate = rate; }
+
   // Starts an animation to update the clock to a new time if necessary.
-  void updateWithTime(int hour, int minute, int second, int animationSpeed = TIME_CHANGE_ANIMATION_SPEED);
+  // The animation speed is the duration of the fade in milliseconds. Returns
+  // whether the clock face changed.
+  bool updateWithTime(int hour, int minute, int second, int animationSpeed = TIME_CHANGE_ANIMATION_SPEED);
+  // Same, with the animation starting at `startUs` (micros() units). Lets the
+  // next time be rendered ahead, so the fade starts right on the minute.
+  bool updateWithTimeAt(uint32_t startUs, int hour, int minute, int second,
+                        int animationSpeed = TIME_CHANGE_ANIMATION_SPEED);
 
-private:
-  // Updates pixel color on the display.
-  void _update(int animationSpeed = TIME_CHANGE_ANIMATION_SPEED, bool fadeToBlack = false);
+  // Sets the time zone of the real time clock, a POSIX TZ rule as in
+  // Timezones.h.
+  void setTimeZone(const char *rule) { _modes.template get<RealTimeMode>().setTimeZone(rule); }
+
+  // Sets the maximum current [mA] the LEDs may draw, 0 for no limit.
+  void setPowerLimit(uint16_t milliamps);
+
+  // Current and energy estimates of the LEDs.
+  const PowerBudget &powerBudget() const { return _power; }
+
+  // Frames sent to the LEDs, and frames drawn over before they could be sent
+  // because the output was still busy, since startup.
+  uint32_t committedFrames() const { return _committedFrames; }
+  uint32_t droppedFrames() const { return _droppedFrames; }
+
+  // Metrics of the last run of a stress mode.
+  const StressMetrics &stressMetrics() const { return _stressMetrics; }
 
-  // Update the clock with realtime clock data, using updateWithTime()
-  void _updateClockRealTime();
+  // Gives access to one of the display layers, e.g. to draw a status
+  // indication on the overlay. Changes show up with the next loop().
+  Layer &layer(typename Compositor::LayerId id) { return _compositor.layer(id); }
+
+  //======================================
+  // For the clock modes
+
+  // Updates pixel color on the display, fading in `animationSpeed` [ms]. The
+  // style decides when each pixel starts its part of the fade.
+  void transition(int animationSpeed = TIME_CHANGE_ANIMATION_SPEED, bool fadeToBlack = false,
+                  TransitionStyle style = TransitionStyle::FADE);
+  // Same, starting at `startUs` (micros() units) rather than now.
+  void transitionAt(uint32_t startUs, int animationSpeed, bool fadeToBlack = false,
+                    TransitionStyle style = TransitionStyle::FADE);
+
+  ClockFaceT<TGrid> &clockFace() { return _clockFace; }
+  // Animations of the pixels of a layer. Every layer has its own, so that
+  // an effect does not cancel a fade of the layer below it.
+  AnimationTimeline &animations(typename Compositor::LayerId id) { return _animations[id]; }
+  BrightnessController &brightnessController() { return _brightnessController; }
+  // UTC between the syncs, see ClockDiscipline. Fed by the configuration.
+  ClockDiscipline &timeBase() { return _timeBase; }
+  // The RTC, the time until NTP synced, or nullptr if there is none.
+  RtcClock *rtc() { return _rtc; }
+  void setRtc(RtcClock *rtc) { _rtc = rtc; }
+
+  uint32_t colorTestSeed() const { return _colorTestSeed; }
+  uint16_t stressRate() const { return _stressRate; }
+  StressMetrics &stressMetrics() { return _stressMetrics; }
+
+  // Returns the word set with setFindWord() once, then an empty string.
+  String takeFindWord();
+
+private:
+  // Composites the layers and sends the result to the LEDs if anything
+  // changed since the previous commit, as soon as the output is free.
+  void _commit();
 
   // To know which pixels to turn on and off, one needs to know which letter
   // matches which LED, and the orientation of the display. This is the job
   // of the clockFace.
-  ClockFace &_clockFace;
+  ClockFaceT<TGrid> &_clockFace;
 
   // Whether the display should show AM/PM information.
   bool _show_ampm = 1;
 
-  // Clock display mode.
-  ClockMode clock_mode_ = ClockMode::REAL_TIME;
+  // Clock display modes and their state.
+  Modes _modes;
+
+  // Transition used when the time changes.
+  TransitionStyle _transitionStyle = TransitionStyle::FADE;
+
+  // Start delay [ms] of every pixel in the current transition.
+  uint16_t _delayMap[TGrid::PixelCount];
 
   // Color of the LEDs. Can be manipulated via Web configuration interface.
   RgbColor _color;
 
-  // Addressable bus to control the LEDs.
-  NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod> _pixels;
+  // Sends the frames to the LEDs.
+  OutputBackend<OutputColor> &_output;
+  // Whether _output holds a frame that still has to be committed.
+  bool _commitPending = false;
+  // See committedFrames() and droppedFrames().
+  uint32_t _committedFrames = 0;
+  uint32_t _droppedFrames = 0;
+
+  // Layers (clock, effect, overlay) that are blended into _output.
+  Compositor _compositor;
+
+  // Estimates the current of the composited frame and dims the output when
+  // it goes over the limit.
+  PowerBudget _power;
+  // Scale applied to the pixels in _output.
+  uint8_t _outputScale = 255;
+
+  // The composited frame converted for the strip, before scaling.
+  OutputColor _frame[TGrid::PixelCount];
 
   // Reacts to change in ambient light to adapt the power of the LEDs
   BrightnessController _brightnessController;
 
-  // Animation time management object.
-  // Uses centiseconds as precision, so an animation can range from 1/100 of a
-  // second to a little bit more than 10 minutes.
-  // For documentation on NeoPixelAnimator visit: https://github.com/Makuna/NeoPixelBus/wiki/NeoPixelAnimator-object
-  NeoPixelAnimator _animations;
+  ClockDiscipline _timeBase;
+  RtcClock *_rtc = nullptr;
 
-  //======================================
-  // Shared between Color test & Puzzle mode
-  // What is stored for state is specific to the need, in this case the colors
-  // basically whatever you need inside the animation update function
-  struct MyAnimationState
-  {
-      RgbColor StartingColor;
-      RgbColor EndingColor;
-  };
-
-  // one entry per pixel to match the animation timing manager
-  MyAnimationState *animationState;
+  // Animation time management objects, one per layer, one slot per pixel.
+  // Run on micros(), so durations are not quantized, and progress is taken
+  // from absolute start times so a late frame doesn't stretch an animation.
+  AnimationTimeline _animations[Compositor::LAYER_COUNT];
 
-  //======================================
-  // Color test constants, variables and functions
-  const uint8_t POPULATION_THRESHOLD = 60; // delay [ms] between new pixel animations
-  uint8_t gHue = 0;
-  unsigned long t_lastPixelStart = 0;
-  bool firstTimeUpdate = true;
+  // Seed of the color test, 0 for a random one.
+  uint32_t _colorTestSeed = 0;
 
-  // void _blendAnimUpdate(const AnimationParam &param);
-  void _colorTestPixelStart(float luminance = 0.2f);
-  void _colorTestAnimatePixel(uint16_t pixel, float luminance);
-  void _colorTestLoop();
+  // Updates per second of the stress modes, 0 for one every frame.
+  uint16_t _stressRate = 0;
+  // Shared by the stress modes, only one runs at a time.
+  StressMetrics _stressMetrics;
 
-  //======================================
-  // Puzzle mode constants, variables and functions
-  enum PuzzleState {
-      PUZZLE_F2B,
-      PUZZLE_IDLE_AFTER_F2B,
-      PUZZLE_IDLE_BEFORE_F2B,
-      PUZZLE_ANIMATELETTER
-  };
-
-  const uint8_t PUZZLE_DURATION_F2B = 40; // duration [cs] of fade2black animation
-  const uint8_t PUZZLE_DURATION_LETTER = 70; // duration [cs] of letter fade-in animation
-  const uint16_t PUZZLE_DELAY_AFTER_F2B = 2500; // delay [ms] after fade2black animation
-  const uint16_t PUZZLE_DELAY_BEFORE_F2B = 2000; // delay [ms] showing a word, before fade2black animation
-  unsigned long t_lastAnimation = 0;
-
-  // word to find on the board
+  // word to find on the board in puzzle mode
   String _findWord;
-
-  // pixels corresponding to _findWord (after search)
-  uint16_t _wordPixels[32];
-  int _wordPixelsLen;
-  int _wordPixelsIdx;
-
-  void _puzzleModeAnimatePixel(uint16_t pixel, int animationSpeed);
-  void _puzzleModeLoop();
 };
+
+// Define NEOPIXEL_RGBW (see platformio.ini) for SK6812 RGBW strips.
+#ifdef NEOPIXEL_RGBW
+#define NEOPIXEL_FEATURE NeoGrbwFeature
+#else
+#define NEOPIXEL_FEATURE NeoGrbFeature
+#endif
+
+// The NeoPixelBus method of the strips. With several channels, they are sent
+// in parallel by the I2S peripheral.
+#ifndef NEOPIXEL_METHOD
+#if NEOPIXEL_CHANNELS > 1
+#define NEOPIXEL_METHOD NeoEsp32I2s1X8Ws2812xMethod
+#else
+#define NEOPIXEL_METHOD Neo800KbpsMethod
+#endif
+#endif
+
+// The output of the clock. To run without LEDs, use a ChannelBackend of
+// FakeChannel instead.
+typedef ChannelBackend<NEOPIXEL_FEATURE, NeoPixelBus<NEOPIXEL_FEATURE, NEOPIXEL_METHOD>,
+                       NEOPIXEL_CHANNELS>
+    DisplayOutput;
+typedef DisplayT<NEOPIXEL_FEATURE, NEOPIXEL_GRID> Display;
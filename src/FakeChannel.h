@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+
+//
+// Stand-in for a NeoPixelBus channel when running the display on a host (or
+// without LEDs). Keeps the pixels in memory and records when frames are shown
+// and how long they would take on the wire, so the frame time of a
+// ParallelOutput can be checked without hardware.
+//
+// Like the asynchronous NeoPixelBus methods, Show() returns right away and
+// the channel is busy until the simulated wire time has passed; a Show()
+// while busy waits for the previous frame, and the wait is recorded.
+//
+template <typename TColorFeature>
+class FakeChannel
+{
+public:
+  typedef typename TColorFeature::ColorObject ColorObject;
+
+  // WS2812x timing: 1.25us per bit, then a 300us latch.
+  static const uint32_t NANOSECONDS_PER_BIT = 1250;
+  static const uint32_t LATCH_US = 300;
+
+  FakeChannel(uint16_t pixelCount, uint8_t pin)
+      : _pixelCount(pixelCount), _pin(pin), _pixels(new ColorObject[pixelCount]),
+        _wireUs((pixelCount * TColorFeature::PixelSize * 8 * NANOSECONDS_PER_BIT) / 1000 + LATCH_US)
+  {
+    for (uint16_t i = 0; i < pixelCount; i++)
+      _pixels[i] = ColorObject(0);
+  }
+
+  ~FakeChannel() { delete[] _pixels; }
+
+  void Begin() {}
+
+  void Show()
+  {
+    uint32_t requested = micros();
+    while (!CanShow())
+      ;
+    _startUs = micros();
+    _stallUs += _startUs - requested;
+    _showCount++;
+    _busy = true;
+  }
+
+  bool CanShow() const
+  {
+    return !_busy || micros() - _startUs >= _wireUs;
+  }
+
+  void SetPixelColor(uint16_t index, const ColorObject &color) { _pixels[index] = color; }
+  ColorObject GetPixelColor(uint16_t index) const { return _pixels[index]; }
+  uint16_t PixelCount() const { return _pixelCount; }
+
+  uint8_t pin() const { return _pin; }
+  // Time [us] one frame of this channel takes on the wire.
+  uint32_t wireUs() const { return _wireUs; }
+  // micros() when the last frame started, and when it is done.
+  uint32_t lastShowUs() const { return _startUs; }
+  uint32_t lastDoneUs() const { return _startUs + _wireUs; }
+  // Frames shown, and the total time [us] Show() waited for a busy channel.
+  uint32_t showCount() const { return _showCount; }
+  uint32_t stallUs() const { return _stallUs; }
+
+private:
+  const uint16_t _pixelCount;
+  const uint8_t _pin;
+  ColorObject *_pixels;
+  const uint32_t _wireUs;
+
+  bool _busy = false;
+  uint32_t _startUs = 0;
+  uint32_t _showCount = 0;
+  uint32_t _stallUs = 0;
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <esp_timer.h>
+#include <string.h>
+
+#include "I2CBus.h"
+#include "PosixTimeZone.h"
+#include "RtcClock.h"
+
+//
+// Stand-in for a DS3231 on its I2C bus when running on a host, so RtcClock
+// can be checked without hardware.
+//
+// Keeps the time, status and aging offset registers, and counts seconds on
+// esp_timer_get_time() with a frequency error that the aging offset takes
+// out like on the chip. Writing the seconds restarts the second. The chip
+// can be taken off the bus, or made to lose its time like on a power cut
+// without a battery; like a new chip, it starts without a time.
+//
+class FakeDS3231 : public I2CBus
+{
+public:
+  // A chip that lost its time, at 2000-01-01.
+  FakeDS3231() : FakeDS3231(946684800LL)
+  {
+    losePower();
+  }
+  // Starts at UTC `utc` [s], `ppm` fast.
+  explicit FakeDS3231(int64_t utc, float ppm = 0)
+      : _utc(utc), _ppm(ppm), _lastUs(esp_timer_get_time())
+  {
+    memset(_registers, 0, sizeof(_registers));
+    _registers[REG_TEMPERATURE] = 25;
+  }
+
+  bool readRegisters(uint8_t address, uint8_t reg, uint8_t *data, uint8_t length) override
+  {
+    if (!_present || address != RTC_ADDRESS || reg + length > REGISTER_COUNT)
+      return false;
+    _update();
+    _timeToRegisters();
+    memcpy(data, _registers + reg, length);
+    _reads++;
+    return true;
+  }
+
+  bool writeRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length) override
+  {
+    if (!_present || address != RTC_ADDRESS || reg + length > REGISTER_COUNT)
+      return false;
+    _update();
+    _timeToRegisters();
+    memcpy(_registers + reg, data, length);
+    if (reg < TIME_REGISTER_COUNT)
+    {
+      _registersToTime();
+      if (reg == 0)
+        _phaseUs = 0;
+    }
+    _writes++;
+    return true;
+  }
+
+  // Whether the chip answers on the bus.
+  void setPresent(bool present) { _present = present; }
+  // Stops the oscillator for a moment: the time is lost.
+  void losePower() { _registers[REG_STATUS] |= 0x80; }
+  // Frequency error [ppm] of the crystal, before the aging offset.
+  void setDriftPpm(float ppm)
+  {
+    _update();
+    _ppm = ppm;
+  }
+
+  // UTC [us] the chip counts now, with the part of the second the registers
+  // do not show.
+  int64_t utcUs()
+  {
+    _update();
+    return _utc * 1000000LL + static_cast<int64_t>(_phaseUs);
+  }
+  int8_t agingOffset() const { return static_cast<int8_t>(_registers[REG_AGING]); }
+  bool lostTime() const { return _registers[REG_STATUS] & 0x80; }
+  uint32_t reads() const { return _reads; }
+  uint32_t writes() const { return _writes; }
+
+private:
+  static const uint8_t REGISTER_COUNT = 0x13;
+  static const uint8_t TIME_REGISTER_COUNT = 7;
+  static const uint8_t REG_STATUS = 0x0F;
+  static const uint8_t REG_AGING = 0x10;
+  static const uint8_t REG_TEMPERATURE = 0x11;
+
+  static uint8_t fromBcd(uint8_t value) { return (value >> 4) * 10 + (value & 0x0F); }
+  static uint8_t toBcd(unsigned value) { return ((value / 10) << 4) | (value % 10); }
+
+  // Counts the seconds since the last access. Each step of the aging offset
+  // slows the oscillator by RTC_AGING_PPM_PER_STEP.
+  void _update()
+  {
+    int64_t nowUs = esp_timer_get_time();
+    double rate = 1.0 + (_ppm - agingOffset() * RTC_AGING_PPM_PER_STEP) * 1e-6;
+    _phaseUs += (nowUs - _lastUs) * rate;
+    _lastUs = nowUs;
+    while (_phaseUs >= 1000000)
+    {
+      _phaseUs -= 1000000;
+      _utc++;
+    }
+  }
+
+  void _timeToRegisters()
+  {
+    int64_t days = _utc / 86400;
+    unsigned seconds = static_cast<unsigned>(_utc % 86400);
+    int64_t year;
+    unsigned month, day;
+    PosixTimeZone::civilFromDays(days, year, month, day);
+    _registers[0] = toBcd(seconds % 60);
+    _registers[1] = toBcd(seconds / 60 % 60);
+    _registers[2] = toBcd(seconds / 3600);
+    _registers[3] = (days + 4) % 7 + 1;
+    _registers[4] = toBcd(day);
+    _registers[5] = toBcd(month) | (year >= 2100 ? 0x80 : 0);
+    _registers[6] = toBcd(year % 100);
+  }
+
+  void _registersToTime()
+  {
+    int64_t year = 2000 + fromBcd(_registers[6]) + (_registers[5] & 0x80 ? 100 : 0);
+    _utc = PosixTimeZone::daysFromCivil(year, fromBcd(_registers[5] & 0x1F), fromBcd(_registers[4])) * 86400 +
+           fromBcd(_registers[2] & 0x3F) * 3600 + fromBcd(_registers[1]) * 60 + fromBcd(_registers[0]);
+  }
+
+  uint8_t _registers[REGISTER_COUNT];
+  bool _present = true;
+
+  // The time: `_utc` [s] and `_phaseUs` into the next second, at `_lastUs`.
+  int64_t _utc;
+  double _phaseUs = 0;
+  float _ppm;
+  int64_t _lastUs;
+
+  uint32_t _reads = 0;
+  uint32_t _writes = 0;
+};
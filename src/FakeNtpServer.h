@@ -0,0 +1,142 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <esp_timer.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string.h>
+
+#include "SntpClient.h"
+
+//
+// Stand-in for an NTP server when running on a host, to check SntpClient
+// against real UDP on loopback (see SocketUdpTransport).
+//
+// Answers with a clock `offsetUs` off the host's, as if every request and
+// every answer took half of `delayUs` on the network: a request is stamped
+// received half the delay after it came in, and the answer goes out half the
+// delay after it is stamped sent. Like a client's transport, nothing happens
+// on its own: loop() takes the requests and sends the answers that are due.
+//
+class FakeNtpServer
+{
+public:
+  FakeNtpServer(const char *address, uint16_t port, int64_t offsetUs = 0,
+                int64_t delayUs = 0, uint8_t stratum = 2)
+      : _address(address), _port(port), _offsetUs(offsetUs), _delayUs(delayUs), _stratum(stratum) {}
+
+  ~FakeNtpServer()
+  {
+    if (_fd >= 0)
+      close(_fd);
+  }
+
+  // Starts listening. Returns false if the address cannot be bound.
+  bool begin()
+  {
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(_port);
+    if (inet_pton(AF_INET, _address, &address.sin_addr) != 1)
+      return false;
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    return _fd >= 0 && bind(_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0;
+  }
+
+  void loop()
+  {
+    int64_t nowUs = esp_timer_get_time();
+
+    // take the new requests, while there is room to hold them
+    while (_count < QUEUE_SIZE)
+    {
+      Request &request = _queue[_count];
+      socklen_t fromLength = sizeof(request.from);
+      ssize_t length = recvfrom(_fd, request.packet, sizeof(request.packet), MSG_DONTWAIT,
+                                reinterpret_cast<sockaddr *>(&request.from), &fromLength);
+      if (length < 0)
+        break;
+      _requests++;
+      if (_silent || length < SNTP_PACKET_SIZE)
+        continue;
+      request.arrivedUs = nowUs;
+      request.stamped = false;
+      _count++;
+    }
+
+    for (uint8_t i = 0; i < _count;)
+    {
+      Request &request = _queue[i];
+      if (!request.stamped && nowUs >= request.arrivedUs + _delayUs / 2)
+      {
+        _answer(request);
+        request.stamped = true;
+      }
+      if (request.stamped && nowUs >= request.arrivedUs + _delayUs)
+      {
+        sendto(_fd, request.packet, SNTP_PACKET_SIZE, 0,
+               reinterpret_cast<sockaddr *>(&request.from), sizeof(request.from));
+        _queue[i] = _queue[--_count];
+        continue;
+      }
+      i++;
+    }
+  }
+
+  // Changes the answers from now on.
+  void setOffsetUs(int64_t offsetUs) { _offsetUs = offsetUs; }
+  void setStratum(uint8_t stratum) { _stratum = stratum; }
+  // A silent server takes the requests and never answers.
+  void setSilent(bool silent) { _silent = silent; }
+
+  uint32_t requests() const { return _requests; }
+
+private:
+  static const uint8_t QUEUE_SIZE = 8;
+
+  struct Request
+  {
+    uint8_t packet[SNTP_PACKET_SIZE];
+    sockaddr_in from;
+    int64_t arrivedUs;
+    bool stamped;
+  };
+
+  // Turns the request into the answer, received and sent right now.
+  void _answer(Request &request)
+  {
+    timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    int64_t utcUs = now.tv_sec * 1000000LL + now.tv_nsec / 1000 + _offsetUs;
+    uint64_t seconds = static_cast<uint64_t>(utcUs / 1000000 + 2208988800LL) & 0xFFFFFFFF;
+    uint64_t fraction = (static_cast<uint64_t>(utcUs % 1000000) << 32) / 1000000;
+    uint64_t timestamp = seconds << 32 | fraction;
+
+    uint8_t *p = request.packet;
+    uint8_t version = (p[0] >> 3) & 0x07;
+    // the transmit time of the request is echoed as the originate time
+    memcpy(p + 24, p + 40, 8);
+    p[0] = version << 3 | 4; // no leap warning, server
+    p[1] = _stratum;
+    for (int i = 0; i < 8; i++)
+    {
+      p[32 + i] = p[40 + i] = timestamp >> (56 - 8 * i);
+      p[16 + i] = p[32 + i]; // reference time
+    }
+  }
+
+  const char *_address;
+  uint16_t _port;
+  int64_t _offsetUs;
+  int64_t _delayUs;
+  uint8_t _stratum;
+  bool _silent = false;
+  int _fd = -1;
+
+  Request _queue[QUEUE_SIZE];
+  uint8_t _count = 0;
+  uint32_t _requests = 0;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// Small, fast and seedable pseudo random number generator (xorshift32).
+//
+// Unlike random(), which on the ESP32 draws from the hardware RNG, the
+// sequence only depends on the seed. Animations using it can therefore be
+// replayed exactly, on the device as well as on a host build.
+//
+class FastRandom
+{
+public:
+  explicit FastRandom(uint32_t seed = 1) { setSeed(seed); }
+
+  // Restarts the sequence. A seed of 0 is replaced, xorshift would get stuck.
+  void setSeed(uint32_t seed)
+  {
+    _seed = seed;
+    _state = seed != 0 ? seed : 0x9E3779B9u;
+  }
+  uint32_t seed() const { return _seed; }
+
+  uint32_t next()
+  {
+    uint32_t x = _state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return _state = x;
+  }
+
+  // Returns a value in [0, bound), without a division.
+  uint32_t below(uint32_t bound)
+  {
+    return static_cast<uint32_t>((static_cast<uint64_t>(next()) * bound) >> 32);
+  }
+
+  // Returns a value in [low, high).
+  uint32_t between(uint32_t low, uint32_t high) { return low + below(high - low); }
+
+private:
+  uint32_t _seed;
+  uint32_t _state;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// Compile-time dimensions of a word clock matrix.
+//
+// Width is the number of letters in a row, Height the number of rows. Signals
+// is the number of LEDs wired before the start of the matrix (the minute
+// corners).
+//
+template <uint8_t TWidth, uint8_t THeight, uint8_t TSignals = 4>
+struct GridSize
+{
+  static const uint8_t Width = TWidth;
+  static const uint8_t Height = THeight;
+  static const uint8_t Signals = TSignals;
+
+  // Number of LEDs on the whole strip.
+  static const uint16_t PixelCount = TWidth * THeight + TSignals;
+};
+
+// The 11x10 letter matrix of the English and French clock faces.
+typedef GridSize<11, 10> WordClockGrid;
+// Larger word walls. Placeholders: there is no clock face of their size yet.
+typedef GridSize<16, 16> WordWallGrid16x16;
+typedef GridSize<32, 16> WordWallGrid32x16;
+
+// The grid the clock is built for.
+#ifndef NEOPIXEL_GRID
+#define NEOPIXEL_GRID WordClockGrid
+#endif
+
+// Applies X to every grid the grid templates are instantiated for: only the
+// one built for, as the firmware drives a single display and the code of
+// any other grid would be dead weight in flash.
+#define FOR_EACH_GRID(X) X(NEOPIXEL_GRID)
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// Register access to the devices on an I2C bus.
+//
+// The RTC driver (see RtcClock) only talks to this interface, so it runs on
+// the ESP32 with WireBus and on a host with FakeDS3231.
+//
+class I2CBus
+{
+public:
+  virtual ~I2CBus() {}
+
+  // Reads `length` registers of the device at `address`, from `reg` on.
+  // Returns false if the device does not answer.
+  virtual bool readRegisters(uint8_t address, uint8_t reg, uint8_t *data, uint8_t length) = 0;
+  // Writes `length` registers of the device at `address`, from `reg` on.
+  virtual bool writeRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length) = 0;
+};
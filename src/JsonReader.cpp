@@ -0,0 +1,337 @@
+#include <string.h>
+
+#include "JsonReader.h"
+
+namespace
+{
+  bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+  bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+  const char *skipSpace(const char *p, const char *end)
+  {
+    while (p < end && isSpace(*p))
+      p++;
+    return p;
+  }
+
+  int hexDigit(char c)
+  {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    if (c >= 'a' && c <= 'f')
+      return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+      return c - 'A' + 10;
+    return -1;
+  }
+
+  // Reads the 4 hex digits of a \u escape at `p`, into `code`.
+  bool readHex4(const char *&p, const char *end, uint16_t &code)
+  {
+    if (end - p < 4)
+      return false;
+    code = 0;
+    for (int i = 0; i < 4; i++)
+    {
+      int digit = hexDigit(*p++);
+      if (digit < 0)
+        return false;
+      code = code << 4 | digit;
+    }
+    return true;
+  }
+
+  // See readChar(). Leaves `p` anywhere when it returns 0.
+  uint8_t decodeChar(const char *&p, const char *end, char out[4])
+  {
+    if (p >= end || *p == '"' || static_cast<unsigned char>(*p) < 0x20)
+      return 0;
+    if (*p != '\\')
+    {
+      out[0] = *p++;
+      return 1;
+    }
+    if (++p >= end)
+      return 0;
+    char c = *p++;
+    switch (c)
+    {
+    case '"': case '\\': case '/': out[0] = c; return 1;
+    case 'b': out[0] = '\b'; return 1;
+    case 'f': out[0] = '\f'; return 1;
+    case 'n': out[0] = '\n'; return 1;
+    case 'r': out[0] = '\r'; return 1;
+    case 't': out[0] = '\t'; return 1;
+    case 'u': break;
+    default: return 0;
+    }
+    uint16_t code;
+    if (!readHex4(p, end, code) || code == 0 || (code >= 0xDC00 && code < 0xE000))
+      return 0;
+    if (code < 0x80)
+    {
+      out[0] = code;
+      return 1;
+    }
+    if (code < 0x800)
+    {
+      out[0] = 0xC0 | code >> 6;
+      out[1] = 0x80 | (code & 0x3F);
+      return 2;
+    }
+    if (code < 0xD800 || code >= 0xE000)
+    {
+      out[0] = 0xE0 | code >> 12;
+      out[1] = 0x80 | (code >> 6 & 0x3F);
+      out[2] = 0x80 | (code & 0x3F);
+      return 3;
+    }
+
+    // a high surrogate: outside the basic plane, with the low one after it
+    uint16_t low;
+    if (end - p < 2 || p[0] != '\\' || p[1] != 'u')
+      return 0;
+    p += 2;
+    if (!readHex4(p, end, low) || low < 0xDC00 || low >= 0xE000)
+      return 0;
+    uint32_t point = 0x10000 + ((static_cast<uint32_t>(code) - 0xD800) << 10) + (low - 0xDC00);
+    out[0] = 0xF0 | point >> 18;
+    out[1] = 0x80 | (point >> 12 & 0x3F);
+    out[2] = 0x80 | (point >> 6 & 0x3F);
+    out[3] = 0x80 | (point & 0x3F);
+    return 4;
+  }
+
+  // Reads the character at `p` of a string, up to `end`, as UTF-8 bytes in
+  // `out` (escapes decoded). Returns how many bytes, or 0, with `p` left
+  // where it was, at the closing quote or if the string is not well formed
+  // there. \u0000 is not taken, a C string would end there, nor is half of
+  // a surrogate pair.
+  uint8_t readChar(const char *&p, const char *end, char out[4])
+  {
+    const char *start = p;
+    uint8_t count = decodeChar(p, end, out);
+    if (count == 0)
+      p = start;
+    return count;
+  }
+
+  // Skips the string starting at the '"' at `p`. Returns the position after
+  // it, or nullptr if it is not well formed.
+  const char *skipString(const char *p, const char *end)
+  {
+    char bytes[4];
+    for (p++; readChar(p, end, bytes) > 0;)
+      ;
+    return p < end && *p == '"' ? p + 1 : nullptr;
+  }
+
+  const char *skipNumber(const char *p, const char *end)
+  {
+    if (p < end && *p == '-')
+      p++;
+    if (p >= end || !isDigit(*p))
+      return nullptr;
+    if (*p == '0')
+      p++;
+    else
+      while (p < end && isDigit(*p))
+        p++;
+    if (p < end && *p == '.')
+    {
+      if (++p >= end || !isDigit(*p))
+        return nullptr;
+      while (p < end && isDigit(*p))
+        p++;
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+      if (++p < end && (*p == '+' || *p == '-'))
+        p++;
+      if (p >= end || !isDigit(*p))
+        return nullptr;
+      while (p < end && isDigit(*p))
+        p++;
+    }
+    return p;
+  }
+
+  const char *skipWord(const char *p, const char *end, const char *word)
+  {
+    size_t length = strlen(word);
+    return static_cast<size_t>(end - p) >= length && strncmp(p, word, length) == 0
+               ? p + length
+               : nullptr;
+  }
+
+  // Skips the value at `p` (no space before it), and sets its type. Returns
+  // the position after it, or nullptr if it is not well formed.
+  const char *skipValue(const char *p, const char *end, uint8_t depth, JsonValue::Type &type)
+  {
+    if (p >= end)
+      return nullptr;
+    switch (*p)
+    {
+    case '"':
+      type = JsonValue::Type::String;
+      return skipString(p, end);
+    case 't':
+      type = JsonValue::Type::Bool;
+      return skipWord(p, end, "true");
+    case 'f':
+      type = JsonValue::Type::Bool;
+      return skipWord(p, end, "false");
+    case 'n':
+      type = JsonValue::Type::Null;
+      return skipWord(p, end, "null");
+    case '{':
+    case '[':
+      break;
+    default:
+      type = JsonValue::Type::Number;
+      return skipNumber(p, end);
+    }
+
+    bool object = *p == '{';
+    type = object ? JsonValue::Type::Object : JsonValue::Type::Array;
+    if (depth >= JSON_READER_MAX_DEPTH)
+      return nullptr;
+    char close = object ? '}' : ']';
+    p = skipSpace(p + 1, end);
+    if (p < end && *p == close)
+      return p + 1;
+    JsonValue::Type member;
+    for (;;)
+    {
+      if (object)
+      {
+        if (p >= end || *p != '"' || (p = skipString(p, end)) == nullptr)
+          return nullptr;
+        p = skipSpace(p, end);
+        if (p >= end || *p != ':')
+          return nullptr;
+        p = skipSpace(p + 1, end);
+      }
+      if ((p = skipValue(p, end, depth + 1, member)) == nullptr)
+        return nullptr;
+      p = skipSpace(p, end);
+      if (p < end && *p == close)
+        return p + 1;
+      if (p >= end || *p != ',')
+        return nullptr;
+      p = skipSpace(p + 1, end);
+    }
+  }
+} // namespace
+
+bool JsonValue::toInt(int32_t min, int32_t max, int32_t &value) const
+{
+  if (type != Type::Number)
+    return false;
+  const char *p = start;
+  const char *end = start + length;
+  bool negative = *p == '-';
+  if (negative)
+    p++;
+  int64_t number = 0;
+  for (; p < end && isDigit(*p); p++)
+  {
+    number = number * 10 + (*p - '0');
+    if (number > INT32_MAX + 1LL)
+      return false;
+  }
+  if (p != end)
+    return false; // a fraction or an exponent
+  if (negative)
+    number = -number;
+  if (number < min || number > max)
+    return false;
+  value = number;
+  return true;
+}
+
+bool JsonValue::toBool(bool &value) const
+{
+  if (type != Type::Bool)
+    return false;
+  value = *start == 't';
+  return true;
+}
+
+bool JsonValue::copyTo(char *out, size_t size) const
+{
+  if (type != Type::String || size == 0)
+    return false;
+  const char *p = start;
+  const char *end = start + length;
+  size_t n = 0;
+  char bytes[4];
+  for (uint8_t count; (count = readChar(p, end, bytes)) > 0;)
+  {
+    if (n + count >= size)
+      return false;
+    memcpy(out + n, bytes, count);
+    n += count;
+  }
+  out[n] = '\0';
+  return true;
+}
+
+bool JsonValue::equals(const char *text) const
+{
+  if (type != Type::String)
+    return false;
+  const char *p = start;
+  const char *end = start + length;
+  char bytes[4];
+  for (uint8_t count; (count = readChar(p, end, bytes)) > 0; text += count)
+  {
+    if (strncmp(text, bytes, count) != 0)
+      return false;
+  }
+  return *text == '\0';
+}
+
+JsonReader::JsonReader(const char *text, size_t length) : _end(text + length)
+{
+  const char *p = skipSpace(text, _end);
+  JsonValue::Type type;
+  const char *after = skipValue(p, _end, 0, type);
+  if (after != nullptr && type == JsonValue::Type::Object && skipSpace(after, _end) == _end)
+    _object = p;
+}
+
+JsonValue JsonReader::get(const char *key) const
+{
+  JsonValue value;
+  if (_object == nullptr)
+    return value;
+
+  // well formed, checked by the constructor
+  const char *p = skipSpace(_object + 1, _end);
+  while (*p == '"')
+  {
+    JsonValue name;
+    name.type = JsonValue::Type::String;
+    name.start = p + 1;
+    p = skipString(p, _end);
+    name.length = p - 1 - name.start;
+    p = skipSpace(skipSpace(p, _end) + 1, _end);
+
+    value.start = p;
+    p = skipValue(p, _end, 1, value.type);
+    value.length = p - value.start;
+    if (value.type == JsonValue::Type::String)
+    {
+      value.start++;
+      value.length -= 2;
+    }
+    if (name.equals(key))
+      return value;
+    p = skipSpace(p, _end);
+    if (*p == ',')
+      p = skipSpace(p + 1, _end);
+  }
+  return JsonValue();
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Deepest nesting of objects and arrays a JsonReader accepts.
+#define JSON_READER_MAX_DEPTH 8
+
+//
+// A value in the text of a JsonReader: where it is, not a copy of it. Only
+// valid as long as the text is.
+//
+struct JsonValue
+{
+  enum class Type : uint8_t
+  {
+    None, // not there
+    Null,
+    Bool,
+    Number,
+    String,
+    Object,
+    Array,
+  };
+
+  Type type = Type::None;
+  // The value as it is in the text. Strings without their quotes, and still
+  // escaped.
+  const char *start = nullptr;
+  size_t length = 0;
+
+  bool exists() const { return type != Type::None; }
+
+  // An integer number from `min` to `max`, in `value`.
+  bool toInt(int32_t min, int32_t max, int32_t &value) const;
+
+  bool toBool(bool &value) const;
+
+  // Copies a string, unescaped and with its terminating '\0', into `out`.
+  // False if it is not a string, or does not fit in `size`.
+  bool copyTo(char *out, size_t size) const;
+
+  // Whether it is the string `text`, once unescaped.
+  bool equals(const char *text) const;
+};
+
+//
+// Reads a JSON object where it is, such as the body of a request: nothing is
+// copied or allocated. The constructor checks the whole text once; get()
+// then walks the members of the object for the one asked for. That is a
+// few members for a request, so there is no index of them.
+//
+//   JsonReader request(body, length);
+//   int32_t mode;
+//   if (request.valid() && request.get("mode").toInt(0, 9, mode))
+//     ...
+//
+// Does not depend on Arduino.
+//
+class JsonReader
+{
+public:
+  JsonReader(const char *text, size_t length);
+
+  // Whether the text is one well formed object.
+  bool valid() const { return _object != nullptr; }
+
+  // The member `key` of the object, of type None if it has none (or if the
+  // text is not valid).
+  JsonValue get(const char *key) const;
+
+private:
+  // The '{' of the object.
+  const char *_object = nullptr;
+  const char *_end;
+};
@@ -3,31 +3,125 @@
 #include "LDRReader.h"
 #include "logging.h"
 
-LDRReader::LDRReader(int pinNumber, float reactionSpeed, int sensitivity)
-    : _pin(pinNumber), _reactionSpeed(reactionSpeed), sensitivity(sensitivity)
+namespace
 {
-  DCHECK(reactionSpeed <= 1.0, "Too much");
-  DCHECK(reactionSpeed > 0, "Not enough");
+  template <typename T>
+  void swapIfGreater(T &a, T &b)
+  {
+    if (a > b)
+    {
+      T t = a;
+      a = b;
+      b = t;
+    }
+  }
+
+  // Median of a small array, by insertion sort.
+  uint16_t median(uint16_t *values, int count)
+  {
+    for (int i = 1; i < count; i++)
+    {
+      for (int j = i; j > 0; j--)
+        swapIfGreater(values[j - 1], values[j]);
+    }
+    return values[count / 2];
+  }
+} // namespace
+
+LDRReader::LDRReader(int pinNumber, float timeConstant, int sensitivity)
+    : _pin(pinNumber), _value(0)
+{
+  setSensitivity(sensitivity);
+
+  DCHECK(timeConstant > 0, "Not enough");
+
+  // Discrete first order low-pass: alpha = 1 - e^(-T/tau), T the sample period
+  const float alpha = 1.0f - expf(-1.0f / (LDR_SAMPLE_RATE_HZ * timeConstant));
+  _alpha = static_cast<uint32_t>(alpha * 65536.0f + 0.5f);
+  if (_alpha == 0)
+    _alpha = 1;
+}
+
+LDRReader::~LDRReader()
+{
+  if (_timer != nullptr)
+  {
+    esp_timer_stop(_timer);
+    esp_timer_delete(_timer);
+  }
 }
 
 void LDRReader::setup()
 {
   pinMode(_pin, INPUT);
-  _currentLDR = analogRead(_pin); // Initial value.
-  Serial.printf("LDRReader::setup() reading from pin:%d, value:%f\n", _pin, _currentLDR);
+
+  // Initial value.
+  uint16_t initial = readSample();
+  _filtered = static_cast<uint32_t>(initial) << 16;
+  _value.store(initial, std::memory_order_relaxed);
+  Serial.printf("LDRReader::setup() reading from pin:%d, value:%u\n", _pin, initial);
+
+  esp_timer_create_args_t args = {};
+  args.callback = &LDRReader::sampleCallback;
+  args.arg = this;
+  args.dispatch_method = ESP_TIMER_TASK;
+  args.name = "ldr";
+  if (esp_timer_create(&args, &_timer) != ESP_OK ||
+      esp_timer_start_periodic(_timer, 1000000ULL / LDR_SAMPLE_RATE_HZ) != ESP_OK)
+  {
+    Serial.printf("LDRReader::setup() could not start the sampling timer\n");
+  }
 }
 
-void LDRReader::loop()
+// static
+void LDRReader::sampleCallback(void *arg)
 {
-  _currentLDR = analogRead(_pin) * _reactionSpeed +
-                _currentLDR * (1 - _reactionSpeed);
-//  Serial.printf("LDRReader::loop() value:%f\n", _currentLDR);
+  static_cast<LDRReader *>(arg)->sample();
+}
 
-  DCHECK(_currentLDR <= 4095.0, _currentLDR);
-  DCHECK(_currentLDR >= 0.0, _currentLDR);
+uint16_t LDRReader::readSample()
+{
+  uint32_t sum = 0;
+  for (int i = 0; i < LDR_OVERSAMPLING; i++)
+  {
+    uint16_t reads[LDR_MEDIAN_OF];
+    for (int j = 0; j < LDR_MEDIAN_OF; j++)
+      reads[j] = analogRead(_pin);
+    sum += median(reads, LDR_MEDIAN_OF);
+  }
+  return (sum + LDR_OVERSAMPLING / 2) / LDR_OVERSAMPLING;
 }
 
-float LDRReader::reading()
+void LDRReader::sample()
 {
-  return min(pow(_currentLDR / 4095.0, 1 / (float)sensitivity), 1.0);
+  // take out the light of our own LEDs
+  uint16_t sample = readSample();
+  uint32_t own = static_cast<uint32_t>(_ledMilliamps.load(std::memory_order_relaxed)) *
+                 LDR_SELF_ILLUMINATION / 1000;
+  sample = sample > own ? sample - own : 0;
+
+  int64_t error = (static_cast<int64_t>(sample) << 16) - _filtered;
+  _filtered += (error * _alpha) >> 16;
+  //  Serial.printf("LDRReader::sample() value:%u\n", _filtered >> 16);
+
+  uint16_t value = (_filtered + 0x8000) >> 16;
+  DCHECK(value <= 4095, value);
+  _value.store(value, std::memory_order_relaxed);
+}
+
+void LDRReader::setSensitivity(int sensitivity)
+{
+  sensitivity = constrain(sensitivity, 0, LDR_MAX_SENSITIVITY);
+  if (sensitivity == _sensitivity)
+    return;
+  _sensitivity = sensitivity;
+
+  if (sensitivity == 0)
+  {
+    memset(_curve, 255, sizeof(_curve));
+    return;
+  }
+  const float exponent = 1.0f / sensitivity;
+  for (int value = 0; value < 4096; value++)
+    _curve[value] = static_cast<uint8_t>(powf(value / 4095.0f, exponent) * 255.0f + 0.5f);
 }
@@ -1,28 +1,96 @@
 #pragma once
 
+#include <atomic>
+#include <stdint.h>
+
+#include <esp_timer.h>
+
+// Samples per second taken by the light sensor timer.
+#define LDR_SAMPLE_RATE_HZ 20
+// Each sample is the average of LDR_OVERSAMPLING medians of
+// LDR_MEDIAN_OF ADC reads. The median drops single spikes (e.g. from WiFi
+// bursts), the average lowers the ADC noise.
+#define LDR_OVERSAMPLING 4
+#define LDR_MEDIAN_OF 3
+
+// Light the sensor sees from the clock's own LEDs, in ADC counts per A of
+// LED current. To measure it, light all LEDs in a dark room and divide the
+// value by the current shown on the status page.
+#ifndef LDR_SELF_ILLUMINATION
+#define LDR_SELF_ILLUMINATION 150
+#endif
+
+// Sensitivity levels, as set in the web page.
+#define LDR_MAX_SENSITIVITY 10
+
 /*
  * Light sensor. Reads the ambient light and build a representative value
- * between 0.0 and 1.0. Smooth the reading by doing a moving average.
+ * between 0 and 255.
+ *
+ * The sensor is sampled from a timer at LDR_SAMPLE_RATE_HZ, whatever the rate
+ * of the main loop, and the samples are smoothed by a first order low-pass
+ * filter with a time constant in seconds. The timer task publishes the
+ * filtered value through an atomic, so reading it never blocks or tears.
+ *
+ * The LEDs next to the sensor light it too, and a brighter reading would make
+ * the LEDs brighter still. The display passes the LED current of each frame
+ * it sends, and the light it adds is subtracted from every sample.
+ *
+ * The response to the light depends on the sensitivity: reading() is
+ * (value / 4095) ^ (1 / sensitivity). The curve of the current sensitivity is
+ * kept in a table with an entry per ADC value, built when it changes.
  */
 class LDRReader
 {
 public:
-  // Reaction speed must be greater than 0 and at most 1.0. This controls the
-  // input smoothing, the higher the number the less smooth the data will be.
-  // The pin number points to the pin the data line is soldered on.
-  LDRReader(int pinNumber = 33, float reactionSpeed = .1, int sensitivity = 1);
+  // The time constant is how long [s] the reading takes to get ~63% of the
+  // way to a new light level. The pin number points to the pin the data line
+  // is soldered on.
+  LDRReader(int pinNumber = 33, float timeConstant = 1.0f, int sensitivity = 1);
+  ~LDRReader();
 
-  // Must be called from the ino setup and loop.
+  // Must be called from the ino setup. Starts the sampling timer.
   void setup();
-  void loop();
 
-  // Returns a value between 0. (no light) and 1. (much lights)
-  float reading();
+  // Returns a value between 0 (no light) and 255 (much lights).
+  uint8_t reading() const { return response(value()); }
+  // The same for any ADC value, 0 to 4095.
+  uint8_t response(uint16_t value) const { return _curve[value]; }
+
+  // The filtered ADC value, 0 to 4095.
+  uint16_t value() const { return _value.load(std::memory_order_relaxed); }
+
+  // Sensitivity, 0 to LDR_MAX_SENSITIVITY. 0 reads as much light whatever
+  // the sensor says, higher levels respond more to low light.
+  void setSensitivity(int sensitivity);
+  int sensitivity() const { return _sensitivity; }
 
-  int sensitivity;
+  // Current [mA] through the LEDs of the frame being shown.
+  void setLedCurrent(uint16_t milliamps) { _ledMilliamps.store(milliamps, std::memory_order_relaxed); }
 
 private:
-  float _currentLDR;
-  float _reactionSpeed;
+  static void sampleCallback(void *arg);
+
+  // One sample, oversampled and median filtered.
+  uint16_t readSample();
+  void sample();
+
   int _pin;
+  int _sensitivity = -1;
+
+  // Response curve of _sensitivity, indexed by ADC value, 255 == 1.0.
+  uint8_t _curve[4096];
+
+  // Filter coefficient for the sample rate and time constant, 16.16 fixed
+  // point, and the filter state (ADC value, 16.16 fixed point). Only touched
+  // by the timer task after setup().
+  uint32_t _alpha;
+  uint32_t _filtered = 0;
+
+  // Filtered value, written by the timer task.
+  std::atomic<uint16_t> _value;
+  // LED current, read by the timer task.
+  std::atomic<uint16_t> _ledMilliamps{0};
+
+  esp_timer_handle_t _timer = nullptr;
 };
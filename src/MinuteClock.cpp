@@ -0,0 +1,64 @@
+#include "MinuteClock.h"
+
+#define US_PER_S 1000000LL
+#define S_PER_DAY 86400
+
+// Wall clock values before this (2020-01-01) mean the time is not set yet.
+#define MIN_VALID_UTC 1577836800LL
+
+namespace
+{
+  int64_t floorDiv(int64_t a, int64_t b)
+  {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+  }
+} // namespace
+
+bool MinuteClock::sync(int64_t nowUs, int64_t wallUs, int64_t leadUs)
+{
+  if (wallUs < MIN_VALID_UTC * US_PER_S)
+    return false;
+
+  _wallOffsetUs = wallUs - nowUs;
+  _boundaryUtc = (floorDiv(wallUs + leadUs, 60 * US_PER_S) + 1) * 60;
+  _boundaryUs = _boundaryUtc * US_PER_S - _wallOffsetUs;
+
+  // the time zone is only looked at again when the offset may have changed
+  if (_boundaryUtc < _offsetFrom || _boundaryUtc >= _offsetUntil)
+    _updateOffset(_boundaryUtc);
+
+  _set = true;
+  return true;
+}
+
+MinuteClock::LocalTime MinuteClock::localTime(int64_t nowUs) const
+{
+  return _split(floorDiv(nowUs + _wallOffsetUs, US_PER_S) + _utcOffset);
+}
+
+bool MinuteClock::setTimeZone(const char *rule)
+{
+  if (!_zone.parse(rule))
+    return false;
+  // the offset is looked up again on the next sync()
+  _offsetFrom = _offsetUntil = 0;
+  return true;
+}
+
+void MinuteClock::_updateOffset(int64_t utc)
+{
+  _utcOffset = _zone.offsetAt(utc);
+  _offsetFrom = utc;
+  _offsetUntil = _zone.nextTransition(utc);
+}
+
+// static
+MinuteClock::LocalTime MinuteClock::_split(int64_t local)
+{
+  int64_t seconds = local - floorDiv(local, S_PER_DAY) * S_PER_DAY;
+  LocalTime time;
+  time.hour = seconds / 3600;
+  time.minute = seconds / 60 % 60;
+  time.second = seconds % 60;
+  return time;
+}
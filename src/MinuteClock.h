@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "PosixTimeZone.h"
+
+// Time [ms] before a minute boundary the next minute is rendered.
+#define MINUTE_LEAD_MS 50
+// Duration [ms] of the fade between two clock states.
+#define TIME_CHANGE_ANIMATION_SPEED 3000
+
+//
+// Plans minute boundaries against the monotonic clock, so the real time clock
+// does not read and convert the time every frame.
+//
+// sync() maps the monotonic clock (esp_timer_get_time()) to UTC. The UTC
+// offset, and when it changes next (a DST transition), come from the time
+// zone rule (see PosixTimeZone), so the local time of every minute is an
+// addition, and whether a boundary is due is a compare against the monotonic
+// clock.
+//
+// The wall clock is passed in, to sync again at every boundary and follow NTP
+// corrections. That costs no time zone conversion.
+//
+class MinuteClock
+{
+public:
+  struct LocalTime
+  {
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+  };
+
+  // Maps monotonic time `nowUs` to UTC `wallUs` [us since the epoch], and
+  // plans the first minute boundary more than `leadUs` after it. Returns
+  // false if the wall clock is not set yet.
+  bool sync(int64_t nowUs, int64_t wallUs, int64_t leadUs = 0);
+
+  bool isSet() const { return _set; }
+  // Forgets the time. The next sync() starts over.
+  void reset() { _set = false; }
+
+  // Selects the time zone of a POSIX TZ rule, see PosixTimeZone. Returns
+  // false if the rule is not valid. The default is UTC.
+  bool setTimeZone(const char *rule);
+
+  // Local time at `nowUs`, which must be before nextBoundary(). Uses the UTC
+  // offset of the next boundary.
+  LocalTime localTime(int64_t nowUs) const;
+
+  // Monotonic time [us] of the next minute boundary, and the local time it
+  // starts.
+  int64_t nextBoundary() const { return _boundaryUs; }
+  LocalTime nextTime() const { return _split(_boundaryUtc + _utcOffset); }
+
+  // Offset [s] of local time from UTC, and the UTC time it next changes.
+  int32_t utcOffset() const { return _utcOffset; }
+  int64_t nextTransition() const { return _offsetUntil; }
+
+private:
+  // Works out the UTC offset at `utc`, and the UTC times it holds from and
+  // until.
+  void _updateOffset(int64_t utc);
+
+  static LocalTime _split(int64_t local);
+
+  bool _set = false;
+  PosixTimeZone _zone;
+
+  // Wall clock minus monotonic clock [us].
+  int64_t _wallOffsetUs = 0;
+
+  // The next boundary, in UTC and in monotonic time.
+  int64_t _boundaryUtc = 0;
+  int64_t _boundaryUs = 0;
+
+  // UTC offset [s], valid from _offsetFrom until _offsetUntil (UTC).
+  int32_t _utcOffset = 0;
+  int64_t _offsetFrom = 0;
+  int64_t _offsetUntil = 0;
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mode_registry
+{
+  constexpr size_t length(const char *text)
+  {
+    size_t n = 0;
+    while (text[n] != '\0')
+      n++;
+    return n;
+  }
+
+  template <size_t N>
+  struct FixedString
+  {
+    char data[N + 1] = {};
+  };
+
+  // data-options='<label>|<label>|...' for the labels of TModes, built by
+  // the compiler.
+  template <typename... TModes>
+  constexpr auto buildOptions()
+  {
+    constexpr const char *labels[] = {TModes::label...};
+    constexpr const char prefix[] = "data-options='";
+    constexpr size_t size = length(prefix) + (length(TModes::label) + ...) +
+                            sizeof...(TModes) - 1 + 1;
+
+    FixedString<size> options;
+    size_t n = 0;
+    for (size_t i = 0; i < length(prefix); i++)
+      options.data[n++] = prefix[i];
+    for (size_t mode = 0; mode < sizeof...(TModes); mode++)
+    {
+      if (mode > 0)
+        options.data[n++] = '|';
+      for (size_t i = 0; labels[mode][i] != '\0'; i++)
+        options.data[n++] = labels[mode][i];
+    }
+    options.data[n] = '\'';
+    return options;
+  }
+
+  template <typename TMode, typename TFirst, typename... TRest>
+  constexpr uint8_t indexOf()
+  {
+    if constexpr (std::is_same<TMode, TFirst>::value)
+      return 0;
+    else
+      return 1 + indexOf<TMode, TRest...>();
+  }
+} // namespace mode_registry
+
+//
+// A set of modes fixed at compile time, of which one is active.
+//
+// A mode is a type with its own state and
+//   static constexpr char label[];  // its option in the web page, see options()
+//   template <typename TContext> void enter(TContext &context);
+//   template <typename TContext> void tick(TContext &context);
+//   template <typename TContext> void exit(TContext &context);
+// enter() is called when the mode becomes active, tick() every frame while it
+// is, and exit() when another mode takes over.
+//
+// All modes live in a tuple and are numbered in the order of TModes. Calls go
+// to the active mode through a chain of compares the compiler can inline: no
+// virtual calls, and nothing is allocated.
+//
+template <typename... TModes>
+class ModeRegistry
+{
+public:
+  static constexpr uint8_t Count = sizeof...(TModes);
+  // Largest mode id.
+  static constexpr uint8_t MaxValue = Count - 1;
+
+  // The id of TMode.
+  template <typename TMode>
+  static constexpr uint8_t idOf() { return mode_registry::indexOf<TMode, TModes...>(); }
+
+  // data-options attribute listing the modes, in id order.
+  static const char *options() { return Options.data; }
+
+  // Label of mode `id`, nullptr if there is none.
+  static const char *label(uint8_t id) { return id < Count ? Labels[id] : nullptr; }
+
+  template <typename TMode>
+  TMode &get() { return std::get<TMode>(_modes); }
+
+  // The mode that will be active from the next tick().
+  uint8_t selected() const { return _selected; }
+
+  // Selects mode `id`. The switch happens on the next tick(), so that exit()
+  // and enter() run in the frame loop. Out of range ids are ignored.
+  void select(uint8_t id)
+  {
+    if (id < Count)
+      _selected = id;
+  }
+
+  // Runs one frame of the active mode, switching modes first if needed.
+  template <typename TContext>
+  void tick(TContext &context)
+  {
+    if (_selected != _active)
+    {
+      if (_active < Count)
+        dispatch(_active, [&](auto &mode) { mode.exit(context); });
+      _active = _selected;
+      dispatch(_active, [&](auto &mode) { mode.enter(context); });
+    }
+    dispatch(_active, [&](auto &mode) { mode.tick(context); });
+  }
+
+private:
+  static constexpr auto Options = mode_registry::buildOptions<TModes...>();
+  static constexpr const char *Labels[] = {TModes::label...};
+
+  template <typename TFunction>
+  void dispatch(uint8_t id, TFunction function)
+  {
+    dispatch(id, function, std::index_sequence_for<TModes...>());
+  }
+
+  template <typename TFunction, size_t... Ids>
+  void dispatch(uint8_t id, TFunction function, std::index_sequence<Ids...>)
+  {
+    ((id == Ids && (function(std::get<Ids>(_modes)), true)) || ...);
+  }
+
+  std::tuple<TModes...> _modes;
+
+  // Count until the first tick() enters the selected mode.
+  uint8_t _active = Count;
+  uint8_t _selected = 0;
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <initializer_list>
+
+#include "OutputChannels.h"
+
+//
+// Where the display sends its frames.
+//
+// The backend is double buffered: the display draws into its frame with
+// setPixel(), and beginCommit() hands a copy of it to the strip and returns
+// without waiting for it to be clocked out. The next frame can be drawn while
+// the previous one is on the wire; only committing it has to wait until
+// isBusy() is false.
+//
+template <typename TColorObject>
+class OutputBackend
+{
+public:
+  explicit OutputBackend(uint16_t pixelCount)
+      : _pixelCount(pixelCount), _frame(new TColorObject[pixelCount])
+  {
+    for (uint16_t i = 0; i < pixelCount; i++)
+      _frame[i] = TColorObject(0);
+  }
+
+  virtual ~OutputBackend() { delete[] _frame; }
+
+  virtual void begin() = 0;
+
+  // True while the previous frame is still being sent.
+  virtual bool isBusy() const = 0;
+
+  // Starts sending the frame. Returns false, without waiting, when the
+  // previous frame is still being sent; the frame is kept and can be
+  // committed by a later call.
+  bool beginCommit()
+  {
+    if (isBusy())
+      return false;
+    transmit(_frame);
+    return true;
+  }
+
+  // The frame being drawn, not the one being sent.
+  void setPixel(uint16_t index, const TColorObject &color) { _frame[index] = color; }
+  const TColorObject &getPixel(uint16_t index) const { return _frame[index]; }
+
+  uint16_t pixelCount() const { return _pixelCount; }
+
+protected:
+  // Copies `frame` to the strip and starts sending it. Only called when not
+  // busy; `frame` changes again as soon as this returns.
+  virtual void transmit(const TColorObject *frame) = 0;
+
+private:
+  const uint16_t _pixelCount;
+  TColorObject *_frame;
+};
+
+//
+// Backend for NeoPixelBus strips (see ParallelOutput): the bus buffer holds
+// the frame being sent. With the asynchronous ESP32 methods Show() returns as
+// soon as the data is handed to the peripheral, and CanShow() tells when it is
+// done. With FakeChannel as TChannel this is the host fake, which simulates
+// the wire time.
+//
+template <typename TColorFeature, typename TChannel, uint8_t TChannelCount = 1>
+class ChannelBackend : public OutputBackend<typename TColorFeature::ColorObject>
+{
+public:
+  typedef typename TColorFeature::ColorObject ColorObject;
+  typedef ParallelOutput<TColorFeature, TChannel, TChannelCount> Output;
+
+  ChannelBackend(uint16_t pixelCount, std::initializer_list<uint8_t> pins)
+      : OutputBackend<ColorObject>(pixelCount), _output(pixelCount, pins) {}
+
+  virtual void begin() { _output.Begin(); }
+  virtual bool isBusy() const { return !_output.CanShow(); }
+
+  Output &output() { return _output; }
+
+protected:
+  virtual void transmit(const ColorObject *frame)
+  {
+    for (uint16_t i = 0; i < this->pixelCount(); i++)
+      _output.SetPixelColor(i, frame[i]);
+    _output.Show();
+  }
+
+private:
+  Output _output;
+};
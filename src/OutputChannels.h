@@ -0,0 +1,100 @@
+#pragma once
+
+#include <initializer_list>
+
+#include <NeoPixelBus.h>
+
+#include "logging.h"
+
+//
+// Drives the LEDs of one frame over TChannelCount strips at the same time.
+//
+// On the wire a pixel takes 30us (40us for RGBW), so one strip caps the frame
+// rate of a large word wall: a 32x16 matrix alone is over 15ms per frame.
+// Split over channels the frame time is that of the longest channel: the
+// ESP32 RMT and I2S methods hand the data to the peripheral and return, and
+// the parallel I2S methods (e.g. NeoEsp32I2s1X8Ws2812xMethod) clock all their
+// channels out together once every channel has been shown.
+//
+// The strip is cut in consecutive runs of pixels: channel i drives pixels
+// i * pixelsPerChannel() onwards. TChannel is a NeoPixelBus, or anything with
+// the same interface that is constructed from a pixel count and a pin (see
+// FakeChannel).
+//
+template <typename TColorFeature, typename TChannel, uint8_t TChannelCount>
+class ParallelOutput
+{
+public:
+  typedef typename TColorFeature::ColorObject ColorObject;
+  typedef TChannel Channel;
+
+  static const uint8_t ChannelCount = TChannelCount;
+
+  // `pins` holds the data pin of every channel, in strip order.
+  ParallelOutput(uint16_t pixelCount, std::initializer_list<uint8_t> pins)
+      : _pixelCount(pixelCount),
+        _pixelsPerChannel((pixelCount + TChannelCount - 1) / TChannelCount)
+  {
+    DCHECK(pins.size() >= TChannelCount, pins.size());
+    const uint8_t *pin = pins.begin();
+    for (uint8_t channel = 0; channel < TChannelCount; channel++)
+    {
+      uint16_t first = channel * _pixelsPerChannel;
+      uint16_t count = first < pixelCount ? pixelCount - first : 0;
+      if (count > _pixelsPerChannel)
+        count = _pixelsPerChannel;
+      _channels[channel] = new TChannel(count, pin[channel < pins.size() ? channel : pins.size() - 1]);
+    }
+  }
+
+  ~ParallelOutput()
+  {
+    for (uint8_t channel = 0; channel < TChannelCount; channel++)
+      delete _channels[channel];
+  }
+
+  void Begin()
+  {
+    for (uint8_t channel = 0; channel < TChannelCount; channel++)
+      _channels[channel]->Begin();
+  }
+
+  // Starts sending the frame on every channel.
+  void Show()
+  {
+    for (uint8_t channel = 0; channel < TChannelCount; channel++)
+      _channels[channel]->Show();
+  }
+
+  // True when no channel is still sending the previous frame.
+  bool CanShow() const
+  {
+    for (uint8_t channel = 0; channel < TChannelCount; channel++)
+    {
+      if (!_channels[channel]->CanShow())
+        return false;
+    }
+    return true;
+  }
+
+  void SetPixelColor(uint16_t index, const ColorObject &color)
+  {
+    _channels[index / _pixelsPerChannel]->SetPixelColor(index % _pixelsPerChannel, color);
+  }
+
+  ColorObject GetPixelColor(uint16_t index) const
+  {
+    return _channels[index / _pixelsPerChannel]->GetPixelColor(index % _pixelsPerChannel);
+  }
+
+  uint16_t PixelCount() const { return _pixelCount; }
+  uint16_t pixelsPerChannel() const { return _pixelsPerChannel; }
+
+  TChannel &channel(uint8_t channel) { return *_channels[channel]; }
+
+private:
+  const uint16_t _pixelCount;
+  const uint16_t _pixelsPerChannel;
+
+  TChannel *_channels[TChannelCount];
+};
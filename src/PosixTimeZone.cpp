@@ -0,0 +1,305 @@
+#include "PosixTimeZone.h"
+
+#define S_PER_DAY 86400
+#define S_PER_HOUR 3600
+
+namespace
+{
+  bool isDigit(char c) { return c >= '0' && c <= '9'; }
+  bool isAlpha(char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+
+  bool parseNumber(const char *&p, int32_t &value, int32_t max)
+  {
+    if (!isDigit(*p))
+      return false;
+    value = 0;
+    while (isDigit(*p))
+    {
+      value = value * 10 + (*p++ - '0');
+      if (value > max)
+        return false;
+    }
+    return true;
+  }
+
+  bool isLeapYear(int64_t year)
+  {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  }
+
+  unsigned daysInMonth(int64_t year, unsigned month)
+  {
+    static const uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+  }
+
+  int64_t floorDiv(int64_t a, int64_t b)
+  {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+  }
+} // namespace
+
+PosixTimeZone::PosixTimeZone()
+{
+  _lookUp(0);
+}
+
+// static
+int64_t PosixTimeZone::daysFromCivil(int64_t year, unsigned month, unsigned day)
+{
+  year -= month <= 2;
+  const int64_t era = floorDiv(year, 400);
+  const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+  const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+}
+
+// static
+void PosixTimeZone::civilFromDays(int64_t days, int64_t &year, unsigned &month, unsigned &day)
+{
+  days += 719468;
+  const int64_t era = floorDiv(days, 146097);
+  const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+  const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const unsigned monthIndex = (5 * dayOfYear + 2) / 153; // 0 is March
+  day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+  month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+  year = yearOfEra + era * 400 + (month <= 2);
+}
+
+// static
+int64_t PosixTimeZone::yearOfDay(int64_t days)
+{
+  int64_t year;
+  unsigned month, day;
+  civilFromDays(days, year, month, day);
+  return year;
+}
+
+// static
+bool PosixTimeZone::_parseName(const char *&p)
+{
+  const char *start = p;
+  if (*p == '<')
+  {
+    while (*p != '\0' && *p != '>')
+      p++;
+    if (*p != '>')
+      return false;
+    p++;
+    return p - start > 2;
+  }
+  while (isAlpha(*p))
+    p++;
+  return p - start >= 3;
+}
+
+// [+|-]hh[:mm[:ss]], hours up to 167 as in the tz database extensions.
+// static
+bool PosixTimeZone::_parseTime(const char *&p, int32_t &seconds)
+{
+  int32_t sign = 1;
+  if (*p == '+' || *p == '-')
+    sign = *p++ == '-' ? -1 : 1;
+
+  int32_t hours, minutes = 0, secs = 0;
+  if (!parseNumber(p, hours, 167))
+    return false;
+  if (*p == ':')
+  {
+    p++;
+    if (!parseNumber(p, minutes, 59))
+      return false;
+    if (*p == ':')
+    {
+      p++;
+      if (!parseNumber(p, secs, 59))
+        return false;
+    }
+  }
+  seconds = sign * (hours * S_PER_HOUR + minutes * 60 + secs);
+  return true;
+}
+
+// static
+bool PosixTimeZone::_parseDate(const char *&p, Date &date)
+{
+  int32_t value;
+  if (*p == 'M')
+  {
+    p++;
+    int32_t week, weekDay;
+    if (!parseNumber(p, value, 12) || value < 1 || *p++ != '.' ||
+        !parseNumber(p, week, 5) || week < 1 || *p++ != '.' ||
+        !parseNumber(p, weekDay, 6))
+      return false;
+    date.kind = Date::MONTH_WEEK_DAY;
+    date.month = value;
+    date.week = week;
+    date.weekDay = weekDay;
+  }
+  else if (*p == 'J')
+  {
+    p++;
+    if (!parseNumber(p, value, 365) || value < 1)
+      return false;
+    date.kind = Date::JULIAN;
+    date.day = value;
+  }
+  else
+  {
+    if (!parseNumber(p, value, 365))
+      return false;
+    date.kind = Date::DAY_OF_YEAR;
+    date.day = value;
+  }
+
+  date.time = 2 * S_PER_HOUR;
+  if (*p == '/')
+  {
+    p++;
+    return _parseTime(p, date.time);
+  }
+  return true;
+}
+
+bool PosixTimeZone::parse(const char *rule)
+{
+  const char *p = rule;
+  int32_t stdOffset, dstOffset;
+  Date dstStart, dstEnd;
+
+  // POSIX offsets are west of UTC, ours are east
+  if (!_parseName(p) || !_parseTime(p, stdOffset))
+    return false;
+  stdOffset = -stdOffset;
+
+  bool hasDst = *p != '\0';
+  if (hasDst)
+  {
+    if (!_parseName(p))
+      return false;
+    dstOffset = stdOffset + S_PER_HOUR;
+    if (*p != ',' && *p != '\0')
+    {
+      if (!_parseTime(p, dstOffset))
+        return false;
+      dstOffset = -dstOffset;
+    }
+    if (*p == '\0')
+    {
+      // no rules: the C library falls back to the US rules, M3.2.0,M11.1.0
+      dstStart = {Date::MONTH_WEEK_DAY, 3, 2, 0, 0, 2 * S_PER_HOUR};
+      dstEnd = {Date::MONTH_WEEK_DAY, 11, 1, 0, 0, 2 * S_PER_HOUR};
+    }
+    else if (*p++ != ',' || !_parseDate(p, dstStart) || *p++ != ',' ||
+             !_parseDate(p, dstEnd) || *p != '\0')
+    {
+      return false;
+    }
+  }
+  else
+  {
+    dstOffset = stdOffset;
+  }
+
+  _stdOffset = stdOffset;
+  _dstOffset = dstOffset;
+  _hasDst = hasDst;
+  _dstStart = dstStart;
+  _dstEnd = dstEnd;
+  _tableCount = 0;
+  _tableFrom = _tableUntil = 0;
+  _from = _until = 0;
+  return true;
+}
+
+// static
+int64_t PosixTimeZone::_instant(const Date &date, int64_t year, int32_t offsetBefore)
+{
+  int64_t day;
+  switch (date.kind)
+  {
+  case Date::MONTH_WEEK_DAY:
+  {
+    int64_t first = daysFromCivil(year, date.month, 1);
+    // 1970-01-01 was a Thursday
+    int weekDayOfFirst = static_cast<int>(first + 4 - floorDiv(first + 4, 7) * 7);
+    int dayOfMonth = 1 + (date.weekDay - weekDayOfFirst + 7) % 7 + (date.week - 1) * 7;
+    while (dayOfMonth > static_cast<int>(daysInMonth(year, date.month)))
+      dayOfMonth -= 7;
+    day = first + dayOfMonth - 1;
+    break;
+  }
+  case Date::JULIAN:
+    day = daysFromCivil(year, 1, 1) + date.day - 1 +
+          (isLeapYear(year) && date.day >= 60 ? 1 : 0);
+    break;
+  default:
+    day = daysFromCivil(year, 1, 1) + date.day;
+    break;
+  }
+  return day * S_PER_DAY + date.time - offsetBefore;
+}
+
+void PosixTimeZone::_fillTable(int64_t utc)
+{
+  const int64_t year = yearOfDay(floorDiv(utc, S_PER_DAY));
+  _tableFrom = daysFromCivil(year, 1, 1) * S_PER_DAY;
+  _tableUntil = daysFromCivil(year + TZ_TABLE_YEARS, 1, 1) * S_PER_DAY;
+
+  // a year on either side, for rules near the turn of the year
+  _tableCount = 0;
+  for (int64_t y = year - 1; y <= year + TZ_TABLE_YEARS; y++)
+  {
+    _table[_tableCount++] = {_instant(_dstStart, y, _stdOffset), _dstOffset};
+    _table[_tableCount++] = {_instant(_dstEnd, y, _dstOffset), _stdOffset};
+  }
+  // insertion sort, the table is nearly sorted already
+  for (uint8_t i = 1; i < _tableCount; i++)
+  {
+    for (uint8_t j = i; j > 0 && _table[j - 1].at > _table[j].at; j--)
+    {
+      Transition t = _table[j];
+      _table[j] = _table[j - 1];
+      _table[j - 1] = t;
+    }
+  }
+}
+
+void PosixTimeZone::_lookUp(int64_t utc)
+{
+  if (!_hasDst)
+  {
+    _offset = _stdOffset;
+    _from = INT64_MIN;
+    _until = NEVER;
+    return;
+  }
+
+  if (utc < _tableFrom || utc >= _tableUntil)
+    _fillTable(utc);
+
+  // the table starts a year before _tableFrom, so utc is past its first entry
+  uint8_t i = 0;
+  while (i + 1 < _tableCount && _table[i + 1].at <= utc)
+    i++;
+  _offset = _table[i].offset;
+  _from = _table[i].at;
+  _until = i + 1 < _tableCount ? _table[i + 1].at : _tableUntil;
+}
+
+int32_t PosixTimeZone::offsetAt(int64_t utc)
+{
+  if (utc < _from || utc >= _until)
+    _lookUp(utc);
+  return _offset;
+}
+
+int64_t PosixTimeZone::nextTransition(int64_t utc)
+{
+  offsetAt(utc);
+  return _until;
+}
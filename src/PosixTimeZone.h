@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+
+// Years of transitions worked out at a time.
+#define TZ_TABLE_YEARS 4
+
+//
+// A time zone given by a POSIX TZ rule, as in Timezones.h, e.g.
+// "CET-1CEST,M3.5.0,M10.5.0/3" or "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0".
+//
+// Supports the rule syntax of POSIX and its extensions used by the tz
+// database: quoted names, minutes and seconds in offsets, Mm.w.d, Jn and n
+// dates, and transition times outside 0..24 h. A zone with DST but no rules
+// uses the US rules, like the C library.
+//
+// The UTC times of the transitions are worked out for a few years at once,
+// when the zone is selected and when the time leaves the years worked out.
+// Between two transitions, UTC to local time is a comparison and an add (see
+// toLocal()). Time values are seconds since the epoch, 64 bit even where
+// time_t is 32 bit.
+//
+class PosixTimeZone
+{
+public:
+  static const int64_t NEVER = INT64_MAX;
+
+  // UTC.
+  PosixTimeZone();
+
+  // Selects the zone of a TZ rule. Returns false, and leaves the zone as it
+  // was, if the rule cannot be parsed.
+  bool parse(const char *rule);
+
+  bool hasDst() const { return _hasDst; }
+
+  // Offset [s] of local time from UTC (east positive) at `utc`.
+  int32_t offsetAt(int64_t utc);
+  // UTC time of the first offset change after `utc`, NEVER if there is none.
+  int64_t nextTransition(int64_t utc);
+
+  // Local time at `utc`.
+  int64_t toLocal(int64_t utc)
+  {
+    if (utc < _from || utc >= _until)
+      _lookUp(utc);
+    return utc + _offset;
+  }
+
+  // Days since 1970-01-01 of a date, the date of a day, and its year.
+  static int64_t daysFromCivil(int64_t year, unsigned month, unsigned day);
+  static void civilFromDays(int64_t days, int64_t &year, unsigned &month, unsigned &day);
+  static int64_t yearOfDay(int64_t days);
+
+private:
+  // Day of a transition in a year, as in the rule.
+  struct Date
+  {
+    enum Kind : uint8_t
+    {
+      MONTH_WEEK_DAY, // Mm.w.d
+      JULIAN,         // Jn, 1 to 365, February 29 not counted
+      DAY_OF_YEAR,    // n, 0 to 365
+    };
+    Kind kind;
+    uint8_t month;
+    uint8_t week;
+    uint8_t weekDay;
+    uint16_t day;
+    // Local time [s] of the transition on that day.
+    int32_t time;
+  };
+
+  struct Transition
+  {
+    int64_t at;
+    int32_t offset;
+  };
+
+  static bool _parseName(const char *&p);
+  static bool _parseTime(const char *&p, int32_t &seconds);
+  static bool _parseDate(const char *&p, Date &date);
+
+  // UTC time of `date` in `year`, where local time was `offsetBefore` [s]
+  // from UTC.
+  static int64_t _instant(const Date &date, int64_t year, int32_t offsetBefore);
+
+  // Works out the transitions around the year of `utc`.
+  void _fillTable(int64_t utc);
+  // Sets _offset, _from and _until for `utc`.
+  void _lookUp(int64_t utc);
+
+  int32_t _stdOffset = 0;
+  int32_t _dstOffset = 0;
+  bool _hasDst = false;
+  Date _dstStart;
+  Date _dstEnd;
+
+  // Transitions from a year before the years in [_tableFrom, _tableUntil) to
+  // a year after, in time order.
+  Transition _table[2 * (TZ_TABLE_YEARS + 2)];
+  uint8_t _tableCount = 0;
+  int64_t _tableFrom = 0;
+  int64_t _tableUntil = 0;
+
+  // Offset between the transitions at _from and _until.
+  int32_t _offset = 0;
+  int64_t _from = 0;
+  int64_t _until = 0;
+};
@@ -0,0 +1,79 @@
+#include <Arduino.h>
+
+#include "PowerBudget.h"
+
+#define MS_PER_DAY (24UL * 3600UL * 1000UL)
+#define MS_PER_HOUR 3600000.0f
+
+namespace
+{
+  uint32_t loadMilliamps(uint32_t load)
+  {
+    return load * LED_CHANNEL_MILLIAMPS / 255;
+  }
+} // namespace
+
+template <uint16_t TPixelCount>
+PowerBudgetT<TPixelCount>::PowerBudgetT()
+    : _totalLoad(0), _limit(LED_DEFAULT_LIMIT_MILLIAMPS), _lastAccumulateMs(0),
+      _dayStartMs(0), _energyToday(0), _energyYesterday(0)
+{
+  memset(_pixelLoad, 0, sizeof(_pixelLoad));
+}
+
+template <uint16_t TPixelCount>
+void PowerBudgetT<TPixelCount>::setPixelLoad(uint16_t index, uint16_t load)
+{
+  _totalLoad += load;
+  _totalLoad -= _pixelLoad[index];
+  _pixelLoad[index] = load;
+}
+
+template <uint16_t TPixelCount>
+uint8_t PowerBudgetT<TPixelCount>::scale() const
+{
+  uint32_t requested = requestedMilliamps();
+  if (_limit == 0 || requested <= _limit)
+    return 255;
+  if (_limit <= IDLE_MILLIAMPS)
+    return 0;
+  return (_limit - IDLE_MILLIAMPS) * 255 / loadMilliamps(_totalLoad);
+}
+
+template <uint16_t TPixelCount>
+uint32_t PowerBudgetT<TPixelCount>::requestedMilliamps() const
+{
+  return IDLE_MILLIAMPS + loadMilliamps(_totalLoad);
+}
+
+template <uint16_t TPixelCount>
+uint32_t PowerBudgetT<TPixelCount>::milliamps() const
+{
+  return IDLE_MILLIAMPS + lightMilliamps();
+}
+
+template <uint16_t TPixelCount>
+uint32_t PowerBudgetT<TPixelCount>::lightMilliamps() const
+{
+  return loadMilliamps(_totalLoad) * scale() / 255;
+}
+
+template <uint16_t TPixelCount>
+void PowerBudgetT<TPixelCount>::accumulate(unsigned long nowMs)
+{
+  unsigned long elapsed = nowMs - _lastAccumulateMs;
+  _lastAccumulateMs = nowMs;
+
+  float milliwatts = milliamps() * (LED_SUPPLY_MILLIVOLTS / 1000.0f);
+  _energyToday += milliwatts * elapsed / MS_PER_HOUR;
+
+  if (nowMs - _dayStartMs >= MS_PER_DAY)
+  {
+    _energyYesterday = _energyToday;
+    _energyToday = 0;
+    _dayStartMs += MS_PER_DAY;
+  }
+}
+
+#define INSTANTIATE_POWER_BUDGET(grid) template class PowerBudgetT<grid::PixelCount>;
+FOR_EACH_GRID(INSTANTIATE_POWER_BUDGET)
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <NeoPixelBus.h>
+
+#include "GridSize.h"
+
+// Supply voltage of the LED strip.
+#define LED_SUPPLY_MILLIVOLTS 5000
+// Current drawn by one LED channel at full brightness.
+#define LED_CHANNEL_MILLIAMPS 20
+// Current drawn by one LED with all channels off.
+#define LED_IDLE_MILLIAMPS 1
+// Default current limit for the LEDs.
+#define LED_DEFAULT_LIMIT_MILLIAMPS 2000
+
+//
+// Estimates the current the LEDs draw, limits it to a budget and keeps track
+// of the energy used.
+//
+// The estimate is updated per pixel as pixels change, so a frame where little
+// changes costs little. When the estimate goes over the limit, scale() tells
+// by how much the output has to be dimmed to stay within the budget.
+//
+template <uint16_t TPixelCount>
+class PowerBudgetT
+{
+public:
+  PowerBudgetT();
+
+  // Sets the load of pixel `index`: the sum of its channel levels (before
+  // limiting), 0 to 255 per channel.
+  void setPixelLoad(uint16_t index, uint16_t load);
+
+  // Sets the maximum current [mA] of the LEDs. 0 disables the limit.
+  void setLimit(uint16_t milliamps) { _limit = milliamps; }
+  uint16_t limit() const { return _limit; }
+
+  // Output scale (255 == not limited) that keeps the LEDs within the limit.
+  uint8_t scale() const;
+
+  // Estimated current [mA] of the pixels as set, and as actually shown.
+  uint32_t requestedMilliamps() const;
+  uint32_t milliamps() const;
+  // Current [mA] of the LED channels as shown, without the idle current: the
+  // part that makes light.
+  uint32_t lightMilliamps() const;
+
+  // Adds the energy used since the last call, at the current draw. Call it
+  // whenever the draw is about to change, and from time to time otherwise.
+  void accumulate(unsigned long nowMs);
+
+  // Energy [mWh] used in the current and previous 24 hour period of uptime.
+  float energyToday() const { return _energyToday; }
+  float energyYesterday() const { return _energyYesterday; }
+  // Uptime [ms] at the start of the current 24 hour period.
+  unsigned long dayStart() const { return _dayStartMs; }
+
+private:
+  // Current [mA] of all LEDs with every channel off.
+  static const uint32_t IDLE_MILLIAMPS = LED_IDLE_MILLIAMPS * TPixelCount;
+
+  // Sum of the channel levels per pixel and over all pixels.
+  uint16_t _pixelLoad[TPixelCount];
+  uint32_t _totalLoad;
+
+  uint16_t _limit;
+
+  unsigned long _lastAccumulateMs;
+  unsigned long _dayStartMs;
+  float _energyToday;
+  float _energyYesterday;
+};
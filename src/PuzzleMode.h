@@ -0,0 +1,142 @@
+#pragma once
+
+#include <Arduino.h>
+#include <NeoPixelBus.h>
+
+#include "AnimationTimeline.h"
+#include "ClockFace.h"
+#include "Sequence.h"
+
+//
+// Word puzzle: takes a word from the configuration portal or from Serial
+// input, tells the clock face to search for it on the board and, if found,
+// reveals its letters one by one. If not, the corners light up. The steps are
+// a Sequence.
+//
+template <typename TGrid>
+class PuzzleMode
+{
+public:
+  static constexpr char label[] = "ClockMode/Word Puzzle";
+
+  template <typename TDisplay>
+  void enter(TDisplay &display)
+  {
+    display.transition(PUZZLE_DURATION_F2B, true); // create animations to fade board to black
+    _sequence.restart(micros());
+  }
+
+  // Waits for a word, then fades to black, waits and reveals the letters one
+  // by one, each at its planned time.
+  template <typename TDisplay>
+  void tick(TDisplay &display)
+  {
+    SEQ_BEGIN(_sequence, micros());
+    for (;;) {
+      SEQ_WAIT_UNTIL(_sequence, _nextWord(display));
+
+      if (_found) {
+        display.transition(PUZZLE_DURATION_F2B, true);
+        SEQ_SLEEP_MS(_sequence, PUZZLE_DURATION_F2B + PUZZLE_DELAY_AFTER_F2B);
+        for (_letter = 0; _letter < _wordPixelsLen; _letter++) {
+          _reveal(display, _wordPixels[_letter], PUZZLE_DURATION_LETTER);
+          SEQ_SLEEP_MS(_sequence, PUZZLE_DURATION_LETTER);
+        }
+      }
+      else { // light up corner pixels to indicate NOT FOUND
+        display.transition(400, true); // first set all pixels to fade to black...
+        SEQ_SLEEP_MS(_sequence, 400);
+        for (_letter = 0; _letter < TGrid::Signals; _letter++) {
+          _reveal(display, _letter, 300); // ...then fade the corners in
+        }
+        SEQ_SLEEP_MS(_sequence, 300);
+      }
+    }
+    SEQ_END(_sequence);
+  }
+
+  template <typename TDisplay>
+  void exit(TDisplay &display) {}
+
+private:
+  static const uint16_t PUZZLE_DURATION_F2B = 400; // duration [ms] of fade2black animation
+  static const uint16_t PUZZLE_DURATION_LETTER = 700; // duration [ms] of letter fade-in animation
+  static const uint16_t PUZZLE_DELAY_AFTER_F2B = 2500; // delay [ms] after fade2black animation
+
+  // Takes the word to find, either from the configuration portal or from
+  // Serial input, and searches it on the board. Returns false if there is no
+  // word.
+  template <typename TDisplay>
+  bool _nextWord(TDisplay &display)
+  {
+    // the word from the webinterface takes precedence
+    String str = display.takeFindWord();
+    if (str.equals("") && Serial.available()) { // data incoming on the serial input
+      // NOTE on readString using Serial !!
+      // using VSCode's serial monitor imposes different behavior than when using the ArduinoIDEs serial monitor
+      // ArduinoIDE allows you to set linefeed(\r) and carriage return(\n) separately.
+      // When using ArduinoIDE serial monitor, set to "No line ending" for code below to work correclty
+      // The VSC monitor sends \r\n as part of the string to the code, which add 2 characters to the string
+      // We solve this by trimming the string.
+      str = Serial.readString(); // Serial.readString() or Serial.readStringUntil('\n');
+    }
+
+    str.trim();
+    str.toUpperCase();
+    if (str.length() == 0) {
+      return false;
+    }
+    Serial.printf("PuzzleMode::tick() str=(%s) len=%d\n", str.c_str(), str.length());
+
+    _found = display.clockFace().determineLetterSequence(str, _wordPixels, &_wordPixelsLen);
+    return true;
+  }
+
+  // Fades a pixel in to the current color in `animationSpeed` [ms], starting
+  // at the planned time of the current step.
+  template <typename TDisplay>
+  void _reveal(TDisplay &display, uint16_t pixel, int animationSpeed)
+  {
+    // update brightness according to lightsensor value
+    display.brightnessController().loop();
+    _targetColor = display.brightnessController().getCorrectedColor();
+
+    // Only two pointers are captured, so the callback fits in the
+    // std::function without allocating.
+    TDisplay *target = &display;
+    TimelineCallback blendAnimUpdate = [this, target](const TimelineParam &param) {
+      typename TDisplay::Layer &base = target->layer(TDisplay::Compositor::BASE);
+      if (param.state == TimelineState::Started) {
+        _startColor[param.index] = base.getPixel(param.index);
+      }
+
+      // this gets called for each animation on every time step
+      // progress will start at 0.0 and end at 1.0
+      // we use the blend function on the RgbColor to mix
+      // color based on the progress given to us in the animation
+      float progress = NeoEase::CubicOut(param.progress);
+      RgbColor updatedColor = RgbColor::LinearBlend(
+          _startColor[param.index], _targetColor, progress);
+
+      // apply the color to the pixel
+      base.setPixel(param.index, updatedColor);
+    };
+
+    display.animations(TDisplay::Compositor::BASE).startAt(pixel, _sequence.deadline(), animationSpeed * 1000UL, blendAnimUpdate);
+  }
+
+  Sequence _sequence;
+  // Whether the last word was found, and the letter (or corner) being revealed.
+  bool _found = false;
+  int _letter = 0;
+
+  // Color the letters fade in to.
+  RgbColor _targetColor;
+
+  // pixels of the word found (after search)
+  uint16_t _wordPixels[PUZZLE_MAX_SEQUENCE];
+  int _wordPixelsLen = 0;
+
+  // Color every pixel fades in from.
+  RgbColor _startColor[TGrid::PixelCount];
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+
+#include "MinuteClock.h"
+#include "RtcClock.h"
+
+//
+// Shows the current time.
+//
+// The time is not read every frame: a MinuteClock plans the next minute
+// boundary, and the next minute is rendered MINUTE_LEAD_MS before it, with
+// the fade starting right on the boundary.
+//
+class RealTimeMode
+{
+public:
+  static constexpr char label[] = "ClockMode/Real Clock";
+
+  template <typename TDisplay>
+  void enter(TDisplay &display)
+  {
+    // whatever the previous mode left on the clock, show the time again
+    display.clockFace().resetTime();
+    _clock.reset();
+    _retryUs = 0;
+    _fadeEndUs = 0;
+    _brightnessPending = false;
+  }
+
+  // Update the clock with realtime clock data, using updateWithTime()
+  template <typename TDisplay>
+  void tick(TDisplay &display)
+  {
+    int64_t nowUs = esp_timer_get_time();
+
+    if (!_clock.isSet())
+    {
+      // Until the RTC, NTP or the user sets the time, try again every second.
+      // This replaces getLocalTime(), which waits for the time to be set.
+      if (nowUs >= _retryUs)
+      {
+        _retryUs = nowUs + SYNC_RETRY_US;
+        _showNow(display, nowUs);
+      }
+    }
+    else if (nowUs >= _clock.nextBoundary())
+    {
+      // a frame took too long to render the minute ahead: show it late
+      _showNow(display, nowUs);
+    }
+    else if (nowUs >= _clock.nextBoundary() - MINUTE_LEAD_MS * 1000LL)
+    {
+      // render the next minute now, to start on the boundary
+      MinuteClock::LocalTime time = _clock.nextTime();
+      int64_t boundaryUs = _clock.nextBoundary();
+      if (display.updateWithTimeAt(static_cast<uint32_t>(boundaryUs),
+                                   time.hour, time.minute, time.second))
+        _fadeEndUs = boundaryUs + TIME_CHANGE_ANIMATION_SPEED * 1000LL;
+      // plan the boundary after it, following any change of the wall clock
+      _sync(display, nowUs, 2 * MINUTE_LEAD_MS * 1000LL);
+    }
+
+    // now check if the brightness has changed and if so,
+    // animate the change in brightness
+    display.brightnessController().loop();
+    if (display.brightnessController().hasChanged())
+      _brightnessPending = true;
+    // A transition stops the one before it: while the time fades in (or is
+    // rendered ahead of its boundary), the new brightness waits for the end
+    // of the fade rather than cutting it short.
+    if (_brightnessPending && nowUs >= _fadeEndUs)
+    {
+      _brightnessPending = false;
+      display.transition(300); // Update in 300 ms
+    }
+  }
+
+  template <typename TDisplay>
+  void exit(TDisplay &display) {}
+
+  // Selects the time zone of a POSIX TZ rule. The next tick() shows the time
+  // in it.
+  void setTimeZone(const char *rule)
+  {
+    if (!_clock.setTimeZone(rule))
+    {
+      Serial.printf("RealTimeMode::setTimeZone() invalid rule %s\n", rule);
+      return;
+    }
+    _clock.reset();
+    _retryUs = 0;
+  }
+
+private:
+  static const int64_t SYNC_RETRY_US = 1000000;
+
+  // Syncs the minute clock with UTC, from the best source there is: the
+  // disciplined time base once NTP synced it, else the RTC, else the system
+  // time (set by hand). None involves a time zone conversion.
+  template <typename TDisplay>
+  bool _sync(TDisplay &display, int64_t nowUs, int64_t leadUs)
+  {
+    if (display.timeBase().isSynced())
+      return _clock.sync(nowUs, display.timeBase().utc(nowUs), leadUs);
+
+    RtcClock *rtc = display.rtc();
+    if (rtc != nullptr && rtc->isValid())
+      return _clock.sync(nowUs, rtc->utc(nowUs), leadUs);
+
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    return _clock.sync(nowUs, now.tv_sec * 1000000LL + now.tv_usec, leadUs);
+  }
+
+  // Shows the time right away.
+  template <typename TDisplay>
+  void _showNow(TDisplay &display, int64_t nowUs)
+  {
+    if (_sync(display, nowUs, 0))
+    {
+      MinuteClock::LocalTime time = _clock.localTime(nowUs);
+      if (display.updateWithTime(time.hour, time.minute, time.second))
+        _fadeEndUs = nowUs + TIME_CHANGE_ANIMATION_SPEED * 1000LL;
+    }
+  }
+
+  MinuteClock _clock;
+  // Monotonic time [us] of the next attempt to read the time, until it is set.
+  int64_t _retryUs = 0;
+  // Monotonic time [us] the last fade of the time is over, and whether a
+  // change of brightness waits for it.
+  int64_t _fadeEndUs = 0;
+  bool _brightnessPending = false;
+};
@@ -0,0 +1,249 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "PosixTimeZone.h"
+#include "RtcClock.h"
+
+#define US_PER_S 1000000LL
+#define S_PER_DAY 86400
+
+// DS3231 registers: the time from seconds to year, the status, and the aging
+// offset. The oscillator stop flag in the status is set when the time is lost.
+#define REG_SECONDS 0x00
+#define REG_STATUS 0x0F
+#define REG_AGING 0x10
+#define STATUS_OSF 0x80
+#define TIME_REGISTERS 7
+
+// Times before this year mean the RTC was never set.
+#define MIN_VALID_YEAR 2020
+
+namespace
+{
+  uint8_t fromBcd(uint8_t value) { return (value >> 4) * 10 + (value & 0x0F); }
+  uint8_t toBcd(unsigned value) { return ((value / 10) << 4) | (value % 10); }
+
+  int64_t floorDiv(int64_t a, int64_t b)
+  {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+  }
+} // namespace
+
+bool RtcClock::begin(int64_t nowUs)
+{
+  uint8_t status;
+  _present = _bus.readRegisters(RTC_ADDRESS, REG_STATUS, &status, 1);
+  if (!_present)
+    return false;
+
+  uint8_t aging;
+  if (_bus.readRegisters(RTC_ADDRESS, REG_AGING, &aging, 1))
+    _aging = static_cast<int8_t>(aging);
+
+  int64_t utc;
+  _valid = !(status & STATUS_OSF) && _readTime(utc);
+  _timed = false;
+  _lastPollUs = -1;
+  _nextPollUs = nowUs;
+  if (!_valid)
+    return false;
+
+  // somewhere in the second: take the middle until a tick is timed
+  _edgeUs = nowUs - US_PER_S / 2;
+  _edgeUtc = utc;
+  return true;
+}
+
+void RtcClock::loop(int64_t nowUs)
+{
+  if (!_present)
+    return;
+  if (_writePending)
+  {
+    if (nowUs >= _writeAtUs)
+      _write(nowUs);
+    return;
+  }
+  if (_valid && nowUs >= _nextPollUs)
+    _poll(nowUs);
+}
+
+void RtcClock::_poll(int64_t nowUs)
+{
+  uint8_t seconds;
+  if (!_bus.readRegisters(RTC_ADDRESS, REG_SECONDS, &seconds, 1))
+  {
+    // try again a second later
+    _lastPollUs = -1;
+    _nextPollUs = nowUs + US_PER_S;
+    return;
+  }
+
+  if (_lastPollUs >= 0 && seconds != _lastSeconds)
+  {
+    // it ticked between the two reads
+    int64_t utc;
+    if (nowUs - _lastPollUs > RTC_MAX_POLL_GAP_US || !_readTime(utc))
+    {
+      // too long ago to tell when: time the next tick
+      _nextPollUs = _lastPollUs + US_PER_S - RTC_EDGE_WINDOW_US;
+      _lastPollUs = -1;
+      return;
+    }
+    _edgeUs = _lastPollUs + (nowUs - _lastPollUs) / 2;
+    _edgeUtc = utc;
+    _timed = true;
+    _lastPollUs = -1;
+    _nextPollUs = _edgeUs + RTC_EDGE_SECONDS * US_PER_S - RTC_EDGE_WINDOW_US;
+    if (_hasReference)
+      _compare();
+    return;
+  }
+
+  _lastSeconds = seconds;
+  _lastPollUs = nowUs;
+  _nextPollUs = nowUs + RTC_POLL_US;
+}
+
+void RtcClock::discipline(int64_t nowUs, int64_t utcUs)
+{
+  if (!_present || _writePending)
+    return;
+  if (!_valid)
+  {
+    set(nowUs, utcUs);
+    return;
+  }
+
+  _hasReference = true;
+  _referenceUs = nowUs;
+  _referenceUtcUs = utcUs;
+
+  // time the next tick, rather than the one planned
+  _lastPollUs = -1;
+  _nextPollUs = nowUs;
+  if (_timed)
+    _nextPollUs += (US_PER_S - (nowUs - _edgeUs) % US_PER_S) % US_PER_S - RTC_EDGE_WINDOW_US;
+}
+
+void RtcClock::_compare()
+{
+  _hasReference = false;
+  // within a second of the reference, the monotonic clock is good enough to
+  // carry it to the tick
+  const int64_t referenceUs = _referenceUtcUs + (_edgeUs - _referenceUs);
+  const int64_t errorUs = _edgeUtc * US_PER_S - referenceUs;
+  _lastErrorUs = errorUs;
+
+  if (llabs(errorUs) <= RTC_MAX_ERROR_US)
+  {
+    if (!_hasBaseline)
+    {
+      // it was right at boot: measure from here
+      _hasBaseline = true;
+      _baselineUs = _edgeUs;
+      _baselineErrorUs = errorUs;
+    }
+    return;
+  }
+
+  if (_hasBaseline && _edgeUs - _baselineUs >= RTC_AGING_MIN_SECONDS * US_PER_S)
+  {
+    // what it gained since it was right is its frequency error; a positive
+    // aging offset slows the oscillator down
+    float ppm = (errorUs - _baselineErrorUs) / ((_edgeUs - _baselineUs) / static_cast<float>(US_PER_S));
+    long aging = _aging + lroundf(ppm / RTC_AGING_PPM_PER_STEP);
+    aging = aging < -128 ? -128 : aging > 127 ? 127 : aging;
+    uint8_t value = static_cast<uint8_t>(static_cast<int8_t>(aging));
+    if (aging != _aging && _bus.writeRegisters(RTC_ADDRESS, REG_AGING, &value, 1))
+      _aging = static_cast<int8_t>(aging);
+  }
+  set(_edgeUs, referenceUs);
+}
+
+void RtcClock::set(int64_t nowUs, int64_t utcUs)
+{
+  if (!_present)
+    return;
+  // writing the seconds starts a new second: do it on one
+  _writeUtc = floorDiv(utcUs, US_PER_S) + 1;
+  _writeAtUs = nowUs + (_writeUtc * US_PER_S - utcUs);
+  _writePending = true;
+  _hasReference = false;
+}
+
+void RtcClock::_write(int64_t nowUs)
+{
+  if (nowUs - _writeAtUs > RTC_MAX_POLL_GAP_US)
+  {
+    // too late, the RTC would start the second late: wait for the next one
+    int64_t late = (nowUs - _writeAtUs) / US_PER_S + 1;
+    _writeAtUs += late * US_PER_S;
+    _writeUtc += late;
+    return;
+  }
+  _writePending = false;
+
+  const int64_t days = floorDiv(_writeUtc, S_PER_DAY);
+  const unsigned seconds = static_cast<unsigned>(_writeUtc - days * S_PER_DAY);
+  int64_t year;
+  unsigned month, day;
+  PosixTimeZone::civilFromDays(days, year, month, day);
+
+  uint8_t registers[TIME_REGISTERS] = {
+      toBcd(seconds % 60),
+      toBcd(seconds / 60 % 60),
+      toBcd(seconds / 3600), // 24 hour mode
+      static_cast<uint8_t>((days + 4) % 7 + 1), // 1970-01-01 was a Thursday
+      toBcd(day),
+      static_cast<uint8_t>(toBcd(month) | (year >= 2100 ? 0x80 : 0)),
+      toBcd(static_cast<unsigned>(year % 100)),
+  };
+  if (!_bus.writeRegisters(RTC_ADDRESS, REG_SECONDS, registers, TIME_REGISTERS))
+    return;
+
+  // the time is good again
+  uint8_t status;
+  if (_bus.readRegisters(RTC_ADDRESS, REG_STATUS, &status, 1) && (status & STATUS_OSF))
+  {
+    status &= ~STATUS_OSF;
+    _bus.writeRegisters(RTC_ADDRESS, REG_STATUS, &status, 1);
+  }
+
+  _valid = _timed = true;
+  _edgeUs = nowUs;
+  _edgeUtc = _writeUtc;
+  // the frequency error is measured from here, where the RTC is as late as
+  // the write
+  _hasBaseline = true;
+  _baselineUs = nowUs;
+  _baselineErrorUs = _writeAtUs - nowUs;
+  _lastPollUs = -1;
+  _nextPollUs = nowUs + RTC_EDGE_SECONDS * US_PER_S - RTC_EDGE_WINDOW_US;
+}
+
+bool RtcClock::_readTime(int64_t &utc)
+{
+  uint8_t registers[TIME_REGISTERS];
+  if (!_bus.readRegisters(RTC_ADDRESS, REG_SECONDS, registers, TIME_REGISTERS))
+    return false;
+
+  unsigned second = fromBcd(registers[0] & 0x7F);
+  unsigned minute = fromBcd(registers[1] & 0x7F);
+  unsigned hour;
+  if (registers[2] & 0x40)
+    hour = fromBcd(registers[2] & 0x1F) % 12 + (registers[2] & 0x20 ? 12 : 0); // 12 hour mode
+  else
+    hour = fromBcd(registers[2] & 0x3F);
+  unsigned day = fromBcd(registers[4] & 0x3F);
+  unsigned month = fromBcd(registers[5] & 0x1F);
+  int64_t year = 2000 + fromBcd(registers[6]) + (registers[5] & 0x80 ? 100 : 0);
+
+  if (second > 59 || minute > 59 || hour > 23 || day < 1 || day > 31 ||
+      month < 1 || month > 12 || year < MIN_VALID_YEAR)
+    return false;
+
+  utc = PosixTimeZone::daysFromCivil(year, month, day) * S_PER_DAY +
+        hour * 3600 + minute * 60 + second;
+  return true;
+}
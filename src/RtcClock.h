@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "I2CBus.h"
+
+// I2C address of the DS3231.
+#define RTC_ADDRESS 0x68
+// Interval [us] the seconds register is read at while waiting for it to tick.
+#define RTC_POLL_US 1000
+// Two reads further apart [us] than this cannot time a tick.
+#define RTC_MAX_POLL_GAP_US 5000
+// The tick is timed again every so many seconds, against the monotonic clock.
+#define RTC_EDGE_SECONDS 60
+// Reading starts this long [us] before the tick is expected.
+#define RTC_EDGE_WINDOW_US 20000
+// The RTC is set when NTP finds it off by more than this [us].
+#define RTC_MAX_ERROR_US 50000
+// The aging offset is only corrected from errors measured this far apart [s].
+#define RTC_AGING_MIN_SECONDS (6 * 3600)
+// Frequency change [ppm] of one step of the aging offset, at 25 C.
+#define RTC_AGING_PPM_PER_STEP 0.1f
+
+//
+// A DS3231 real time clock, keeping UTC over power cuts.
+//
+// begin() reads the time at boot, so the clock can show it before there is
+// any network, to within half a second: the registers only count whole
+// seconds. loop() then reads the seconds register around the next tick, and
+// the tick gives the time to a few milliseconds. This is repeated every
+// RTC_EDGE_SECONDS, so between the ticks utc() follows the monotonic clock
+// (esp_timer_get_time()) only briefly.
+//
+// A better clock (NTP) disciplines the RTC through discipline(): at the next
+// tick the two are compared, and if the RTC is off by more than
+// RTC_MAX_ERROR_US it is set again, right on a second, as writing the
+// seconds restarts the chip's second. The error it built up since the last
+// time it was right gives its frequency error, which is taken out with the
+// aging offset register, so it needs setting less and less.
+//
+// The chip is only accessed through an I2CBus, WireBus on the ESP32 and
+// FakeDS3231 on a host. Times are passed in, in microseconds.
+//
+class RtcClock
+{
+public:
+  explicit RtcClock(I2CBus &bus) : _bus(bus) {}
+
+  // Reads the time at monotonic time `nowUs`. Returns false if there is no
+  // RTC, or it lost its time (e.g. the battery ran out).
+  bool begin(int64_t nowUs);
+  // Times the ticks and does the writes planned. Call often.
+  void loop(int64_t nowUs);
+
+  // Whether there is an RTC at all, whether its time can be used, and
+  // whether it is known to better than a second, from a tick.
+  bool isPresent() const { return _present; }
+  bool isValid() const { return _valid; }
+  bool isTimed() const { return _timed; }
+
+  // UTC [us since the epoch] at monotonic time `nowUs`, by the RTC.
+  int64_t utc(int64_t nowUs) const { return _edgeUtc * 1000000LL + (nowUs - _edgeUs); }
+
+  // Sets the RTC to UTC `utcUs` at `nowUs`. The write is done by loop(), on
+  // the next second.
+  void set(int64_t nowUs, int64_t utcUs);
+  // Tells that UTC was `utcUs` at `nowUs` by a better clock. The RTC is
+  // compared with it at its next tick, and set and trimmed if need be.
+  void discipline(int64_t nowUs, int64_t utcUs);
+
+  // Error [us] of the RTC at the last comparison, positive if it was ahead,
+  // and the aging offset it runs with.
+  int64_t lastErrorUs() const { return _lastErrorUs; }
+  int8_t agingOffset() const { return _aging; }
+
+private:
+  // Reads the seconds and takes the time when they change.
+  void _poll(int64_t nowUs);
+  // Compares the tick just timed with the reference of discipline().
+  void _compare();
+  // Writes the time planned by set().
+  void _write(int64_t nowUs);
+  // Reads the date and time registers, in UTC seconds.
+  bool _readTime(int64_t &utc);
+
+  I2CBus &_bus;
+  bool _present = false;
+  bool _valid = false;
+  bool _timed = false;
+
+  // A tick: the RTC turned to `_edgeUtc` [s] at monotonic time `_edgeUs`.
+  int64_t _edgeUs = 0;
+  int64_t _edgeUtc = 0;
+
+  // Monotonic time [us] of the next read of the seconds, and the previous
+  // read (negative if there is none) and the seconds it read.
+  int64_t _nextPollUs = 0;
+  int64_t _lastPollUs = -1;
+  uint8_t _lastSeconds = 0;
+
+  // A write planned by set(): `_writeUtc` [s] at `_writeAtUs`.
+  bool _writePending = false;
+  int64_t _writeAtUs = 0;
+  int64_t _writeUtc = 0;
+
+  // The reference of discipline(), waiting for a tick.
+  bool _hasReference = false;
+  int64_t _referenceUs = 0;
+  int64_t _referenceUtcUs = 0;
+
+  // The start of the frequency measurement: when the RTC was set, or the
+  // first error measured after boot.
+  bool _hasBaseline = false;
+  int64_t _baselineUs = 0;
+  int64_t _baselineErrorUs = 0;
+
+  int64_t _lastErrorUs = 0;
+  int8_t _aging = 0;
+};
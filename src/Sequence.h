@@ -0,0 +1,129 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// State of a stackless coroutine (a protothread) written with the SEQ_ macros
+// below.
+//
+// A sequence is the body of a function that is called every frame and picks
+// up where it stopped waiting the frame before:
+//
+//   void tick(TDisplay &display)
+//   {
+//     SEQ_BEGIN(_sequence, micros());
+//     SEQ_WAIT_UNTIL(_sequence, hasWord());
+//     display.transition(FADE_MS, true);
+//     SEQ_SLEEP_MS(_sequence, FADE_MS);
+//     for (_letter = 0; _letter < _count; _letter++) {
+//       reveal(_letter);
+//       SEQ_SLEEP_MS(_sequence, LETTER_MS);
+//     }
+//     SEQ_END(_sequence);
+//   }
+//
+// The function must return void, and can have one wait per line. Local
+// variables do not survive a wait, so sequence state lives in members, and a
+// sequence costs a few bytes: no heap, no stack of its own.
+//
+// A sequence has its own clock, deadline(). SEQ_SLEEP_MS() adds to it rather
+// than to the time the frame happened to run, so a late frame does not shift
+// the steps after it: start animations at deadline() (see
+// AnimationTimeline::startAt()) and they run exactly as planned.
+//
+// Each frame resumes at most `budget` waits that are already over, the rest
+// is left for the next frames. After a stall a frame only does a bounded
+// amount of catching up, without losing the planned times.
+//
+class Sequence
+{
+public:
+  static const uint16_t DONE = 0xFFFF;
+
+  explicit Sequence(uint8_t budget = 4) : _budget(budget) {}
+
+  // Starts over from SEQ_BEGIN, with the clock at `nowUs`.
+  void restart(uint32_t nowUs)
+  {
+    _resume = 0;
+    _deadlineUs = nowUs;
+  }
+
+  bool isDone() const { return _resume == DONE; }
+
+  // Time [us] the current step of the sequence is planned for.
+  uint32_t deadline() const { return _deadlineUs; }
+
+  //======================================
+  // Used by the SEQ_ macros
+
+  void beginFrame(uint32_t nowUs)
+  {
+    _nowUs = nowUs;
+    _steps = _budget;
+  }
+  uint16_t resumePoint() const { return _resume; }
+  void setResumePoint(uint16_t resume) { _resume = resume; }
+
+  void sleep(uint32_t us) { _deadlineUs += us; }
+  // True once the deadline has passed, within the budget of the frame.
+  bool due()
+  {
+    if (static_cast<int32_t>(_nowUs - _deadlineUs) < 0 || _steps == 0)
+      return false;
+    _steps--;
+    return true;
+  }
+  // An event has no planned time: the clock continues from the frame that
+  // saw it.
+  void sync() { _deadlineUs = _nowUs; }
+
+private:
+  uint16_t _resume = 0;
+  uint32_t _deadlineUs = 0;
+  uint32_t _nowUs = 0;
+  uint8_t _budget;
+  uint8_t _steps = 0;
+};
+
+#define SEQ_BEGIN(seq, nowUs)  \
+  (seq).beginFrame(nowUs);     \
+  switch ((seq).resumePoint()) \
+  {                            \
+  case 0:
+
+// Waits until the next frame.
+#define SEQ_YIELD(seq)                \
+  do                                  \
+  {                                   \
+    (seq).setResumePoint(__LINE__);   \
+    return;                           \
+  case __LINE__:;                     \
+  } while (0)
+
+// Waits `ms` after the previous planned step.
+#define SEQ_SLEEP_MS(seq, ms)         \
+  do                                  \
+  {                                   \
+    (seq).sleep((ms) * 1000UL);       \
+    (seq).setResumePoint(__LINE__);   \
+  case __LINE__:                      \
+    if (!(seq).due())                 \
+      return;                         \
+  } while (0)
+
+// Waits for `condition`, evaluated once per frame.
+#define SEQ_WAIT_UNTIL(seq, condition) \
+  do                                   \
+  {                                    \
+    (seq).setResumePoint(__LINE__);    \
+  case __LINE__:                       \
+    if (!(condition))                  \
+      return;                          \
+    (seq).sync();                      \
+  } while (0)
+
+#define SEQ_END(seq)                    \
+  (seq).setResumePoint(Sequence::DONE); \
+  case Sequence::DONE:;                 \
+  }
@@ -0,0 +1,200 @@
+#include "SntpClient.h"
+
+#define US_PER_S 1000000LL
+
+// Seconds from 1900-01-01, the NTP epoch, to 1970-01-01.
+#define NTP_UNIX_OFFSET 2208988800LL
+// NTP seconds of 2020-01-01. Earlier ones are taken to be after the NTP
+// seconds roll over in 2036.
+#define NTP_PIVOT 3786825600LL
+
+// First byte of a packet: leap indicator, version and mode.
+#define NTP_REQUEST 0x23 // no leap warning, version 4, client
+#define NTP_MODE_SERVER 4
+#define NTP_LEAP_UNSYNCHRONIZED 3
+
+namespace
+{
+  uint32_t readU32(const uint8_t *p)
+  {
+    return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 |
+           static_cast<uint32_t>(p[2]) << 8 | p[3];
+  }
+
+  uint64_t readU64(const uint8_t *p)
+  {
+    return static_cast<uint64_t>(readU32(p)) << 32 | readU32(p + 4);
+  }
+
+  void writeU64(uint8_t *p, uint64_t value)
+  {
+    for (int i = 7; i >= 0; i--)
+    {
+      p[i] = value & 0xFF;
+      value >>= 8;
+    }
+  }
+
+  // UTC [us since the epoch] of an NTP timestamp.
+  int64_t fromNtp(uint64_t timestamp)
+  {
+    int64_t seconds = timestamp >> 32;
+    if (seconds < NTP_PIVOT)
+      seconds += 1LL << 32;
+    uint64_t fraction = timestamp & 0xFFFFFFFF;
+    return (seconds - NTP_UNIX_OFFSET) * US_PER_S + static_cast<int64_t>((fraction * US_PER_S) >> 32);
+  }
+} // namespace
+
+SntpClient::SntpClient(SntpTransport &transport) : _transport(transport)
+{
+  _transport.onReceive([this](uint8_t server, const uint8_t *data, size_t length, int64_t receivedUs) {
+    receive(server, data, length, receivedUs);
+  });
+}
+
+void SntpClient::setServers(const char *const *servers, uint8_t count, uint16_t port)
+{
+  _serverCount = count < SNTP_MAX_SERVERS ? count : SNTP_MAX_SERVERS;
+  for (uint8_t i = 0; i < _serverCount; i++)
+    _servers[i] = servers[i];
+  _port = port;
+}
+
+bool SntpClient::sync(int64_t nowUs)
+{
+  if (!_seeded)
+  {
+    _random.setSeed(static_cast<uint32_t>(nowUs) ^ static_cast<uint32_t>(nowUs >> 32));
+    _seeded = true;
+  }
+
+  uint8_t sent = 0;
+  for (uint8_t i = 0; i < _serverCount; i++)
+  {
+    Slot &slot = _slots[i];
+    slot.state.store(SLOT_IDLE, std::memory_order_relaxed);
+    slot.nonce = static_cast<uint64_t>(_random.next()) << 32 | _random.next();
+    if (_send(i) != SLOT_IDLE)
+      sent++;
+  }
+
+  _deadlineUs = nowUs + SNTP_TIMEOUT_US;
+  if (sent == 0)
+  {
+    _setState(State::FAILED);
+    return false;
+  }
+  _setState(State::QUERYING);
+  return true;
+}
+
+SntpClient::SlotState SntpClient::_send(uint8_t server)
+{
+  Slot &slot = _slots[server];
+
+  // the server echoes the transmit time of the request: a random one
+  // tells its answer from a forged or late one
+  uint8_t request[SNTP_PACKET_SIZE] = {NTP_REQUEST};
+  writeU64(request + 40, slot.nonce);
+
+  slot.state.store(SLOT_WAITING, std::memory_order_release);
+  if (_transport.send(server, _servers[server], _port, request, sizeof(request), slot.sentUs))
+    return SLOT_WAITING;
+  SlotState state = _transport.resolving(server) ? SLOT_RESOLVING : SLOT_IDLE;
+  slot.state.store(state, std::memory_order_relaxed);
+  return state;
+}
+
+void SntpClient::receive(uint8_t server, const uint8_t *data, size_t length, int64_t receivedUs)
+{
+  if (server >= _serverCount || length < SNTP_PACKET_SIZE)
+    return;
+  Slot &slot = _slots[server];
+  if (slot.state.load(std::memory_order_acquire) != SLOT_WAITING)
+    return;
+
+  uint8_t leap = data[0] >> 6;
+  uint8_t version = (data[0] >> 3) & 0x07;
+  uint8_t mode = data[0] & 0x07;
+  uint8_t stratum = data[1];
+  uint64_t receiveTime = readU64(data + 32);
+  uint64_t transmitTime = readU64(data + 40);
+  if (mode != NTP_MODE_SERVER || version < 3 || version > 4 ||
+      leap == NTP_LEAP_UNSYNCHRONIZED || stratum < 1 || stratum > 15 ||
+      readU64(data + 24) != slot.nonce || receiveTime == 0 || transmitTime == 0)
+    return;
+
+  slot.receiveUtcUs = fromNtp(receiveTime);
+  slot.transmitUtcUs = fromNtp(transmitTime);
+  slot.receivedUs = receivedUs;
+  slot.stratum = stratum;
+  slot.state.store(SLOT_ANSWERED, std::memory_order_release);
+}
+
+void SntpClient::loop(int64_t nowUs)
+{
+  if (_state != State::QUERYING)
+    return;
+
+  if (nowUs < _deadlineUs)
+  {
+    bool open = false;
+    for (uint8_t i = 0; i < _serverCount; i++)
+    {
+      uint8_t state = _slots[i].state.load(std::memory_order_acquire);
+      if (state == SLOT_RESOLVING && !_transport.resolving(i))
+        state = _send(i);
+      open = open || state == SLOT_WAITING || state == SLOT_RESOLVING;
+    }
+    if (open)
+      return;
+  }
+  _finish();
+}
+
+void SntpClient::_finish()
+{
+  bool found = false;
+  Sample best = {};
+  for (uint8_t i = 0; i < _serverCount; i++)
+  {
+    Slot &slot = _slots[i];
+    // late answers are not taken any more
+    if (slot.state.exchange(SLOT_IDLE, std::memory_order_acq_rel) != SLOT_ANSWERED)
+      continue;
+
+    int64_t roundTripUs = slot.receivedUs - slot.sentUs;
+    int64_t heldUs = slot.transmitUtcUs - slot.receiveUtcUs;
+    Sample sample;
+    sample.monotonicUs = slot.sentUs + roundTripUs / 2;
+    sample.utcUs = slot.receiveUtcUs + heldUs / 2;
+    sample.delayUs = roundTripUs > heldUs ? roundTripUs - heldUs : 0;
+    sample.server = i;
+    sample.stratum = slot.stratum;
+    if (!found || sample.delayUs < best.delayUs)
+    {
+      best = sample;
+      found = true;
+    }
+  }
+
+  if (!found)
+  {
+    _setState(State::FAILED);
+    return;
+  }
+  _last = best;
+  _setState(State::SYNCED);
+  if (_syncCallback)
+    _syncCallback(best);
+}
+
+void SntpClient::_setState(State state)
+{
+  if (state == _state)
+    return;
+  _state = state;
+  if (_stateCallback)
+    _stateCallback(state);
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+
+#include "FastRandom.h"
+#include "SntpTransport.h"
+
+// UDP port of NTP servers.
+#define SNTP_PORT 123
+// Time [us] the servers have to answer.
+#define SNTP_TIMEOUT_US 2000000
+// Size of an NTP packet without extensions.
+#define SNTP_PACKET_SIZE 48
+
+//
+// Gets UTC from NTP servers, without waiting for them.
+//
+// sync() sends a request to every server and returns. The answers come in
+// through the transport as they arrive; loop() closes the round when all
+// servers answered or SNTP_TIMEOUT_US is up, and calls back with the best
+// sample. The state changes (querying, synced, failed) are called back too,
+// so nothing has to ask whether the time is there yet.
+//
+// From every answer, the round trip delay is the time between request and
+// answer minus the time the server held it, and UTC by the server is taken
+// to be the middle of its receive and transmit times at the middle of the
+// round trip. Half the delay bounds the error of a sample, so the sample of
+// the lowest delay is kept.
+//
+// Answers are only taken if they echo the random value the request was sent
+// with, are from a synchronized server (stratum 1 to 15), and come in before
+// the round is closed. Times are monotonic (esp_timer_get_time()) and UTC
+// in microseconds.
+//
+class SntpClient
+{
+public:
+  enum class State : uint8_t
+  {
+    IDLE,
+    QUERYING,
+    SYNCED,
+    FAILED,
+  };
+
+  // A sample: UTC was `utcUs` at monotonic time `monotonicUs`, by server
+  // number `server` of stratum `stratum`, with a round trip of `delayUs`.
+  struct Sample
+  {
+    int64_t monotonicUs;
+    int64_t utcUs;
+    int64_t delayUs;
+    uint8_t server;
+    uint8_t stratum;
+  };
+
+  typedef std::function<void(const Sample &sample)> SyncCallback;
+  typedef std::function<void(State state)> StateCallback;
+
+  explicit SntpClient(SntpTransport &transport);
+
+  // Sets the servers asked, up to SNTP_MAX_SERVERS. The names are not
+  // copied.
+  void setServers(const char *const *servers, uint8_t count, uint16_t port = SNTP_PORT);
+  const char *server(uint8_t index) const { return _servers[index]; }
+
+  void onSync(SyncCallback callback) { _syncCallback = callback; }
+  void onStateChange(StateCallback callback) { _stateCallback = callback; }
+
+  // Starts a round: sends a request to every server, or to those whose
+  // names are being looked up, once they are. Returns false, and fails the
+  // round, if none could be sent.
+  bool sync(int64_t nowUs);
+  // Closes the round when it is done. Call from the main loop; the callbacks
+  // are called from here.
+  void loop(int64_t nowUs);
+
+  State state() const { return _state; }
+  // The sample of the last successful round.
+  const Sample &lastSample() const { return _last; }
+
+  // Takes an answer from server number `server`, received at `receivedUs`.
+  // Called by the transport, from any task.
+  void receive(uint8_t server, const uint8_t *data, size_t length, int64_t receivedUs);
+
+private:
+  enum SlotState : uint8_t
+  {
+    SLOT_IDLE,
+    SLOT_RESOLVING,
+    SLOT_WAITING,
+    SLOT_ANSWERED,
+  };
+
+  // A request to one server. `state` hands the slot between the main loop
+  // and the task receive() runs in: the main loop owns it unless it is
+  // SLOT_WAITING, receive() fills in the answer and makes it SLOT_ANSWERED.
+  // SLOT_RESOLVING waits for the transport to look up the name, loop()
+  // sends the request once it did.
+  struct Slot
+  {
+    std::atomic<uint8_t> state{SLOT_IDLE};
+    uint64_t nonce = 0;
+    int64_t sentUs = 0;
+    // The answer: the server's receive and transmit times (UTC), when it
+    // came in, and the server's stratum.
+    int64_t receiveUtcUs = 0;
+    int64_t transmitUtcUs = 0;
+    int64_t receivedUs = 0;
+    uint8_t stratum = 0;
+  };
+
+  // Sends the request of server number `server`, and returns the state of
+  // its slot.
+  SlotState _send(uint8_t server);
+  void _finish();
+  void _setState(State state);
+
+  SntpTransport &_transport;
+  const char *_servers[SNTP_MAX_SERVERS];
+  uint8_t _serverCount = 0;
+  uint16_t _port = SNTP_PORT;
+
+  Slot _slots[SNTP_MAX_SERVERS];
+  int64_t _deadlineUs = 0;
+  FastRandom _random;
+  bool _seeded = false;
+
+  State _state = State::IDLE;
+  Sample _last = {};
+  SyncCallback _syncCallback;
+  StateCallback _stateCallback;
+};
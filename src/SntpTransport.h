@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+// Most servers asked in one sync.
+#define SNTP_MAX_SERVERS 4
+
+//
+// Sends NTP requests to the servers of SntpClient and hands back their
+// answers, with the monotonic times (esp_timer_get_time()) they were sent
+// and received at.
+//
+// Answers may be handed back from another task, e.g. the network task on the
+// ESP32: the receiver must not block. AsyncUdpTransport runs on the ESP32,
+// SocketUdpTransport on a host, against a FakeNtpServer on loopback.
+//
+class SntpTransport
+{
+public:
+  typedef std::function<void(uint8_t server, const uint8_t *data, size_t length, int64_t receivedUs)> Receiver;
+
+  virtual ~SntpTransport() {}
+
+  // Sets where the answers go.
+  void onReceive(Receiver receiver) { _receiver = receiver; }
+
+  // Sends `data` to `host`:`port`, as server number `server` (below
+  // SNTP_MAX_SERVERS), and sets `sentUs` right before it goes out. Returns
+  // false if it could not be sent, e.g. because the name does not resolve,
+  // or is still being looked up (see resolving()).
+  virtual bool send(uint8_t server, const char *host, uint16_t port,
+                    const uint8_t *data, size_t length, int64_t &sentUs) = 0;
+
+  // Whether the name of server number `server` is being looked up: send()
+  // is worth trying again once it is not.
+  virtual bool resolving(uint8_t server) const { return false; }
+
+protected:
+  void deliver(uint8_t server, const uint8_t *data, size_t length, int64_t receivedUs)
+  {
+    if (_receiver)
+      _receiver(server, data, length, receivedUs);
+  }
+
+private:
+  Receiver _receiver;
+};
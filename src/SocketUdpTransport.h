@@ -0,0 +1,100 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <esp_timer.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string.h>
+
+#include "SntpTransport.h"
+
+//
+// SntpTransport on BSD sockets, to run SntpClient on a host, e.g. against
+// FakeNtpServer on loopback. Nothing arrives on its own: receive() hands
+// back what came in, standing in for the network task.
+//
+class SocketUdpTransport : public SntpTransport
+{
+public:
+  SocketUdpTransport()
+  {
+    for (uint8_t i = 0; i < SNTP_MAX_SERVERS; i++)
+      _sockets[i] = -1;
+  }
+
+  ~SocketUdpTransport()
+  {
+    for (uint8_t i = 0; i < SNTP_MAX_SERVERS; i++)
+    {
+      if (_sockets[i] >= 0)
+        close(_sockets[i]);
+    }
+  }
+
+  bool send(uint8_t server, const char *host, uint16_t port,
+            const uint8_t *data, size_t length, int64_t &sentUs) override
+  {
+    if (server >= SNTP_MAX_SERVERS)
+      return false;
+    if (_lookupDelayUs > 0)
+    {
+      int64_t nowUs = esp_timer_get_time();
+      if (_lookupDoneUs[server] == 0)
+        _lookupDoneUs[server] = nowUs + _lookupDelayUs;
+      if (nowUs < _lookupDoneUs[server])
+        return false;
+      _lookupDoneUs[server] = 0;
+    }
+
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo *found = nullptr;
+    if (getaddrinfo(host, nullptr, &hints, &found) != 0)
+      return false;
+    sockaddr_in address;
+    memcpy(&address, found->ai_addr, sizeof(address));
+    freeaddrinfo(found);
+    address.sin_port = htons(port);
+
+    if (_sockets[server] < 0)
+      _sockets[server] = socket(AF_INET, SOCK_DGRAM, 0);
+    int fd = _sockets[server];
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+      return false;
+    sentUs = esp_timer_get_time();
+    return ::send(fd, data, length, 0) == static_cast<ssize_t>(length);
+  }
+
+  bool resolving(uint8_t server) const override
+  {
+    return server < SNTP_MAX_SERVERS && _lookupDoneUs[server] > esp_timer_get_time();
+  }
+
+  // Makes every name take `delayUs` to look up, the way AsyncUdpTransport
+  // looks up a name that is not in the cache.
+  void setLookupDelay(int64_t delayUs) { _lookupDelayUs = delayUs; }
+
+  // Hands back the answers that came in.
+  void receive()
+  {
+    uint8_t buffer[512];
+    for (uint8_t i = 0; i < SNTP_MAX_SERVERS; i++)
+    {
+      if (_sockets[i] < 0)
+        continue;
+      ssize_t length;
+      while ((length = recv(_sockets[i], buffer, sizeof(buffer), MSG_DONTWAIT)) >= 0)
+        deliver(i, buffer, length, esp_timer_get_time());
+    }
+  }
+
+private:
+  int _sockets[SNTP_MAX_SERVERS];
+  int64_t _lookupDelayUs = 0;
+  // When the lookup of each server is done, 0 if none is running.
+  int64_t _lookupDoneUs[SNTP_MAX_SERVERS] = {};
+};
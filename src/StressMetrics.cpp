@@ -0,0 +1,144 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "StressMetrics.h"
+
+namespace
+{
+  // snprintf() that appends at `length`, and keeps counting past the end of
+  // the buffer.
+  void append(char *out, size_t size, size_t &length, const char *format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(length < size ? out + length : nullptr,
+                      length < size ? size - length : 0, format, args);
+    va_end(args);
+    if (n > 0)
+      length += n;
+  }
+} // namespace
+
+StressMetrics::StressMetrics()
+{
+  reset(0, 0, 0);
+  stop(0, 0, 0);
+}
+
+void StressMetrics::reset(int64_t nowUs, uint32_t droppedFrames, uint32_t committedFrames)
+{
+  _startUs = nowUs;
+  _droppedAtStart = droppedFrames;
+  _committedAtStart = committedFrames;
+  _stopped = false;
+  _updates = 0;
+  _transitions = 0;
+  _missed = 0;
+  _computeTotalUs = 0;
+  _computeMinUs = 0;
+  _computeMaxUs = 0;
+  memset(_computeCounts, 0, sizeof(_computeCounts));
+  _frames = 0;
+  _lastFrameUs = nowUs;
+  _frameMaxUs = 0;
+}
+
+void StressMetrics::stop(int64_t nowUs, uint32_t droppedFrames, uint32_t committedFrames)
+{
+  _stopped = true;
+  _stopUs = nowUs;
+  _droppedAtStop = droppedFrames;
+  _committedAtStop = committedFrames;
+}
+
+uint8_t StressMetrics::bucketOf(uint32_t us)
+{
+  uint8_t bucket = 0;
+  while (us > 0 && bucket < BUCKETS - 1)
+  {
+    us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void StressMetrics::recordUpdate(uint32_t computeUs, bool transition)
+{
+  if (_updates == 0 || computeUs < _computeMinUs)
+    _computeMinUs = computeUs;
+  if (computeUs > _computeMaxUs)
+    _computeMaxUs = computeUs;
+  _computeTotalUs += computeUs;
+  _computeCounts[bucketOf(computeUs)]++;
+  _updates++;
+  if (transition)
+    _transitions++;
+}
+
+void StressMetrics::recordFrame(int64_t nowUs)
+{
+  if (_frames > 0 && nowUs - _lastFrameUs > _frameMaxUs)
+    _frameMaxUs = static_cast<uint32_t>(nowUs - _lastFrameUs);
+  _lastFrameUs = nowUs;
+  _frames++;
+}
+
+uint32_t StressMetrics::meanComputeUs() const
+{
+  return _updates > 0 ? static_cast<uint32_t>(_computeTotalUs / _updates) : 0;
+}
+
+uint32_t StressMetrics::computePercentileUs(uint8_t percent) const
+{
+  if (_updates == 0)
+    return 0;
+  // the rank of the update at `percent`, rounded up
+  uint32_t rank = (static_cast<uint64_t>(_updates) * percent + 99) / 100;
+  uint32_t counted = 0;
+  for (uint8_t bucket = 0; bucket < BUCKETS; bucket++)
+  {
+    counted += _computeCounts[bucket];
+    if (counted >= rank && counted > 0)
+    {
+      uint32_t end = bucket == 0 ? 0 : (1UL << bucket) - 1;
+      return end < _computeMaxUs ? end : _computeMaxUs;
+    }
+  }
+  return _computeMaxUs;
+}
+
+size_t StressMetrics::toJson(char *out, size_t size, int64_t nowUs, uint32_t droppedFrames,
+                             uint32_t committedFrames) const
+{
+  size_t length = 0;
+  if (size > 0)
+    out[0] = '\0';
+
+  if (_stopped)
+  {
+    nowUs = _stopUs;
+    droppedFrames = _droppedAtStop;
+    committedFrames = _committedAtStop;
+  }
+  int64_t elapsedUs = nowUs - _startUs;
+  float seconds = elapsedUs > 0 ? elapsedUs / 1e6f : 0.0f;
+  append(out, size, length,
+         "{\"running\":%s,\"seconds\":%.3f,\"updates\":%lu,\"updatesPerSecond\":%.1f,"
+         "\"transitions\":%lu,\"frames\":%lu,\"framesPerSecond\":%.1f,",
+         _stopped ? "false" : "true", seconds, static_cast<unsigned long>(_updates),
+         seconds > 0 ? _updates / seconds : 0.0f, static_cast<unsigned long>(_transitions),
+         static_cast<unsigned long>(_frames), seconds > 0 ? _frames / seconds : 0.0f);
+  append(out, size, length,
+         "\"committedFrames\":%lu,\"droppedFrames\":%lu,\"missedSteps\":%lu,\"maxFrameUs\":%lu,",
+         static_cast<unsigned long>(committedFrames - _committedAtStart),
+         static_cast<unsigned long>(droppedFrames - _droppedAtStart),
+         static_cast<unsigned long>(_missed), static_cast<unsigned long>(_frameMaxUs));
+  append(out, size, length,
+         "\"computeUs\":{\"min\":%lu,\"mean\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu}}",
+         static_cast<unsigned long>(minComputeUs()), static_cast<unsigned long>(meanComputeUs()),
+         static_cast<unsigned long>(computePercentileUs(50)),
+         static_cast<unsigned long>(computePercentileUs(99)),
+         static_cast<unsigned long>(_computeMaxUs));
+  return length;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Throughput and latency of the render pipeline, measured by the stress modes
+ * (see StressMode.h).
+ *
+ * For every update of the clock face it counts the time the update took and
+ * whether the face changed. For every frame it counts the time since the
+ * previous one, and steps the stress mode had to skip because the frame came
+ * too late. Frames the display drew but could not send, because the strip was
+ * still busy with the one before (see DisplayT::droppedFrames()), are taken as
+ * the difference of the display's counters since reset().
+ *
+ * Times are kept in a histogram of powers of two, so the memory used is
+ * fixed, and percentiles are known to a factor of two.
+ *
+ * The class does not depend on Arduino, and time is passed in, so the same
+ * workload can be measured on the host:
+ *
+ *   StressMetrics metrics;
+ *   metrics.reset(nowUs(), 0, 0);
+ *   ...
+ *   metrics.recordUpdate(computeUs, changed);
+ *   metrics.toJson(out, sizeof(out), nowUs(), dropped, committed);
+ */
+class StressMetrics
+{
+public:
+  // Bucket b counts times of [2^(b-1), 2^b) us, bucket 0 times under 1 us.
+  // The last one counts everything from 2^(BUCKETS-2) us up.
+  static const uint8_t BUCKETS = 24;
+
+  StressMetrics();
+
+  // Starts over at `nowUs`, with the display counters at that time.
+  void reset(int64_t nowUs, uint32_t droppedFrames, uint32_t committedFrames);
+  // Ends the run at `nowUs`: from now on, toJson() reports up to there.
+  void stop(int64_t nowUs, uint32_t droppedFrames, uint32_t committedFrames);
+  bool isRunning() const { return !_stopped; }
+
+  // Counts an update of the clock face that took `computeUs`, and whether it
+  // changed the face (a transition was started).
+  void recordUpdate(uint32_t computeUs, bool transition);
+  // Counts a frame at `nowUs`.
+  void recordFrame(int64_t nowUs);
+  // Counts `steps` skipped because they were due before the frame.
+  void recordMissed(uint32_t steps) { _missed += steps; }
+
+  uint32_t updates() const { return _updates; }
+  uint32_t transitions() const { return _transitions; }
+  uint32_t frames() const { return _frames; }
+  uint32_t missed() const { return _missed; }
+
+  // Shortest, mean and longest update [us]. 0 without updates.
+  uint32_t minComputeUs() const { return _updates > 0 ? _computeMinUs : 0; }
+  uint32_t meanComputeUs() const;
+  uint32_t maxComputeUs() const { return _computeMaxUs; }
+  // Update time [us] that `percent` percent of the updates stayed under,
+  // rounded up to the end of its bucket (and never over the longest).
+  uint32_t computePercentileUs(uint8_t percent) const;
+  // Longest time between two frames [us].
+  uint32_t maxFrameUs() const { return _frameMaxUs; }
+
+  // Writes the metrics as JSON, snprintf() style: returns the length it
+  // needs, and writes at most `size` - 1 characters. The rates are taken
+  // over the time from reset() to `nowUs`, or to stop() once stopped;
+  // `droppedFrames` and `committedFrames` are the display counters at
+  // `nowUs`.
+  size_t toJson(char *out, size_t size, int64_t nowUs, uint32_t droppedFrames,
+                uint32_t committedFrames) const;
+
+private:
+  static uint8_t bucketOf(uint32_t us);
+
+  int64_t _startUs = 0;
+  uint32_t _droppedAtStart = 0;
+  uint32_t _committedAtStart = 0;
+  bool _stopped = true;
+  int64_t _stopUs = 0;
+  uint32_t _droppedAtStop = 0;
+  uint32_t _committedAtStop = 0;
+
+  uint32_t _updates = 0;
+  uint32_t _transitions = 0;
+  uint32_t _missed = 0;
+  uint64_t _computeTotalUs = 0;
+  uint32_t _computeMinUs = 0;
+  uint32_t _computeMaxUs = 0;
+  uint32_t _computeCounts[BUCKETS];
+
+  uint32_t _frames = 0;
+  int64_t _lastFrameUs = 0;
+  uint32_t _frameMaxUs = 0;
+};
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#include "FastRandom.h"
+#include "StressMetrics.h"
+
+// Minutes in a day, the times the stress modes go through.
+#define STRESS_DAY_MINUTES (24 * 60)
+// Seed of the random times, the same on every run.
+#define STRESS_RANDOM_SEED 0x5EED1234
+// Time [us] between two reports of the metrics on the serial port.
+#define STRESS_REPORT_US 10000000LL
+
+//
+// The times the stress modes show, one pattern each. next() returns the
+// minute of the day after `minute`.
+//
+
+// Every minute, one after the other.
+struct FastTimeStress
+{
+  static constexpr char label[] = "Stress/Fast Time";
+  static uint16_t next(uint16_t minute, FastRandom &) { return (minute + 1) % STRESS_DAY_MINUTES; }
+};
+
+// A random minute every step, the face changes almost every time.
+struct RandomStress
+{
+  static constexpr char label[] = "Stress/Random";
+  static uint16_t next(uint16_t, FastRandom &random) { return random.below(STRESS_DAY_MINUTES); }
+};
+
+// An hour and five minutes a step: hour and minute words change every time,
+// and all 288 five minute states come by in 288 steps.
+struct CycleHoursStress
+{
+  static constexpr char label[] = "Stress/Cycle Hours";
+  static uint16_t next(uint16_t minute, FastRandom &) { return (minute + 65) % STRESS_DAY_MINUTES; }
+};
+
+// Five minutes a step, every state of the face in order.
+struct Cycle5MinsStress
+{
+  static constexpr char label[] = "Stress/Cycle 5 Minutes";
+  static uint16_t next(uint16_t minute, FastRandom &) { return (minute + 5) % STRESS_DAY_MINUTES; }
+};
+
+//
+// Pushes synthetic times through updateWithTime(), to benchmark the render
+// pipeline. TPattern picks the times (see above).
+//
+// Steps come at the stress rate of the display (see setStressRate()), one per
+// frame if it is 0. The fade of a step takes the time to the next one, or
+// none at all one per frame. Steps that are due more than once by the time
+// of a frame are skipped, and counted as missed.
+//
+// The metrics (see StressMetrics) start over when the mode is entered, and
+// are printed every STRESS_REPORT_US and when it is left. The random times
+// start from the same seed every time, so a run on the device and one on the
+// host do the same work.
+//
+template <typename TPattern>
+class StressMode
+{
+public:
+  static constexpr const char *label = TPattern::label;
+
+  template <typename TDisplay>
+  void enter(TDisplay &display)
+  {
+    int64_t nowUs = esp_timer_get_time();
+    display.clockFace().resetTime();
+    _minute = 0;
+    _random.setSeed(STRESS_RANDOM_SEED);
+    _nextUs = nowUs;
+    _reportUs = nowUs + STRESS_REPORT_US;
+    display.stressMetrics().reset(nowUs, display.droppedFrames(), display.committedFrames());
+  }
+
+  template <typename TDisplay>
+  void tick(TDisplay &display)
+  {
+    StressMetrics &metrics = display.stressMetrics();
+    int64_t nowUs = esp_timer_get_time();
+    metrics.recordFrame(nowUs);
+
+    int64_t intervalUs = display.stressRate() > 0 ? 1000000LL / display.stressRate() : 0;
+    if (nowUs >= _nextUs)
+    {
+      if (intervalUs > 0)
+      {
+        // stay on the schedule, rather than slowing down when behind
+        int64_t behind = (nowUs - _nextUs) / intervalUs;
+        metrics.recordMissed(static_cast<uint32_t>(behind));
+        _nextUs += (behind + 1) * intervalUs;
+      }
+      _minute = TPattern::next(_minute, _random);
+
+      int64_t startUs = esp_timer_get_time();
+      bool changed = display.updateWithTime(_minute / 60, _minute % 60, 0,
+                                          static_cast<int>(intervalUs / 1000));
+      metrics.recordUpdate(static_cast<uint32_t>(esp_timer_get_time() - startUs), changed);
+    }
+
+    if (nowUs >= _reportUs)
+    {
+      _reportUs += STRESS_REPORT_US;
+      _report(display, nowUs);
+    }
+  }
+
+  template <typename TDisplay>
+  void exit(TDisplay &display)
+  {
+    int64_t nowUs = esp_timer_get_time();
+    display.stressMetrics().stop(nowUs, display.droppedFrames(), display.committedFrames());
+    _report(display, nowUs);
+  }
+
+private:
+  template <typename TDisplay>
+  void _report(TDisplay &display, int64_t nowUs)
+  {
+    char json[384];
+    display.stressMetrics().toJson(json, sizeof(json), nowUs, display.droppedFrames(),
+                                   display.committedFrames());
+    Serial.printf("%s %s\n", label, json);
+  }
+
+  // Minute of the day shown last.
+  uint16_t _minute = 0;
+  FastRandom _random;
+  // Monotonic time [us] the next step is due.
+  int64_t _nextUs = 0;
+  // Monotonic time [us] of the next report.
+  int64_t _reportUs = 0;
+};
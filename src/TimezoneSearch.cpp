@@ -0,0 +1,137 @@
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "TimezoneSearch.h"
+#include "Timezones.h"
+
+namespace
+{
+  // snprintf() that appends at `length`, and keeps counting past the end of
+  // the buffer.
+  void append(char *out, size_t size, size_t &length, const char *format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(length < size ? out + length : nullptr,
+                      length < size ? size - length : 0, format, args);
+    va_end(args);
+    if (n > 0)
+      length += n;
+  }
+
+  // The character as compared: lower case, with '_' for ' '.
+  char fold(char c)
+  {
+    if (c >= 'A' && c <= 'Z')
+      return c - 'A' + 'a';
+    return c == '_' ? ' ' : c;
+  }
+
+  // Compares `name` with `text` like strcmp(), both folded. With `prefix`,
+  // a name that starts with `text` is equal to it.
+  int compare(const char *name, const char *text, bool prefix)
+  {
+    for (;; name++, text++)
+    {
+      char a = fold(*name);
+      char b = fold(*text);
+      if (b == '\0' && prefix)
+        return 0;
+      if (a != b || a == '\0')
+        return static_cast<unsigned char>(a) - static_cast<unsigned char>(b);
+    }
+  }
+
+  // Whether `text` is in `name` after its first character: at the start of
+  // a word (after '/', ' ' or '-') if `wordStart`, else anywhere else.
+  bool contains(const char *name, const char *text, bool wordStart)
+  {
+    for (const char *p = name + 1; *p != '\0'; p++)
+    {
+      bool atWord = p[-1] == '/' || p[-1] == ' ' || p[-1] == '-';
+      if (atWord == wordStart && compare(p, text, true) == 0)
+        return true;
+    }
+    return false;
+  }
+
+  // First position in timezoneByName of a name not before `text`.
+  uint16_t lowerBound(const char *text, bool prefix)
+  {
+    uint16_t low = 0;
+    uint16_t high = TIMEZONE_COUNT;
+    while (low < high)
+    {
+      uint16_t middle = (low + high) / 2;
+      if (compare(timezoneName(timezoneByName[middle]), text, prefix) < 0)
+        low = middle + 1;
+      else
+        high = middle;
+    }
+    return low;
+  }
+} // namespace
+
+int16_t TimezoneSearch::find(const char *name)
+{
+  uint16_t position = lowerBound(name, false);
+  if (position < TIMEZONE_COUNT &&
+      compare(timezoneName(timezoneByName[position]), name, false) == 0)
+    return timezoneByName[position];
+  return -1;
+}
+
+uint8_t TimezoneSearch::search(const char *query, uint16_t *ids, uint8_t max)
+{
+  if (*query == '\0')
+    return 0;
+
+  // the names starting with the query follow each other
+  uint16_t first = lowerBound(query, true);
+  uint16_t last = first;
+  uint8_t count = 0;
+  for (; last < TIMEZONE_COUNT &&
+         compare(timezoneName(timezoneByName[last]), query, true) == 0;
+       last++)
+  {
+    if (count < max)
+      ids[count++] = timezoneByName[last];
+  }
+
+  // then the others that contain it, first where a word starts with it
+  for (uint8_t pass = 0; pass < 2; pass++)
+  {
+    for (uint16_t position = 0; position < TIMEZONE_COUNT && count < max; position++)
+    {
+      if (position == first && last > first)
+      {
+        position = last - 1;
+        continue;
+      }
+      uint16_t id = timezoneByName[position];
+      const char *name = timezoneName(id);
+      // a name with the query at a word start is in the first pass only
+      if (pass == 0 ? contains(name, query, true)
+                    : contains(name, query, false) && !contains(name, query, true))
+        ids[count++] = id;
+    }
+  }
+  return count;
+}
+
+size_t TimezoneSearch::toJson(const uint16_t *ids, uint8_t count, char *out, size_t size)
+{
+  size_t length = 0;
+  if (size > 0)
+    out[0] = '\0';
+
+  append(out, size, length, "[");
+  for (uint8_t i = 0; i < count; i++)
+  {
+    // names need no escaping, see tools/timezones_gen.js
+    append(out, size, length, "%s{\"id\":%u,\"name\":\"%s\"}", i == 0 ? "" : ",", ids[i],
+           timezoneName(ids[i]));
+  }
+  append(out, size, length, "]");
+  return length;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Most zones a search returns.
+#define TIMEZONE_SEARCH_MAX_RESULTS 20
+
+//
+// Looks up the zones of Timezones.h by name.
+//
+// Names are compared without case, and an underscore matches a space, so
+// "europe/paris" and "America/New_York" (as in the TZ database) are found
+// too. Both use the IDs in the order of the names, timezoneByName: find() is
+// a binary search, and the zones starting with a query are one range of it.
+//
+// Does not depend on Arduino.
+//
+class TimezoneSearch
+{
+public:
+  // ID of the zone called `name`, or -1 if there is none.
+  static int16_t find(const char *name);
+
+  // Puts the IDs of up to `max` zones matching `query` in `ids`: first the
+  // ones whose name starts with it, then the ones with a word starting with
+  // it, then the ones that have it elsewhere, each in the order of the
+  // names. Returns how many were found. An empty query matches nothing.
+  static uint8_t search(const char *query, uint16_t *ids, uint8_t max);
+
+  // Writes [{"id":<id>,"name":"<name>"},...] for `count` zones, snprintf()
+  // style: returns the length it needs, and writes at most `size` - 1
+  // characters.
+  static size_t toJson(const uint16_t *ids, uint8_t count, char *out, size_t size);
+};
@@ -0,0 +1,1062 @@
+#include <Arduino.h>
+
+#include "Timezones.h"
+
+// This file was generated by the script in tools/timezones_gen.js,
+// based on data found in https://github.com/nayarsystems/posix_tz_db
+
+// 8924 bytes, 558 strings.
+const char timezonePool[] PROGMEM =
+    "Africa/Abidjan\0"
+    "Africa/Accra\0"
+    "Africa/Addis Ababa\0"
+    "EAT-3\0"
+    "Africa/Algiers\0"
+    "CET-1\0"
+    "Africa/Asmara\0"
+    "Africa/Bamako\0"
+    "Africa/Bangui\0"
+    "WAT-1\0"
+    "Africa/Banjul\0"
+    "Africa/Bissau\0"
+    "Africa/Blantyre\0"
+    "CAT-2\0"
+    "Africa/Brazzaville\0"
+    "Africa/Bujumbura\0"
+    "Africa/Cairo\0"
+    "EET-2\0"
+    "Africa/Casablanca\0"
+    "<+01>-1\0"
+    "Africa/Ceuta\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "Africa/Conakry\0"
+    "Africa/Dakar\0"
+    "Africa/Dar es Salaam\0"
+    "Africa/Djibouti\0"
+    "Africa/Douala\0"
+    "Africa/El Aaiun\0"
+    "Africa/Freetown\0"
+    "Africa/Gaborone\0"
+    "Africa/Harare\0"
+    "Africa/Johannesburg\0"
+    "SAST-2\0"
+    "Africa/Juba\0"
+    "Africa/Kampala\0"
+    "Africa/Khartoum\0"
+    "Africa/Kigali\0"
+    "Africa/Kinshasa\0"
+    "Africa/Lagos\0"
+    "Africa/Libreville\0"
+    "Africa/Lome\0"
+    "Africa/Luanda\0"
+    "Africa/Lubumbashi\0"
+    "Africa/Lusaka\0"
+    "Africa/Malabo\0"
+    "Africa/Maputo\0"
+    "Africa/Maseru\0"
+    "Africa/Mbabane\0"
+    "Africa/Mogadishu\0"
+    "Africa/Monrovia\0"
+    "Africa/Nairobi\0"
+    "Africa/Ndjamena\0"
+    "Africa/Niamey\0"
+    "Africa/Nouakchott\0"
+    "Africa/Ouagadougou\0"
+    "Africa/Porto-Novo\0"
+    "Africa/Sao Tome\0"
+    "Africa/Tripoli\0"
+    "Africa/Tunis\0"
+    "Africa/Windhoek\0"
+    "America/Adak\0"
+    "HST10HDT,M3.2.0,M11.1.0\0"
+    "America/Anchorage\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "America/Anguilla\0"
+    "AST4\0"
+    "America/Antigua\0"
+    "America/Araguaina\0"
+    "<-03>3\0"
+    "America/Argentina/Buenos Aires\0"
+    "America/Argentina/Catamarca\0"
+    "America/Argentina/Cordoba\0"
+    "America/Argentina/Jujuy\0"
+    "America/Argentina/La Rioja\0"
+    "America/Argentina/Mendoza\0"
+    "America/Argentina/Rio Gallegos\0"
+    "America/Argentina/Salta\0"
+    "America/Argentina/San Juan\0"
+    "America/Argentina/San Luis\0"
+    "America/Argentina/Tucuman\0"
+    "America/Argentina/Ushuaia\0"
+    "America/Aruba\0"
+    "America/Asuncion\0"
+    "<-04>4<-03>,M10.1.0/0,M3.4.0/0\0"
+    "America/Atikokan\0"
+    "EST5\0"
+    "America/Bahia\0"
+    "America/Bahia Banderas\0"
+    "CST6CDT,M4.1.0,M10.5.0\0"
+    "America/Barbados\0"
+    "America/Belem\0"
+    "America/Belize\0"
+    "CST6\0"
+    "America/Blanc-Sablon\0"
+    "America/Boa Vista\0"
+    "<-04>4\0"
+    "America/Bogota\0"
+    "<-05>5\0"
+    "America/Boise\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "America/Cambridge Bay\0"
+    "America/Campo Grande\0"
+    "America/Cancun\0"
+    "America/Caracas\0"
+    "America/Cayenne\0"
+    "America/Cayman\0"
+    "America/Chicago\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "America/Chihuahua\0"
+    "MST7MDT,M4.1.0,M10.5.0\0"
+    "America/Costa Rica\0"
+    "America/Creston\0"
+    "MST7\0"
+    "America/Cuiaba\0"
+    "America/Curacao\0"
+    "America/Danmarkshavn\0"
+    "America/Dawson\0"
+    "America/Dawson Creek\0"
+    "America/Denver\0"
+    "America/Detroit\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "America/Dominica\0"
+    "America/Edmonton\0"
+    "America/Eirunepe\0"
+    "America/El Salvador\0"
+    "America/Fort Nelson\0"
+    "America/Fortaleza\0"
+    "America/Glace Bay\0"
+    "AST4ADT,M3.2.0,M11.1.0\0"
+    "America/Godthab\0"
+    "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1\0"
+    "America/Goose Bay\0"
+    "America/Grand Turk\0"
+    "America/Grenada\0"
+    "America/Guadeloupe\0"
+    "America/Guatemala\0"
+    "America/Guayaquil\0"
+    "America/Guyana\0"
+    "America/Halifax\0"
+    "America/Havana\0"
+    "CST5CDT,M3.2.0/0,M11.1.0/1\0"
+    "America/Hermosillo\0"
+    "America/Indiana/Indianapolis\0"
+    "America/Indiana/Knox\0"
+    "America/Indiana/Marengo\0"
+    "America/Indiana/Petersburg\0"
+    "America/Indiana/Tell City\0"
+    "America/Indiana/Vevay\0"
+    "America/Indiana/Vincennes\0"
+    "America/Indiana/Winamac\0"
+    "America/Inuvik\0"
+    "America/Iqaluit\0"
+    "America/Jamaica\0"
+    "America/Juneau\0"
+    "America/Kentucky/Louisville\0"
+    "America/Kentucky/Monticello\0"
+    "America/Kralendijk\0"
+    "America/La Paz\0"
+    "America/Lima\0"
+    "America/Los Angeles\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "America/Lower Princes\0"
+    "America/Maceio\0"
+    "America/Managua\0"
+    "America/Manaus\0"
+    "America/Marigot\0"
+    "America/Martinique\0"
+    "America/Matamoros\0"
+    "America/Mazatlan\0"
+    "America/Menominee\0"
+    "America/Merida\0"
+    "America/Metlakatla\0"
+    "America/Mexico City\0"
+    "America/Miquelon\0"
+    "<-03>3<-02>,M3.2.0,M11.1.0\0"
+    "America/Moncton\0"
+    "America/Monterrey\0"
+    "America/Montevideo\0"
+    "America/Montreal\0"
+    "America/Montserrat\0"
+    "America/Nassau\0"
+    "America/New York\0"
+    "America/Nipigon\0"
+    "America/Nome\0"
+    "America/Noronha\0"
+    "<-02>2\0"
+    "America/North Dakota/Beulah\0"
+    "America/North Dakota/Center\0"
+    "America/North Dakota/New Salem\0"
+    "America/Ojinaga\0"
+    "America/Panama\0"
+    "America/Pangnirtung\0"
+    "America/Paramaribo\0"
+    "America/Phoenix\0"
+    "America/Port-au-Prince\0"
+    "America/Port of Spain\0"
+    "America/Porto Velho\0"
+    "America/Puerto Rico\0"
+    "America/Punta Arenas\0"
+    "America/Rainy River\0"
+    "America/Rankin Inlet\0"
+    "America/Recife\0"
+    "America/Regina\0"
+    "America/Resolute\0"
+    "America/Rio Branco\0"
+    "America/Santarem\0"
+    "America/Santiago\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "America/Santo Domingo\0"
+    "America/Sao Paulo\0"
+    "America/Scoresbysund\0"
+    "<-01>1<+00>,M3.5.0/0,M10.5.0/1\0"
+    "America/Sitka\0"
+    "America/St Barthelemy\0"
+    "America/St Johns\0"
+    "NST3:30NDT,M3.2.0,M11.1.0\0"
+    "America/St Kitts\0"
+    "America/St Lucia\0"
+    "America/St Thomas\0"
+    "America/St Vincent\0"
+    "America/Swift Current\0"
+    "America/Tegucigalpa\0"
+    "America/Thule\0"
+    "America/Thunder Bay\0"
+    "America/Tijuana\0"
+    "America/Toronto\0"
+    "America/Tortola\0"
+    "America/Vancouver\0"
+    "America/Whitehorse\0"
+    "America/Winnipeg\0"
+    "America/Yakutat\0"
+    "America/Yellowknife\0"
+    "Antarctica/Casey\0"
+    "<+11>-11\0"
+    "Antarctica/Davis\0"
+    "<+07>-7\0"
+    "Antarctica/DumontDUrville\0"
+    "<+10>-10\0"
+    "Antarctica/Macquarie\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "Antarctica/Mawson\0"
+    "<+05>-5\0"
+    "Antarctica/McMurdo\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "Antarctica/Palmer\0"
+    "Antarctica/Rothera\0"
+    "Antarctica/Syowa\0"
+    "<+03>-3\0"
+    "Antarctica/Troll\0"
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3\0"
+    "Antarctica/Vostok\0"
+    "<+06>-6\0"
+    "Arctic/Longyearbyen\0"
+    "Asia/Aden\0"
+    "Asia/Almaty\0"
+    "Asia/Amman\0"
+    "EET-2EEST,M3.5.4/24,M10.5.5/1\0"
+    "Asia/Anadyr\0"
+    "<+12>-12\0"
+    "Asia/Aqtau\0"
+    "Asia/Aqtobe\0"
+    "Asia/Ashgabat\0"
+    "Asia/Atyrau\0"
+    "Asia/Baghdad\0"
+    "Asia/Bahrain\0"
+    "Asia/Baku\0"
+    "<+04>-4\0"
+    "Asia/Bangkok\0"
+    "Asia/Barnaul\0"
+    "Asia/Beirut\0"
+    "EET-2EEST,M3.5.0/0,M10.5.0/0\0"
+    "Asia/Bishkek\0"
+    "Asia/Brunei\0"
+    "<+08>-8\0"
+    "Asia/Chita\0"
+    "<+09>-9\0"
+    "Asia/Choibalsan\0"
+    "Asia/Colombo\0"
+    "<+0530>-5:30\0"
+    "Asia/Damascus\0"
+    "EET-2EEST,M3.5.5/0,M10.5.5/0\0"
+    "Asia/Dhaka\0"
+    "Asia/Dili\0"
+    "Asia/Dubai\0"
+    "Asia/Dushanbe\0"
+    "Asia/Famagusta\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "Asia/Gaza\0"
+    "EET-2EEST,M3.4.4/48,M10.4.4/49\0"
+    "Asia/Hebron\0"
+    "Asia/Ho Chi Minh\0"
+    "Asia/Hong Kong\0"
+    "HKT-8\0"
+    "Asia/Hovd\0"
+    "Asia/Irkutsk\0"
+    "Asia/Jakarta\0"
+    "WIB-7\0"
+    "Asia/Jayapura\0"
+    "WIT-9\0"
+    "Asia/Jerusalem\0"
+    "IST-2IDT,M3.4.4/26,M10.5.0\0"
+    "Asia/Kabul\0"
+    "<+0430>-4:30\0"
+    "Asia/Kamchatka\0"
+    "Asia/Karachi\0"
+    "PKT-5\0"
+    "Asia/Kathmandu\0"
+    "<+0545>-5:45\0"
+    "Asia/Khandyga\0"
+    "Asia/Kolkata\0"
+    "IST-5:30\0"
+    "Asia/Krasnoyarsk\0"
+    "Asia/Kuala Lumpur\0"
+    "Asia/Kuching\0"
+    "Asia/Kuwait\0"
+    "Asia/Macau\0"
+    "CST-8\0"
+    "Asia/Magadan\0"
+    "Asia/Makassar\0"
+    "WITA-8\0"
+    "Asia/Manila\0"
+    "PST-8\0"
+    "Asia/Muscat\0"
+    "Asia/Nicosia\0"
+    "Asia/Novokuznetsk\0"
+    "Asia/Novosibirsk\0"
+    "Asia/Omsk\0"
+    "Asia/Oral\0"
+    "Asia/Phnom Penh\0"
+    "Asia/Pontianak\0"
+    "Asia/Pyongyang\0"
+    "KST-9\0"
+    "Asia/Qatar\0"
+    "Asia/Qyzylorda\0"
+    "Asia/Riyadh\0"
+    "Asia/Sakhalin\0"
+    "Asia/Samarkand\0"
+    "Asia/Seoul\0"
+    "Asia/Shanghai\0"
+    "Asia/Singapore\0"
+    "Asia/Srednekolymsk\0"
+    "Asia/Taipei\0"
+    "Asia/Tashkent\0"
+    "Asia/Tbilisi\0"
+    "Asia/Tehran\0"
+    "<+0330>-3:30<+0430>,J79/24,J263/24\0"
+    "Asia/Thimphu\0"
+    "Asia/Tokyo\0"
+    "JST-9\0"
+    "Asia/Tomsk\0"
+    "Asia/Ulaanbaatar\0"
+    "Asia/Urumqi\0"
+    "Asia/Ust-Nera\0"
+    "Asia/Vientiane\0"
+    "Asia/Vladivostok\0"
+    "Asia/Yakutsk\0"
+    "Asia/Yangon\0"
+    "<+0630>-6:30\0"
+    "Asia/Yekaterinburg\0"
+    "Asia/Yerevan\0"
+    "Atlantic/Azores\0"
+    "Atlantic/Bermuda\0"
+    "Atlantic/Canary\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "Atlantic/Cape Verde\0"
+    "<-01>1\0"
+    "Atlantic/Faroe\0"
+    "Atlantic/Madeira\0"
+    "Atlantic/Reykjavik\0"
+    "Atlantic/South Georgia\0"
+    "Atlantic/St Helena\0"
+    "Atlantic/Stanley\0"
+    "Australia/Adelaide\0"
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+    "Australia/Brisbane\0"
+    "AEST-10\0"
+    "Australia/Broken Hill\0"
+    "Australia/Currie\0"
+    "Australia/Darwin\0"
+    "ACST-9:30\0"
+    "Australia/Eucla\0"
+    "<+0845>-8:45\0"
+    "Australia/Hobart\0"
+    "Australia/Lindeman\0"
+    "Australia/Lord Howe\0"
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0\0"
+    "Australia/Melbourne\0"
+    "Australia/Perth\0"
+    "AWST-8\0"
+    "Australia/Sydney\0"
+    "Etc/GMT\0"
+    "Etc/GMT+0\0"
+    "Etc/GMT+1\0"
+    "Etc/GMT+10\0"
+    "<-10>10\0"
+    "Etc/GMT+11\0"
+    "<-11>11\0"
+    "Etc/GMT+12\0"
+    "<-12>12\0"
+    "Etc/GMT+2\0"
+    "Etc/GMT+3\0"
+    "Etc/GMT+4\0"
+    "Etc/GMT+5\0"
+    "Etc/GMT+6\0"
+    "<-06>6\0"
+    "Etc/GMT+7\0"
+    "<-07>7\0"
+    "Etc/GMT+8\0"
+    "<-08>8\0"
+    "Etc/GMT+9\0"
+    "<-09>9\0"
+    "Etc/GMT-0\0"
+    "Etc/GMT-1\0"
+    "Etc/GMT-10\0"
+    "Etc/GMT-11\0"
+    "Etc/GMT-12\0"
+    "Etc/GMT-13\0"
+    "<+13>-13\0"
+    "Etc/GMT-14\0"
+    "<+14>-14\0"
+    "Etc/GMT-2\0"
+    "<+02>-2\0"
+    "Etc/GMT-3\0"
+    "Etc/GMT-4\0"
+    "Etc/GMT-5\0"
+    "Etc/GMT-6\0"
+    "Etc/GMT-7\0"
+    "Etc/GMT-8\0"
+    "Etc/GMT-9\0"
+    "Etc/GMT0\0"
+    "Etc/Greenwich\0"
+    "Etc/UCT\0"
+    "UTC0\0"
+    "Etc/UTC\0"
+    "Etc/Universal\0"
+    "Etc/Zulu\0"
+    "Europe/Amsterdam\0"
+    "Europe/Andorra\0"
+    "Europe/Astrakhan\0"
+    "Europe/Athens\0"
+    "Europe/Belgrade\0"
+    "Europe/Berlin\0"
+    "Europe/Bratislava\0"
+    "Europe/Brussels\0"
+    "Europe/Bucharest\0"
+    "Europe/Budapest\0"
+    "Europe/Busingen\0"
+    "Europe/Chisinau\0"
+    "EET-2EEST,M3.5.0,M10.5.0/3\0"
+    "Europe/Copenhagen\0"
+    "Europe/Dublin\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "Europe/Gibraltar\0"
+    "Europe/Guernsey\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "Europe/Helsinki\0"
+    "Europe/Isle of Man\0"
+    "Europe/Istanbul\0"
+    "Europe/Jersey\0"
+    "Europe/Kaliningrad\0"
+    "Europe/Kiev\0"
+    "Europe/Kirov\0"
+    "Europe/Lisbon\0"
+    "Europe/Ljubljana\0"
+    "Europe/London\0"
+    "Europe/Luxembourg\0"
+    "Europe/Madrid\0"
+    "Europe/Malta\0"
+    "Europe/Mariehamn\0"
+    "Europe/Minsk\0"
+    "Europe/Monaco\0"
+    "Europe/Moscow\0"
+    "MSK-3\0"
+    "Europe/Oslo\0"
+    "Europe/Paris\0"
+    "Europe/Podgorica\0"
+    "Europe/Prague\0"
+    "Europe/Riga\0"
+    "Europe/Rome\0"
+    "Europe/Samara\0"
+    "Europe/San Marino\0"
+    "Europe/Sarajevo\0"
+    "Europe/Saratov\0"
+    "Europe/Simferopol\0"
+    "Europe/Skopje\0"
+    "Europe/Sofia\0"
+    "Europe/Stockholm\0"
+    "Europe/Tallinn\0"
+    "Europe/Tirane\0"
+    "Europe/Ulyanovsk\0"
+    "Europe/Uzhgorod\0"
+    "Europe/Vaduz\0"
+    "Europe/Vatican\0"
+    "Europe/Vienna\0"
+    "Europe/Vilnius\0"
+    "Europe/Volgograd\0"
+    "Europe/Warsaw\0"
+    "Europe/Zagreb\0"
+    "Europe/Zaporozhye\0"
+    "Europe/Zurich\0"
+    "Indian/Antananarivo\0"
+    "Indian/Chagos\0"
+    "Indian/Christmas\0"
+    "Indian/Cocos\0"
+    "Indian/Comoro\0"
+    "Indian/Kerguelen\0"
+    "Indian/Mahe\0"
+    "Indian/Maldives\0"
+    "Indian/Mauritius\0"
+    "Indian/Mayotte\0"
+    "Indian/Reunion\0"
+    "Pacific/Apia\0"
+    "<+13>-13<+14>,M9.5.0/3,M4.1.0/4\0"
+    "Pacific/Auckland\0"
+    "Pacific/Bougainville\0"
+    "Pacific/Chatham\0"
+    "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45\0"
+    "Pacific/Chuuk\0"
+    "Pacific/Easter\0"
+    "<-06>6<-05>,M9.1.6/22,M4.1.6/22\0"
+    "Pacific/Efate\0"
+    "Pacific/Enderbury\0"
+    "Pacific/Fakaofo\0"
+    "Pacific/Fiji\0"
+    "<+12>-12<+13>,M11.2.0,M1.2.3/99\0"
+    "Pacific/Funafuti\0"
+    "Pacific/Galapagos\0"
+    "Pacific/Gambier\0"
+    "Pacific/Guadalcanal\0"
+    "Pacific/Guam\0"
+    "ChST-10\0"
+    "Pacific/Honolulu\0"
+    "HST10\0"
+    "Pacific/Kiritimati\0"
+    "Pacific/Kosrae\0"
+    "Pacific/Kwajalein\0"
+    "Pacific/Majuro\0"
+    "Pacific/Marquesas\0"
+    "<-0930>9:30\0"
+    "Pacific/Midway\0"
+    "SST11\0"
+    "Pacific/Nauru\0"
+    "Pacific/Niue\0"
+    "Pacific/Norfolk\0"
+    "<+11>-11<+12>,M10.1.0,M4.1.0/3\0"
+    "Pacific/Noumea\0"
+    "Pacific/Pago Pago\0"
+    "Pacific/Palau\0"
+    "Pacific/Pitcairn\0"
+    "Pacific/Pohnpei\0"
+    "Pacific/Port Moresby\0"
+    "Pacific/Rarotonga\0"
+    "Pacific/Saipan\0"
+    "Pacific/Tahiti\0"
+    "Pacific/Tarawa\0"
+    "Pacific/Tongatapu\0"
+    "Pacific/Wake\0"
+    "Pacific/Wallis\0";
+
+const TimezoneEntry timezoneIndex[TIMEZONE_COUNT] PROGMEM = {
+    {0, 6876}, // Africa/Abidjan
+    {15, 6876}, // Africa/Accra
+    {28, 47}, // Africa/Addis Ababa
+    {53, 68}, // Africa/Algiers
+    {74, 47}, // Africa/Asmara
+    {88, 6876}, // Africa/Bamako
+    {102, 116}, // Africa/Bangui
+    {122, 6876}, // Africa/Banjul
+    {136, 6876}, // Africa/Bissau
+    {150, 166}, // Africa/Blantyre
+    {172, 116}, // Africa/Brazzaville
+    {191, 166}, // Africa/Bujumbura
+    {208, 221}, // Africa/Cairo
+    {227, 245}, // Africa/Casablanca
+    {253, 266}, // Africa/Ceuta
+    {293, 6876}, // Africa/Conakry
+    {308, 6876}, // Africa/Dakar
+    {321, 47}, // Africa/Dar es Salaam
+    {342, 47}, // Africa/Djibouti
+    {358, 116}, // Africa/Douala
+    {372, 245}, // Africa/El Aaiun
+    {388, 6876}, // Africa/Freetown
+    {404, 166}, // Africa/Gaborone
+    {420, 166}, // Africa/Harare
+    {434, 454}, // Africa/Johannesburg
+    {461, 47}, // Africa/Juba
+    {473, 47}, // Africa/Kampala
+    {488, 166}, // Africa/Khartoum
+    {504, 166}, // Africa/Kigali
+    {518, 116}, // Africa/Kinshasa
+    {534, 116}, // Africa/Lagos
+    {547, 116}, // Africa/Libreville
+    {565, 6876}, // Africa/Lome
+    {577, 116}, // Africa/Luanda
+    {591, 166}, // Africa/Lubumbashi
+    {609, 166}, // Africa/Lusaka
+    {623, 116}, // Africa/Malabo
+    {637, 166}, // Africa/Maputo
+    {651, 454}, // Africa/Maseru
+    {665, 454}, // Africa/Mbabane
+    {680, 47}, // Africa/Mogadishu
+    {697, 6876}, // Africa/Monrovia
+    {713, 47}, // Africa/Nairobi
+    {728, 116}, // Africa/Ndjamena
+    {744, 116}, // Africa/Niamey
+    {758, 6876}, // Africa/Nouakchott
+    {776, 6876}, // Africa/Ouagadougou
+    {795, 116}, // Africa/Porto-Novo
+    {813, 6876}, // Africa/Sao Tome
+    {829, 221}, // Africa/Tripoli
+    {844, 68}, // Africa/Tunis
+    {857, 166}, // Africa/Windhoek
+    {873, 886}, // America/Adak
+    {910, 928}, // America/Anchorage
+    {953, 970}, // America/Anguilla
+    {975, 970}, // America/Antigua
+    {991, 1009}, // America/Araguaina
+    {1016, 1009}, // America/Argentina/Buenos Aires
+    {1047, 1009}, // America/Argentina/Catamarca
+    {1075, 1009}, // America/Argentina/Cordoba
+    {1101, 1009}, // America/Argentina/Jujuy
+    {1125, 1009}, // America/Argentina/La Rioja
+    {1152, 1009}, // America/Argentina/Mendoza
+    {1178, 1009}, // America/Argentina/Rio Gallegos
+    {1209, 1009}, // America/Argentina/Salta
+    {1233, 1009}, // America/Argentina/San Juan
+    {1260, 1009}, // America/Argentina/San Luis
+    {1287, 1009}, // America/Argentina/Tucuman
+    {1313, 1009}, // America/Argentina/Ushuaia
+    {1339, 970}, // America/Aruba
+    {1353, 1370}, // America/Asuncion
+    {1401, 1418}, // America/Atikokan
+    {1423, 1009}, // America/Bahia
+    {1437, 1460}, // America/Bahia Banderas
+    {1483, 970}, // America/Barbados
+    {1500, 1009}, // America/Belem
+    {1514, 1529}, // America/Belize
+    {1534, 970}, // America/Blanc-Sablon
+    {1555, 1573}, // America/Boa Vista
+    {1580, 1595}, // America/Bogota
+    {1602, 1616}, // America/Boise
+    {1639, 1616}, // America/Cambridge Bay
+    {1661, 1573}, // America/Campo Grande
+    {1682, 1418}, // America/Cancun
+    {1697, 1573}, // America/Caracas
+    {1713, 1009}, // America/Cayenne
+    {1729, 1418}, // America/Cayman
+    {1744, 1760}, // America/Chicago
+    {1783, 1801}, // America/Chihuahua
+    {1824, 1529}, // America/Costa Rica
+    {1843, 1859}, // America/Creston
+    {1864, 1573}, // America/Cuiaba
+    {1879, 970}, // America/Curacao
+    {1895, 6876}, // America/Danmarkshavn
+    {1916, 1859}, // America/Dawson
+    {1931, 1859}, // America/Dawson Creek
+    {1952, 1616}, // America/Denver
+    {1967, 1983}, // America/Detroit
+    {2006, 970}, // America/Dominica
+    {2023, 1616}, // America/Edmonton
+    {2040, 1595}, // America/Eirunepe
+    {2057, 1529}, // America/El Salvador
+    {2077, 1859}, // America/Fort Nelson
+    {2097, 1009}, // America/Fortaleza
+    {2115, 2133}, // America/Glace Bay
+    {2156, 2172}, // America/Godthab
+    {2205, 2133}, // America/Goose Bay
+    {2223, 1983}, // America/Grand Turk
+    {2242, 970}, // America/Grenada
+    {2258, 970}, // America/Guadeloupe
+    {2277, 1529}, // America/Guatemala
+    {2295, 1595}, // America/Guayaquil
+    {2313, 1573}, // America/Guyana
+    {2328, 2133}, // America/Halifax
+    {2344, 2359}, // America/Havana
+    {2386, 1859}, // America/Hermosillo
+    {2405, 1983}, // America/Indiana/Indianapolis
+    {2434, 1760}, // America/Indiana/Knox
+    {2455, 1983}, // America/Indiana/Marengo
+    {2479, 1983}, // America/Indiana/Petersburg
+    {2506, 1760}, // America/Indiana/Tell City
+    {2532, 1983}, // America/Indiana/Vevay
+    {2554, 1983}, // America/Indiana/Vincennes
+    {2580, 1983}, // America/Indiana/Winamac
+    {2604, 1616}, // America/Inuvik
+    {2619, 1983}, // America/Iqaluit
+    {2635, 1418}, // America/Jamaica
+    {2651, 928}, // America/Juneau
+    {2666, 1983}, // America/Kentucky/Louisville
+    {2694, 1983}, // America/Kentucky/Monticello
+    {2722, 970}, // America/Kralendijk
+    {2741, 1573}, // America/La Paz
+    {2756, 1595}, // America/Lima
+    {2769, 2789}, // America/Los Angeles
+    {2812, 970}, // America/Lower Princes
+    {2834, 1009}, // America/Maceio
+    {2849, 1529}, // America/Managua
+    {2865, 1573}, // America/Manaus
+    {2880, 970}, // America/Marigot
+    {2896, 970}, // America/Martinique
+    {2915, 1760}, // America/Matamoros
+    {2933, 1801}, // America/Mazatlan
+    {2950, 1760}, // America/Menominee
+    {2968, 1460}, // America/Merida
+    {2983, 928}, // America/Metlakatla
+    {3002, 1460}, // America/Mexico City
+    {3022, 3039}, // America/Miquelon
+    {3066, 2133}, // America/Moncton
+    {3082, 1460}, // America/Monterrey
+    {3100, 1009}, // America/Montevideo
+    {3119, 1983}, // America/Montreal
+    {3136, 970}, // America/Montserrat
+    {3155, 1983}, // America/Nassau
+    {3170, 1983}, // America/New York
+    {3187, 1983}, // America/Nipigon
+    {3203, 928}, // America/Nome
+    {3216, 3232}, // America/Noronha
+    {3239, 1760}, // America/North Dakota/Beulah
+    {3267, 1760}, // America/North Dakota/Center
+    {3295, 1760}, // America/North Dakota/New Salem
+    {3326, 1616}, // America/Ojinaga
+    {3342, 1418}, // America/Panama
+    {3357, 1983}, // America/Pangnirtung
+    {3377, 1009}, // America/Paramaribo
+    {3396, 1859}, // America/Phoenix
+    {3412, 1983}, // America/Port-au-Prince
+    {3435, 970}, // America/Port of Spain
+    {3457, 1573}, // America/Porto Velho
+    {3477, 970}, // America/Puerto Rico
+    {3497, 1009}, // America/Punta Arenas
+    {3518, 1760}, // America/Rainy River
+    {3538, 1760}, // America/Rankin Inlet
+    {3559, 1009}, // America/Recife
+    {3574, 1529}, // America/Regina
+    {3589, 1760}, // America/Resolute
+    {3606, 1595}, // America/Rio Branco
+    {3625, 1009}, // America/Santarem
+    {3642, 3659}, // America/Santiago
+    {3691, 970}, // America/Santo Domingo
+    {3713, 1009}, // America/Sao Paulo
+    {3731, 3752}, // America/Scoresbysund
+    {3783, 928}, // America/Sitka
+    {3797, 970}, // America/St Barthelemy
+    {3819, 3836}, // America/St Johns
+    {3862, 970}, // America/St Kitts
+    {3879, 970}, // America/St Lucia
+    {3896, 970}, // America/St Thomas
+    {3914, 970}, // America/St Vincent
+    {3933, 1529}, // America/Swift Current
+    {3955, 1529}, // America/Tegucigalpa
+    {3975, 2133}, // America/Thule
+    {3989, 1983}, // America/Thunder Bay
+    {4009, 2789}, // America/Tijuana
+    {4025, 1983}, // America/Toronto
+    {4041, 970}, // America/Tortola
+    {4057, 2789}, // America/Vancouver
+    {4075, 1859}, // America/Whitehorse
+    {4094, 1760}, // America/Winnipeg
+    {4111, 928}, // America/Yakutat
+    {4127, 1616}, // America/Yellowknife
+    {4147, 4164}, // Antarctica/Casey
+    {4173, 4190}, // Antarctica/Davis
+    {4198, 4224}, // Antarctica/DumontDUrville
+    {4233, 4254}, // Antarctica/Macquarie
+    {4283, 4301}, // Antarctica/Mawson
+    {4309, 4328}, // Antarctica/McMurdo
+    {4356, 1009}, // Antarctica/Palmer
+    {4374, 1009}, // Antarctica/Rothera
+    {4393, 4410}, // Antarctica/Syowa
+    {4418, 4435}, // Antarctica/Troll
+    {4468, 4486}, // Antarctica/Vostok
+    {4494, 266}, // Arctic/Longyearbyen
+    {4514, 4410}, // Asia/Aden
+    {4524, 4486}, // Asia/Almaty
+    {4536, 4547}, // Asia/Amman
+    {4577, 4589}, // Asia/Anadyr
+    {4598, 4301}, // Asia/Aqtau
+    {4609, 4301}, // Asia/Aqtobe
+    {4621, 4301}, // Asia/Ashgabat
+    {4635, 4301}, // Asia/Atyrau
+    {4647, 4410}, // Asia/Baghdad
+    {4660, 4410}, // Asia/Bahrain
+    {4673, 4683}, // Asia/Baku
+    {4691, 4190}, // Asia/Bangkok
+    {4704, 4190}, // Asia/Barnaul
+    {4717, 4729}, // Asia/Beirut
+    {4758, 4486}, // Asia/Bishkek
+    {4771, 4783}, // Asia/Brunei
+    {4791, 4802}, // Asia/Chita
+    {4810, 4783}, // Asia/Choibalsan
+    {4826, 4839}, // Asia/Colombo
+    {4852, 4866}, // Asia/Damascus
+    {4895, 4486}, // Asia/Dhaka
+    {4906, 4802}, // Asia/Dili
+    {4916, 4683}, // Asia/Dubai
+    {4927, 4301}, // Asia/Dushanbe
+    {4941, 4956}, // Asia/Famagusta
+    {4985, 4995}, // Asia/Gaza
+    {5026, 4995}, // Asia/Hebron
+    {5038, 4190}, // Asia/Ho Chi Minh
+    {5055, 5070}, // Asia/Hong Kong
+    {5076, 4190}, // Asia/Hovd
+    {5086, 4783}, // Asia/Irkutsk
+    {5099, 5112}, // Asia/Jakarta
+    {5118, 5132}, // Asia/Jayapura
+    {5138, 5153}, // Asia/Jerusalem
+    {5180, 5191}, // Asia/Kabul
+    {5204, 4589}, // Asia/Kamchatka
+    {5219, 5232}, // Asia/Karachi
+    {5238, 5253}, // Asia/Kathmandu
+    {5266, 4802}, // Asia/Khandyga
+    {5280, 5293}, // Asia/Kolkata
+    {5302, 4190}, // Asia/Krasnoyarsk
+    {5319, 4783}, // Asia/Kuala Lumpur
+    {5337, 4783}, // Asia/Kuching
+    {5350, 4410}, // Asia/Kuwait
+    {5362, 5373}, // Asia/Macau
+    {5379, 4164}, // Asia/Magadan
+    {5392, 5406}, // Asia/Makassar
+    {5413, 5425}, // Asia/Manila
+    {5431, 4683}, // Asia/Muscat
+    {5443, 4956}, // Asia/Nicosia
+    {5456, 4190}, // Asia/Novokuznetsk
+    {5474, 4190}, // Asia/Novosibirsk
+    {5491, 4486}, // Asia/Omsk
+    {5501, 4301}, // Asia/Oral
+    {5511, 4190}, // Asia/Phnom Penh
+    {5527, 5112}, // Asia/Pontianak
+    {5542, 5557}, // Asia/Pyongyang
+    {5563, 4410}, // Asia/Qatar
+    {5574, 4301}, // Asia/Qyzylorda
+    {5589, 4410}, // Asia/Riyadh
+    {5601, 4164}, // Asia/Sakhalin
+    {5615, 4301}, // Asia/Samarkand
+    {5630, 5557}, // Asia/Seoul
+    {5641, 5373}, // Asia/Shanghai
+    {5655, 4783}, // Asia/Singapore
+    {5670, 4164}, // Asia/Srednekolymsk
+    {5689, 5373}, // Asia/Taipei
+    {5701, 4301}, // Asia/Tashkent
+    {5715, 4683}, // Asia/Tbilisi
+    {5728, 5740}, // Asia/Tehran
+    {5775, 4486}, // Asia/Thimphu
+    {5788, 5799}, // Asia/Tokyo
+    {5805, 4190}, // Asia/Tomsk
+    {5816, 4783}, // Asia/Ulaanbaatar
+    {5833, 4486}, // Asia/Urumqi
+    {5845, 4224}, // Asia/Ust-Nera
+    {5859, 4190}, // Asia/Vientiane
+    {5874, 4224}, // Asia/Vladivostok
+    {5891, 4802}, // Asia/Yakutsk
+    {5904, 5916}, // Asia/Yangon
+    {5929, 4301}, // Asia/Yekaterinburg
+    {5948, 4683}, // Asia/Yerevan
+    {5961, 3752}, // Atlantic/Azores
+    {5977, 2133}, // Atlantic/Bermuda
+    {5994, 6010}, // Atlantic/Canary
+    {6036, 6056}, // Atlantic/Cape Verde
+    {6063, 6010}, // Atlantic/Faroe
+    {6078, 6010}, // Atlantic/Madeira
+    {6095, 6876}, // Atlantic/Reykjavik
+    {6114, 3232}, // Atlantic/South Georgia
+    {6137, 6876}, // Atlantic/St Helena
+    {6156, 1009}, // Atlantic/Stanley
+    {6173, 6192}, // Australia/Adelaide
+    {6223, 6242}, // Australia/Brisbane
+    {6250, 6192}, // Australia/Broken Hill
+    {6272, 4254}, // Australia/Currie
+    {6289, 6306}, // Australia/Darwin
+    {6316, 6332}, // Australia/Eucla
+    {6345, 4254}, // Australia/Hobart
+    {6362, 6242}, // Australia/Lindeman
+    {6381, 6401}, // Australia/Lord Howe
+    {6438, 4254}, // Australia/Melbourne
+    {6458, 6474}, // Australia/Perth
+    {6481, 4254}, // Australia/Sydney
+    {6498, 6876}, // Etc/GMT
+    {6506, 6876}, // Etc/GMT+0
+    {6516, 6056}, // Etc/GMT+1
+    {6526, 6537}, // Etc/GMT+10
+    {6545, 6556}, // Etc/GMT+11
+    {6564, 6575}, // Etc/GMT+12
+    {6583, 3232}, // Etc/GMT+2
+    {6593, 1009}, // Etc/GMT+3
+    {6603, 1573}, // Etc/GMT+4
+    {6613, 1595}, // Etc/GMT+5
+    {6623, 6633}, // Etc/GMT+6
+    {6640, 6650}, // Etc/GMT+7
+    {6657, 6667}, // Etc/GMT+8
+    {6674, 6684}, // Etc/GMT+9
+    {6691, 6876}, // Etc/GMT-0
+    {6701, 245}, // Etc/GMT-1
+    {6711, 4224}, // Etc/GMT-10
+    {6722, 4164}, // Etc/GMT-11
+    {6733, 4589}, // Etc/GMT-12
+    {6744, 6755}, // Etc/GMT-13
+    {6764, 6775}, // Etc/GMT-14
+    {6784, 6794}, // Etc/GMT-2
+    {6802, 4410}, // Etc/GMT-3
+    {6812, 4683}, // Etc/GMT-4
+    {6822, 4301}, // Etc/GMT-5
+    {6832, 4486}, // Etc/GMT-6
+    {6842, 4190}, // Etc/GMT-7
+    {6852, 4783}, // Etc/GMT-8
+    {6862, 4802}, // Etc/GMT-9
+    {6872, 6876}, // Etc/GMT0
+    {6881, 6876}, // Etc/Greenwich
+    {6895, 6903}, // Etc/UCT
+    {6908, 6903}, // Etc/UTC
+    {6916, 6903}, // Etc/Universal
+    {6930, 6903}, // Etc/Zulu
+    {6939, 266}, // Europe/Amsterdam
+    {6956, 266}, // Europe/Andorra
+    {6971, 4683}, // Europe/Astrakhan
+    {6988, 4956}, // Europe/Athens
+    {7002, 266}, // Europe/Belgrade
+    {7018, 266}, // Europe/Berlin
+    {7032, 266}, // Europe/Bratislava
+    {7050, 266}, // Europe/Brussels
+    {7066, 4956}, // Europe/Bucharest
+    {7083, 266}, // Europe/Budapest
+    {7099, 266}, // Europe/Busingen
+    {7115, 7131}, // Europe/Chisinau
+    {7158, 266}, // Europe/Copenhagen
+    {7176, 7190}, // Europe/Dublin
+    {7217, 266}, // Europe/Gibraltar
+    {7234, 7250}, // Europe/Guernsey
+    {7275, 4956}, // Europe/Helsinki
+    {7291, 7250}, // Europe/Isle of Man
+    {7310, 4410}, // Europe/Istanbul
+    {7326, 7250}, // Europe/Jersey
+    {7340, 221}, // Europe/Kaliningrad
+    {7359, 4956}, // Europe/Kiev
+    {7371, 4410}, // Europe/Kirov
+    {7384, 6010}, // Europe/Lisbon
+    {7398, 266}, // Europe/Ljubljana
+    {7415, 7250}, // Europe/London
+    {7429, 266}, // Europe/Luxembourg
+    {7447, 266}, // Europe/Madrid
+    {7461, 266}, // Europe/Malta
+    {7474, 4956}, // Europe/Mariehamn
+    {7491, 4410}, // Europe/Minsk
+    {7504, 266}, // Europe/Monaco
+    {7518, 7532}, // Europe/Moscow
+    {7538, 266}, // Europe/Oslo
+    {7550, 266}, // Europe/Paris
+    {7563, 266}, // Europe/Podgorica
+    {7580, 266}, // Europe/Prague
+    {7594, 4956}, // Europe/Riga
+    {7606, 266}, // Europe/Rome
+    {7618, 4683}, // Europe/Samara
+    {7632, 266}, // Europe/San Marino
+    {7650, 266}, // Europe/Sarajevo
+    {7666, 4683}, // Europe/Saratov
+    {7681, 7532}, // Europe/Simferopol
+    {7699, 266}, // Europe/Skopje
+    {7713, 4956}, // Europe/Sofia
+    {7726, 266}, // Europe/Stockholm
+    {7743, 4956}, // Europe/Tallinn
+    {7758, 266}, // Europe/Tirane
+    {7772, 4683}, // Europe/Ulyanovsk
+    {7789, 4956}, // Europe/Uzhgorod
+    {7805, 266}, // Europe/Vaduz
+    {7818, 266}, // Europe/Vatican
+    {7833, 266}, // Europe/Vienna
+    {7847, 4956}, // Europe/Vilnius
+    {7862, 4683}, // Europe/Volgograd
+    {7879, 266}, // Europe/Warsaw
+    {7893, 266}, // Europe/Zagreb
+    {7907, 4956}, // Europe/Zaporozhye
+    {7925, 266}, // Europe/Zurich
+    {7939, 47}, // Indian/Antananarivo
+    {7959, 4486}, // Indian/Chagos
+    {7973, 4190}, // Indian/Christmas
+    {7990, 5916}, // Indian/Cocos
+    {8003, 47}, // Indian/Comoro
+    {8017, 4301}, // Indian/Kerguelen
+    {8034, 4683}, // Indian/Mahe
+    {8046, 4301}, // Indian/Maldives
+    {8062, 4683}, // Indian/Mauritius
+    {8079, 47}, // Indian/Mayotte
+    {8094, 4683}, // Indian/Reunion
+    {8109, 8122}, // Pacific/Apia
+    {8154, 4328}, // Pacific/Auckland
+    {8171, 4164}, // Pacific/Bougainville
+    {8192, 8208}, // Pacific/Chatham
+    {8253, 4224}, // Pacific/Chuuk
+    {8267, 8282}, // Pacific/Easter
+    {8314, 4164}, // Pacific/Efate
+    {8328, 6755}, // Pacific/Enderbury
+    {8346, 6755}, // Pacific/Fakaofo
+    {8362, 8375}, // Pacific/Fiji
+    {8407, 4589}, // Pacific/Funafuti
+    {8424, 6633}, // Pacific/Galapagos
+    {8442, 6684}, // Pacific/Gambier
+    {8458, 4164}, // Pacific/Guadalcanal
+    {8478, 8491}, // Pacific/Guam
+    {8499, 8516}, // Pacific/Honolulu
+    {8522, 6775}, // Pacific/Kiritimati
+    {8541, 4164}, // Pacific/Kosrae
+    {8556, 4589}, // Pacific/Kwajalein
+    {8574, 4589}, // Pacific/Majuro
+    {8589, 8607}, // Pacific/Marquesas
+    {8619, 8634}, // Pacific/Midway
+    {8640, 4589}, // Pacific/Nauru
+    {8654, 6556}, // Pacific/Niue
+    {8667, 8683}, // Pacific/Norfolk
+    {8714, 4164}, // Pacific/Noumea
+    {8729, 8634}, // Pacific/Pago Pago
+    {8747, 4802}, // Pacific/Palau
+    {8761, 6667}, // Pacific/Pitcairn
+    {8778, 4164}, // Pacific/Pohnpei
+    {8794, 4224}, // Pacific/Port Moresby
+    {8815, 6537}, // Pacific/Rarotonga
+    {8833, 8491}, // Pacific/Saipan
+    {8848, 6537}, // Pacific/Tahiti
+    {8863, 4589}, // Pacific/Tarawa
+    {8878, 6755}, // Pacific/Tongatapu
+    {8896, 4589}, // Pacific/Wake
+    {8909, 4589}, // Pacific/Wallis
+};
+
+const uint16_t timezoneByName[TIMEZONE_COUNT] PROGMEM = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 166, 165, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 349, 348, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+};
@@ -0,0 +1,124 @@
+#include "Transitions.h"
+
+namespace
+{
+  // Spreads `count` steps evenly over `span`.
+  uint16_t stepFor(uint16_t span, int count)
+  {
+    return count > 1 ? span / (count - 1) : 0;
+  }
+
+  template <typename TGrid>
+  uint16_t typewriterDelays(ClockFaceT<TGrid> &clockFace, uint16_t duration, uint16_t *delays)
+  {
+    const std::vector<bool> &state = clockFace.getState();
+    const std::vector<bool> &previous = clockFace.getPreviousState();
+    const uint16_t fade = duration / 4;
+
+    int appearing = 0;
+    for (int i = 0; i < TGrid::PixelCount; i++)
+      appearing += state[i] && !previous[i];
+    const uint16_t step = stepFor(duration - fade, appearing);
+
+    // Letters that go out, or don't change, all start right away.
+    for (int i = 0; i < TGrid::PixelCount; i++)
+      delays[i] = 0;
+
+    // Letters that come in follow the reading order, minute corners last.
+    uint16_t next = 0;
+    for (int y = 0; y < TGrid::Height; y++)
+    {
+      for (int x = 0; x < TGrid::Width; x++)
+      {
+        uint16_t pixel = clockFace.pixelAt(x, y);
+        if (state[pixel] && !previous[pixel])
+        {
+          delays[pixel] = next;
+          next += step;
+        }
+      }
+    }
+    for (int pixel = 0; pixel < TGrid::Signals; pixel++)
+    {
+      if (state[pixel] && !previous[pixel])
+      {
+        delays[pixel] = next;
+        next += step;
+      }
+    }
+    return fade;
+  }
+
+  template <typename TGrid>
+  uint16_t wipeDelays(ClockFaceT<TGrid> &clockFace, bool rows, uint16_t duration, uint16_t *delays)
+  {
+    const uint16_t fade = duration / 3;
+    const int lines = rows ? TGrid::Height : TGrid::Width;
+    const uint16_t step = stepFor(duration - fade, lines);
+
+    for (int i = 0; i < TGrid::PixelCount; i++)
+      delays[i] = step * (rows ? clockFace.pixelY(i) : clockFace.pixelX(i));
+    return fade;
+  }
+
+  template <typename TGrid>
+  uint16_t wordDissolveDelays(ClockFaceT<TGrid> &clockFace, uint16_t duration, uint16_t *delays)
+  {
+    const std::vector<bool> &state = clockFace.getState();
+    const std::vector<bool> &previous = clockFace.getPreviousState();
+    const uint16_t fade = duration / 4;
+    const uint16_t half = duration / 2;
+
+    // The minute corners are not words; they go as a group after the words.
+    const int outGroups = clockFace.previousSegmentCount() + 1;
+    const int inGroups = clockFace.segmentCount() + 1;
+    const uint16_t outStep = stepFor(half - fade, outGroups);
+    const uint16_t inStep = stepFor(half - fade, inGroups);
+
+    for (int i = 0; i < TGrid::PixelCount; i++)
+    {
+      if (previous[i] && !state[i])
+      {
+        uint8_t word = clockFace.previousSegmentOf(i);
+        delays[i] = outStep * (word > 0 ? word - 1 : outGroups - 1);
+      }
+      else if (state[i] && !previous[i])
+      {
+        uint8_t word = clockFace.segmentOf(i);
+        delays[i] = half + inStep * (word > 0 ? word - 1 : inGroups - 1);
+      }
+      else
+      {
+        delays[i] = 0;
+      }
+    }
+    return fade;
+  }
+} // namespace
+
+template <typename TGrid>
+uint16_t buildTransitionDelays(TransitionStyle style, ClockFaceT<TGrid> &clockFace,
+                               uint16_t duration, uint16_t *delays)
+{
+  switch (style)
+  {
+  case TransitionStyle::TYPEWRITER:
+    return typewriterDelays(clockFace, duration, delays);
+  case TransitionStyle::ROW_WIPE:
+    return wipeDelays(clockFace, true, duration, delays);
+  case TransitionStyle::COLUMN_WIPE:
+    return wipeDelays(clockFace, false, duration, delays);
+  case TransitionStyle::WORD_DISSOLVE:
+    return wordDissolveDelays(clockFace, duration, delays);
+  case TransitionStyle::FADE:
+  default:
+    for (int i = 0; i < TGrid::PixelCount; i++)
+      delays[i] = 0;
+    return duration;
+  }
+}
+
+#define INSTANTIATE_TRANSITIONS(grid)                                                 \
+  template uint16_t buildTransitionDelays(TransitionStyle style, ClockFaceT<grid> &clockFace, \
+                                          uint16_t duration, uint16_t *delays);
+FOR_EACH_GRID(INSTANTIATE_TRANSITIONS)
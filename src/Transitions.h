@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "ClockFace.h"
+
+const char transitionStyleOptions[] PROGMEM = "data-options='Fade|Typewriter|Row wipe|Column wipe|Word dissolve'";
+
+// How the clock face changes from one time to the next.
+enum class TransitionStyle {
+    // All pixels fade at once.
+    FADE,
+    // New letters appear one by one in reading order.
+    TYPEWRITER,
+    // The change sweeps from the top row to the bottom row.
+    ROW_WIPE,
+    // The change sweeps from the left column to the right column.
+    COLUMN_WIPE,
+    // Old words disappear one by one, then new words appear one by one.
+    WORD_DISSOLVE,
+
+    // Largest numeric value of a transition style.
+    MAX_VALUE = WORD_DISSOLVE,
+};
+
+// Computes the start delay [ms] of every pixel for a transition from the
+// previous to the current state of `clockFace`, so that the whole transition
+// takes `duration` [ms]. Returns the fade duration [ms] of a single pixel.
+//
+// Done once per transition; while the transition runs, a pixel only has to
+// compare its delay with the elapsed time.
+template <typename TGrid>
+uint16_t buildTransitionDelays(TransitionStyle style, ClockFaceT<TGrid> &clockFace,
+                               uint16_t duration, uint16_t *delays);
@@ -0,0 +1,250 @@
+#include <Arduino.h>
+
+#include "WebAssets.h"
+
+// This file was generated by tools/web_assets.py from the files in web/.
+
+// config.css: 2356 bytes, 955 compressed.
+const uint8_t webAssetConfigCss[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x55, 0xcb, 0x6e, 0xe3, 0x36,
+    0x14, 0xdd, 0xe7, 0x2b, 0x2e, 0x52, 0x0c, 0x90, 0xa4, 0x91, 0xfc, 0x4e, 0xa6, 0x32, 0x66, 0x80,
+    0x62, 0xd0, 0x45, 0x37, 0xdd, 0xcc, 0x00, 0x5d, 0x14, 0x83, 0x82, 0x12, 0xaf, 0x64, 0x22, 0xb4,
+    0x28, 0x90, 0x94, 0x1f, 0x35, 0xe6, 0xdf, 0x7b, 0x49, 0x4a, 0x0a, 0xe5, 0x28, 0x45, 0x65, 0x58,
+    0x86, 0xc9, 0xcb, 0xfb, 0x3c, 0xe7, 0x70, 0xf6, 0x00, 0x5f, 0xed, 0x59, 0x22, 0xa8, 0x12, 0xec,
+    0x0e, 0xa1, 0x50, 0x75, 0x29, 0xaa, 0x56, 0x33, 0x2b, 0x54, 0x0d, 0x0d, 0xab, 0xf0, 0x11, 0x0c,
+    0xea, 0x03, 0x72, 0x60, 0x06, 0x66, 0xcc, 0x18, 0xb4, 0x66, 0x16, 0xac, 0xd2, 0xc2, 0x18, 0xb8,
+    0x33, 0x88, 0x37, 0x00, 0x60, 0x95, 0x92, 0x66, 0x76, 0xc4, 0xfc, 0xef, 0x60, 0x93, 0x36, 0xe7,
+    0xfb, 0x14, 0x1e, 0x66, 0x37, 0xb3, 0x07, 0xf8, 0x46, 0x8e, 0x73, 0x66, 0x10, 0x4c, 0x1f, 0xea,
+    0x77, 0x65, 0xff, 0xc4, 0xfc, 0x0b, 0xb9, 0x79, 0x84, 0x52, 0x69, 0x1f, 0xda, 0x05, 0x03, 0x8d,
+    0x35, 0x47, 0x4d, 0xd1, 0xf2, 0xb3, 0x33, 0xfa, 0x12, 0x02, 0x39, 0x3f, 0x29, 0x47, 0xb8, 0xe4,
+    0xac, 0x78, 0xa9, 0xb4, 0x6a, 0x6b, 0x9e, 0x14, 0x4a, 0x2a, 0x9d, 0xc1, 0x4f, 0x65, 0xc9, 0xe8,
+    0xd9, 0xfe, 0xb8, 0x49, 0x71, 0x0f, 0x97, 0x52, 0xd5, 0x36, 0x31, 0xe2, 0x1f, 0xcc, 0x60, 0x9e,
+    0x7e, 0xc4, 0xfd, 0x16, 0x7a, 0xbb, 0x3c, 0x9f, 0xd3, 0xb3, 0xa5, 0x30, 0x9c, 0x8b, 0xba, 0x4a,
+    0x72, 0x65, 0xad, 0xda, 0x93, 0x59, 0x73, 0x72, 0x87, 0x0b, 0xb8, 0x58, 0x3c, 0xd9, 0x84, 0x49,
+    0x51, 0xd5, 0x19, 0x14, 0x58, 0x5b, 0xd4, 0xb4, 0xc1, 0xc5, 0xe1, 0x11, 0x44, 0xdd, 0xb4, 0xd6,
+    0x35, 0x42, 0x62, 0x61, 0xe1, 0xd2, 0xb9, 0xc8, 0x60, 0x43, 0x67, 0x21, 0x0a, 0xb9, 0xa0, 0x80,
+    0x3f, 0x6e, 0xbc, 0x35, 0x5c, 0x8e, 0x82, 0xdb, 0x5d, 0x06, 0xbf, 0x6c, 0x3e, 0xd0, 0x5a, 0x7f,
+    0xb4, 0x5b, 0x5c, 0xcc, 0xe7, 0x1f, 0x7a, 0xcb, 0xbf, 0xec, 0xb9, 0xc1, 0x4f, 0xc5, 0x0e, 0x8b,
+    0x97, 0x5c, 0x9d, 0xbe, 0x0f, 0x36, 0xac, 0xb5, 0x6a, 0x0b, 0xa6, 0x60, 0xd2, 0x79, 0x4e, 0x37,
+    0x5b, 0xd8, 0x33, 0x5d, 0x89, 0xda, 0x9d, 0xf6, 0x39, 0xe7, 0x8a, 0x9f, 0x27, 0xb3, 0x0e, 0x29,
+    0x95, 0x6c, 0x2f, 0xe4, 0x39, 0x83, 0x03, 0x6a, 0xce, 0x6a, 0xd7, 0xa1, 0xbc, 0xa5, 0x92, 0x6b,
+    0xb8, 0xd0, 0xbc, 0x72, 0xa5, 0xa9, 0xcf, 0x54, 0xfd, 0x76, 0xf8, 0x93, 0x68, 0xc6, 0x45, 0x6b,
+    0x5c, 0xe3, 0x56, 0x9a, 0x0a, 0x71, 0x1b, 0x6f, 0xdb, 0xbd, 0x78, 0xfa, 0x75, 0xf1, 0xdb, 0xb3,
+    0xdb, 0x7c, 0x1d, 0x40, 0xe9, 0xfe, 0x4a, 0x51, 0x63, 0xb2, 0x43, 0x51, 0xed, 0x6c, 0x06, 0xcb,
+    0x74, 0xdd, 0xb9, 0x88, 0xbb, 0x93, 0x2e, 0xbb, 0xc5, 0x71, 0x17, 0x4a, 0x81, 0x92, 0x13, 0x66,
+    0x68, 0xbc, 0x93, 0x89, 0x0c, 0x75, 0x87, 0xb2, 0xbb, 0xba, 0xa3, 0x0c, 0x10, 0xd1, 0x79, 0x1d,
+    0xcc, 0xc6, 0xa9, 0xbb, 0xa4, 0x97, 0xee, 0xd3, 0xa7, 0x13, 0x02, 0x83, 0x39, 0x1b, 0x8b, 0xfb,
+    0xa4, 0x15, 0xe4, 0x93, 0x8d, 0xfc, 0x2d, 0x9e, 0xd8, 0x02, 0x9f, 0xc3, 0xf0, 0xfd, 0xc6, 0x30,
+    0xf0, 0xb9, 0x83, 0x8a, 0x54, 0x95, 0xf2, 0xcb, 0x5d, 0x19, 0x1f, 0xe7, 0x87, 0x63, 0x88, 0x7f,
+    0x4a, 0xfa, 0xca, 0x9e, 0x5c, 0xae, 0xb4, 0xc6, 0x85, 0x69, 0x24, 0xa3, 0x29, 0xe4, 0x52, 0x15,
+    0x2f, 0xde, 0x4a, 0x9c, 0x92, 0x5c, 0x12, 0xcc, 0x93, 0xbd, 0xe2, 0xd4, 0x95, 0x7d, 0x2b, 0xad,
+    0x68, 0xe4, 0xb9, 0xf7, 0x4c, 0x90, 0xb7, 0x8c, 0x7a, 0xa9, 0xc3, 0x9c, 0xa2, 0x32, 0x8e, 0x3b,
+    0x61, 0x7d, 0xa1, 0x56, 0xb3, 0xda, 0x08, 0xc7, 0xd0, 0x2c, 0x32, 0x80, 0x95, 0x19, 0x45, 0x14,
+    0xb5, 0x1f, 0xc9, 0x6b, 0xe0, 0xae, 0x3d, 0x6b, 0x4a, 0x2d, 0x80, 0x6b, 0xb2, 0xb2, 0x21, 0x3e,
+    0x31, 0x73, 0x18, 0x8c, 0x07, 0xc9, 0x29, 0x31, 0x3b, 0xc6, 0xd5, 0xd1, 0x0f, 0xc2, 0x7f, 0x17,
+    0x1b, 0xf7, 0xa2, 0xaf, 0x03, 0x01, 0x3d, 0xcf, 0xdc, 0x79, 0x69, 0x8e, 0x56, 0x55, 0x15, 0x11,
+    0x7d, 0xdc, 0x3a, 0xcf, 0x16, 0xb7, 0xa2, 0xfa, 0xdc, 0x59, 0x6e, 0x94, 0x6c, 0x43, 0x4d, 0x3a,
+    0x00, 0x67, 0x15, 0x6c, 0xac, 0x6a, 0x42, 0xa2, 0xdb, 0x08, 0xab, 0xb5, 0xaa, 0xf1, 0x7a, 0xb4,
+    0xbe, 0x15, 0x0d, 0x23, 0xd9, 0xb0, 0x6e, 0xab, 0xc7, 0xdf, 0x6a, 0x1d, 0x8e, 0xaa, 0xd6, 0xba,
+    0x26, 0x74, 0x67, 0x63, 0xa8, 0xc5, 0xa9, 0xad, 0x87, 0x5a, 0x96, 0x5d, 0xc8, 0xd0, 0xab, 0x41,
+    0x23, 0xfe, 0x4f, 0x26, 0xb9, 0x64, 0xa1, 0xcf, 0xd7, 0x20, 0x1e, 0xd7, 0xac, 0x51, 0x92, 0xb6,
+    0x1e, 0x30, 0xa2, 0x01, 0x31, 0xbc, 0xb8, 0x23, 0x48, 0x1e, 0x8e, 0x90, 0x38, 0x68, 0x36, 0xa7,
+    0xfb, 0x2b, 0x38, 0xad, 0xd7, 0x01, 0xfa, 0x43, 0xfa, 0x9f, 0x61, 0x80, 0xe6, 0xa4, 0xe7, 0x11,
+    0x15, 0xa2, 0x19, 0xc7, 0xf8, 0x28, 0x25, 0xfa, 0xa2, 0xdc, 0x6f, 0xc2, 0x85, 0x26, 0x7d, 0xf2,
+    0x7e, 0x88, 0x05, 0xed, 0xbe, 0xee, 0xd5, 0xe9, 0x55, 0xf5, 0xde, 0x75, 0xdb, 0xcd, 0x35, 0x96,
+    0xad, 0x37, 0x7a, 0x10, 0xf2, 0x8f, 0xf4, 0xee, 0x96, 0x06, 0x57, 0xe1, 0xed, 0xf7, 0xc8, 0x6f,
+    0x22, 0xb1, 0x74, 0xb3, 0x9b, 0x5f, 0xe3, 0x24, 0xae, 0x6c, 0x04, 0xd8, 0x09, 0x7f, 0x59, 0x8e,
+    0x74, 0xa1, 0x60, 0xc7, 0x67, 0x92, 0x43, 0xc7, 0x77, 0x66, 0xad, 0xbe, 0xe3, 0xcc, 0xb2, 0x44,
+    0xb2, 0x1c, 0xe5, 0xfd, 0xf6, 0xad, 0x78, 0x4c, 0xa3, 0x32, 0x64, 0x94, 0xac, 0xae, 0xd9, 0x1c,
+    0xb8, 0x15, 0x55, 0xbd, 0xec, 0x9a, 0x30, 0x55, 0xb5, 0x8f, 0x09, 0x97, 0x41, 0xbd, 0x1d, 0xd0,
+    0x02, 0x1b, 0x68, 0x0f, 0x2b, 0x92, 0x82, 0x57, 0xaa, 0x65, 0xa5, 0xd0, 0xc6, 0x26, 0xc5, 0x4e,
+    0x48, 0x9e, 0xb1, 0xd2, 0x76, 0x32, 0xe0, 0x55, 0xf4, 0xd8, 0xb9, 0x95, 0xee, 0x87, 0x64, 0xfe,
+    0xcd, 0x68, 0xc7, 0x5a, 0x1b, 0xa4, 0x76, 0xe2, 0x7a, 0x78, 0xb7, 0x5a, 0xcf, 0xba, 0xc5, 0xe6,
+    0x3d, 0xe5, 0x0a, 0xcd, 0x98, 0x47, 0x6c, 0x9d, 0x0f, 0x11, 0x3c, 0x0f, 0xa9, 0xf1, 0x44, 0x96,
+    0xb6, 0x69, 0x50, 0x17, 0x74, 0xdd, 0x47, 0x80, 0x9d, 0x2a, 0x6b, 0x98, 0xce, 0xed, 0x1f, 0x68,
+    0x8f, 0x4a, 0xbf, 0xdc, 0x4e, 0x5d, 0x51, 0x63, 0x1e, 0xfd, 0x67, 0x2c, 0x5a, 0x81, 0x9f, 0x03,
+    0x31, 0x86, 0xbe, 0x2c, 0xbd, 0x54, 0x75, 0x3d, 0xef, 0xef, 0xcc, 0xc0, 0x1e, 0xff, 0xce, 0x24,
+    0xeb, 0xf3, 0x8a, 0x91, 0xe8, 0x3b, 0x91, 0xf4, 0x6a, 0x50, 0x4a, 0xc5, 0x28, 0x4f, 0x5f, 0x34,
+    0xf9, 0xf8, 0x17, 0x5d, 0xdc, 0x81, 0xe0, 0x34, 0x09, 0x00, 0x00,
+};
+
+// config.js: 4754 bytes, 1533 compressed.
+const uint8_t webAssetConfigJs[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0xdd, 0x6e, 0xdb, 0x36,
+    0x14, 0xbe, 0xef, 0x53, 0xb0, 0x2a, 0xd0, 0x4a, 0xa8, 0x2b, 0x67, 0x17, 0xbb, 0xa9, 0xe1, 0x15,
+    0x59, 0x56, 0x6c, 0x05, 0xfa, 0x87, 0x25, 0xbb, 0x0a, 0x82, 0x82, 0x96, 0x8e, 0x6d, 0xa5, 0x32,
+    0xa9, 0x8a, 0x94, 0x5d, 0x67, 0xc9, 0xc5, 0x9e, 0x60, 0xd8, 0xb0, 0xfb, 0xbd, 0xc6, 0xde, 0x6a,
+    0x7b, 0x84, 0x9d, 0xc3, 0x1f, 0x89, 0x72, 0x2c, 0xcf, 0x5d, 0x80, 0x24, 0x22, 0x79, 0xfe, 0x7f,
+    0x3e, 0x1e, 0x8e, 0xc7, 0xec, 0x3c, 0xab, 0x8b, 0x4a, 0x33, 0x39, 0x67, 0x7a, 0x09, 0x2c, 0x93,
+    0x62, 0x5e, 0x2c, 0x9a, 0x9a, 0xeb, 0x42, 0x0a, 0x56, 0xf1, 0x05, 0x8c, 0x98, 0x82, 0x7a, 0x0d,
+    0x39, 0xe3, 0x8a, 0x8d, 0xb9, 0x52, 0xa0, 0xd5, 0xd8, 0x52, 0xa5, 0xd7, 0x8a, 0xc5, 0x0a, 0xe0,
+    0xc1, 0x78, 0xcc, 0xb4, 0x94, 0xa5, 0x1a, 0x6f, 0x60, 0xf6, 0xc1, 0x92, 0xa4, 0xd5, 0x36, 0x49,
+    0x1f, 0xe4, 0x32, 0x6b, 0x56, 0x20, 0x74, 0xca, 0xf3, 0xfc, 0xe5, 0x1a, 0x3f, 0x5e, 0x17, 0x4a,
+    0x83, 0x80, 0x3a, 0x8e, 0xbe, 0x7b, 0xf7, 0xe6, 0x4c, 0x0a, 0x4d, 0x7b, 0x92, 0xe7, 0x90, 0x47,
+    0x23, 0x36, 0x6f, 0x44, 0x66, 0xd4, 0xc6, 0x09, 0xfb, 0xf9, 0x01, 0x63, 0x6b, 0x5e, 0xb3, 0x92,
+    0xcf, 0xa0, 0x64, 0x53, 0xd6, 0x4a, 0xfa, 0xd4, 0x40, 0xbd, 0x3d, 0x87, 0x12, 0x32, 0x2d, 0x51,
+    0x8c, 0x39, 0xbf, 0x9c, 0xcb, 0x7a, 0x5a, 0x6c, 0xb2, 0x8b, 0x65, 0x21, 0x16, 0x6f, 0xf9, 0x0a,
+    0xae, 0xa2, 0x64, 0x82, 0x02, 0x8a, 0x39, 0x8b, 0x0d, 0x41, 0x62, 0xe5, 0xa4, 0x85, 0x40, 0xdd,
+    0x17, 0xf0, 0x59, 0xa3, 0xc4, 0xe8, 0xac, 0x94, 0xd9, 0x47, 0x26, 0x90, 0x3c, 0x22, 0xe2, 0x2f,
+    0xd2, 0x74, 0x5a, 0xbd, 0x47, 0x3f, 0x37, 0xb2, 0xce, 0x8f, 0x52, 0x75, 0xfa, 0x1e, 0x43, 0x69,
+    0xe9, 0x91, 0x4c, 0x2e, 0x0a, 0xf1, 0x9c, 0xf1, 0x7c, 0x55, 0x88, 0x04, 0x55, 0x23, 0x37, 0x06,
+    0xf0, 0x94, 0xcd, 0x1a, 0xad, 0xd1, 0x79, 0x2d, 0x99, 0x5a, 0xca, 0x0d, 0xe3, 0x22, 0x67, 0xcb,
+    0x22, 0x07, 0x06, 0x6b, 0xb4, 0xa3, 0xe5, 0x4f, 0x91, 0x7c, 0xbf, 0x89, 0xa7, 0x65, 0x19, 0x47,
+    0x85, 0xa8, 0x1a, 0x7d, 0xa9, 0xb7, 0x15, 0x4c, 0xab, 0xce, 0xc2, 0x14, 0xcd, 0x7e, 0xc9, 0xb3,
+    0x65, 0xdc, 0x85, 0xd8, 0x10, 0xda, 0x38, 0xdb, 0x48, 0x6b, 0xb9, 0x58, 0x94, 0x10, 0x06, 0x20,
+    0xab, 0x81, 0x6b, 0x78, 0x59, 0x02, 0xad, 0x9c, 0x68, 0xeb, 0x2d, 0x73, 0xd4, 0x69, 0x56, 0xa2,
+    0x12, 0x4a, 0x2a, 0x65, 0x38, 0x8e, 0xaa, 0x8d, 0xdd, 0xdf, 0xa1, 0x22, 0x73, 0x28, 0x0c, 0xd6,
+    0xc3, 0xa8, 0x77, 0xb6, 0xe6, 0x65, 0x63, 0x0e, 0xff, 0xf9, 0xf3, 0xb7, 0x5f, 0xfe, 0xfe, 0xeb,
+    0x57, 0x77, 0x6a, 0x94, 0x61, 0x10, 0xb1, 0xf6, 0xf4, 0x69, 0x7e, 0xcd, 0x33, 0x34, 0xa1, 0xb5,
+    0x84, 0xcf, 0x35, 0xd4, 0x20, 0xa8, 0x66, 0xac, 0x94, 0xbe, 0x3a, 0x29, 0xb2, 0xb2, 0xc0, 0xd4,
+    0x4e, 0xef, 0x55, 0x94, 0x91, 0x3c, 0x77, 0xce, 0x3b, 0xb3, 0xa6, 0xa8, 0xdb, 0x87, 0x2a, 0xea,
+    0xc8, 0xbc, 0x09, 0xde, 0x76, 0x8d, 0xa9, 0x74, 0xb6, 0xed, 0xb7, 0xfe, 0x8f, 0xdf, 0xdb, 0xe3,
+    0x3b, 0x06, 0xa5, 0x82, 0x41, 0x51, 0xad, 0xb6, 0x43, 0xe2, 0xc2, 0x60, 0xa0, 0x44, 0xf3, 0xff,
+    0x8e, 0x96, 0x77, 0x89, 0x29, 0x19, 0x4a, 0x19, 0x66, 0x75, 0x75, 0xa0, 0x62, 0xe9, 0xb8, 0xab,
+    0x4e, 0x5a, 0x79, 0xf7, 0xe8, 0x7b, 0x4f, 0x4f, 0xaa, 0x66, 0xb6, 0x2a, 0xf4, 0x9e, 0x4e, 0xf4,
+    0x35, 0xe2, 0x4a, 0x74, 0x58, 0xa5, 0x25, 0xb0, 0xf5, 0x67, 0xa5, 0x5d, 0xf9, 0x5a, 0x60, 0x8e,
+    0xbb, 0xdf, 0x19, 0xe7, 0x7c, 0x8d, 0x3d, 0x9b, 0xa6, 0x69, 0xb4, 0x43, 0x65, 0x23, 0x72, 0xaa,
+    0x75, 0x5d, 0xe0, 0x0e, 0xc4, 0x51, 0x5e, 0x28, 0x3e, 0x2b, 0x0d, 0x50, 0xe8, 0xba, 0xf1, 0x29,
+    0xbf, 0x33, 0xff, 0xef, 0x5c, 0x13, 0xe5, 0x5c, 0xf3, 0x67, 0xb2, 0x22, 0xd3, 0xd5, 0xf4, 0x09,
+    0xbf, 0x9d, 0xdd, 0x7e, 0x5f, 0xcb, 0xa6, 0x1a, 0x67, 0xb7, 0xa8, 0xe1, 0x09, 0xd3, 0x4d, 0x2d,
+    0x94, 0x81, 0x39, 0x93, 0x10, 0xfc, 0x8b, 0xcd, 0xc6, 0x11, 0xdf, 0xc8, 0x7c, 0x87, 0x80, 0x56,
+    0x90, 0x95, 0xc1, 0x44, 0xb3, 0x9a, 0x41, 0xad, 0x52, 0xf6, 0xce, 0xca, 0x64, 0x9b, 0x42, 0x2f,
+    0x91, 0x23, 0x1a, 0x47, 0x8c, 0xd7, 0xc0, 0x16, 0x24, 0x1d, 0xa1, 0x71, 0xb6, 0x65, 0x9b, 0x25,
+    0xd7, 0x88, 0x9e, 0x2b, 0x50, 0x6c, 0x06, 0x18, 0x5f, 0xd4, 0xa1, 0x8f, 0xea, 0xd5, 0xd0, 0xe6,
+    0x23, 0x5b, 0xd5, 0x97, 0x89, 0x2d, 0x2b, 0xb3, 0x9a, 0xb4, 0x87, 0x4e, 0x54, 0x7b, 0xbc, 0x00,
+    0x1d, 0x46, 0x31, 0xd0, 0x86, 0xca, 0x54, 0x55, 0x16, 0xd8, 0x50, 0xb7, 0x3e, 0x49, 0x24, 0xc0,
+    0x85, 0x63, 0x18, 0x08, 0x2c, 0x81, 0x67, 0xb1, 0xab, 0x94, 0x70, 0xb4, 0xd5, 0x49, 0x8b, 0xde,
+    0x69, 0x91, 0xb7, 0x67, 0x45, 0xee, 0x3a, 0x1c, 0x6b, 0xd2, 0x39, 0x42, 0x2d, 0x88, 0xad, 0xe7,
+    0x68, 0x79, 0x55, 0x61, 0x6f, 0x9f, 0x2d, 0x8b, 0x32, 0x8f, 0x87, 0x4c, 0xb0, 0x1e, 0x44, 0x89,
+    0xed, 0x05, 0x6b, 0xb7, 0x49, 0x06, 0xaa, 0x11, 0x4d, 0x59, 0x5a, 0x15, 0xce, 0xcf, 0x3d, 0x21,
+    0xa5, 0x6e, 0x1e, 0xa1, 0x41, 0x39, 0x7c, 0xee, 0x57, 0x78, 0xc5, 0x6b, 0x4d, 0xb1, 0x23, 0x02,
+    0x1f, 0x9d, 0x71, 0x57, 0xc2, 0xe1, 0x95, 0x44, 0x24, 0x93, 0x00, 0x54, 0x0c, 0x6b, 0x5a, 0x82,
+    0x58, 0x60, 0x8d, 0x7c, 0xc3, 0xbe, 0x0a, 0xb1, 0x84, 0xf8, 0x5c, 0x84, 0x2c, 0x19, 0x89, 0xce,
+    0x20, 0x3e, 0x19, 0x21, 0xdd, 0xe5, 0xc9, 0x55, 0x87, 0x04, 0x24, 0xe9, 0xa1, 0x75, 0xe5, 0xf6,
+    0xd6, 0xf2, 0x3c, 0x9c, 0x5a, 0xdf, 0x52, 0x77, 0xc1, 0x74, 0x62, 0x2d, 0xb9, 0x39, 0xdc, 0x1b,
+    0x3e, 0x7b, 0x32, 0x09, 0xe8, 0x7d, 0x90, 0x0e, 0x04, 0xd6, 0x90, 0x44, 0xf7, 0xb9, 0x52, 0xef,
+    0x78, 0x97, 0xdd, 0x0e, 0x9a, 0xe8, 0xc7, 0x9f, 0x5b, 0x0f, 0xaf, 0x65, 0x21, 0xe2, 0x88, 0x8d,
+    0x59, 0x27, 0xca, 0xe1, 0x62, 0x60, 0x73, 0xe7, 0xca, 0x11, 0xd6, 0xdf, 0x4f, 0x70, 0xa7, 0xbd,
+    0xab, 0xfc, 0xc3, 0xce, 0x99, 0xaa, 0xf1, 0xcc, 0x76, 0x9d, 0x76, 0xed, 0x84, 0xe5, 0xb0, 0x73,
+    0x16, 0x82, 0x95, 0xf1, 0x6f, 0xd2, 0xbb, 0x46, 0x90, 0x01, 0xcb, 0xd7, 0x36, 0x64, 0xe2, 0x79,
+    0xee, 0x41, 0x97, 0xf5, 0x0d, 0xa1, 0xab, 0xd5, 0x1c, 0xb7, 0x19, 0xb6, 0x67, 0x49, 0xcf, 0x71,
+    0x2b, 0xa7, 0x87, 0x70, 0xc7, 0x66, 0x3a, 0xbc, 0x3c, 0x73, 0xf6, 0x14, 0x1b, 0xeb, 0x59, 0x7e,
+    0xcc, 0x95, 0x6a, 0x31, 0x6b, 0x06, 0x38, 0x9a, 0x44, 0x23, 0x6f, 0x54, 0xc8, 0x87, 0x49, 0xed,
+    0xe8, 0xd3, 0x1a, 0x56, 0x72, 0x0d, 0x56, 0xb5, 0x85, 0xa7, 0xe0, 0x6a, 0x42, 0xfc, 0x3c, 0xc7,
+    0x09, 0xc6, 0x22, 0xad, 0x0d, 0x2e, 0x62, 0x2b, 0xe2, 0x6c, 0x89, 0xe3, 0x4c, 0x3d, 0x62, 0xb2,
+    0x46, 0x6c, 0x54, 0xae, 0x5c, 0xe6, 0xb5, 0x5c, 0x59, 0xdc, 0x36, 0x6b, 0x07, 0xdb, 0x04, 0xd7,
+    0xc7, 0x4f, 0x3a, 0x35, 0x17, 0x0b, 0x38, 0x12, 0x3b, 0xad, 0x96, 0x43, 0xe8, 0x68, 0x29, 0x7c,
+    0xae, 0x5a, 0x7a, 0xf7, 0xf1, 0xf8, 0xb1, 0xfb, 0xda, 0x8b, 0x9d, 0x4d, 0x85, 0x22, 0x60, 0x68,
+    0xf2, 0x30, 0x1a, 0xd5, 0x80, 0xc6, 0x68, 0xd4, 0x6f, 0x24, 0xc5, 0x5e, 0xb8, 0x8f, 0x4b, 0x8c,
+    0xbd, 0x82, 0x57, 0x98, 0xa6, 0x00, 0xf0, 0x11, 0x38, 0x4e, 0x92, 0x2b, 0xaa, 0xa0, 0x60, 0x93,
+    0x3d, 0x0f, 0x57, 0xbe, 0x80, 0xc2, 0x34, 0x4a, 0x61, 0xaf, 0xbe, 0xa9, 0x33, 0xd5, 0x9e, 0xd9,
+    0xef, 0x38, 0xd9, 0x99, 0x2f, 0x84, 0xee, 0x41, 0x05, 0xc6, 0xca, 0xe5, 0xff, 0xdb, 0xed, 0x2b,
+    0x9c, 0xf6, 0xf0, 0xf8, 0x03, 0x08, 0x7b, 0x29, 0xb7, 0x63, 0x06, 0x6e, 0x86, 0xe1, 0xa6, 0x51,
+    0xf6, 0xad, 0x11, 0xd3, 0x45, 0xc4, 0xf1, 0x74, 0x81, 0x39, 0x90, 0xe5, 0x47, 0x64, 0xd8, 0x88,
+    0x3d, 0xd2, 0x05, 0x8e, 0xe9, 0xff, 0x99, 0xe0, 0xa1, 0x72, 0x55, 0x7a, 0x8b, 0xd3, 0x15, 0x4e,
+    0x10, 0x55, 0xc9, 0xb7, 0x68, 0x8b, 0xb3, 0x00, 0x23, 0x1c, 0x09, 0x29, 0x20, 0xc2, 0xb8, 0x45,
+    0xdd, 0xac, 0xd5, 0x76, 0xe9, 0xa0, 0xe7, 0x64, 0xcd, 0x0d, 0x31, 0x26, 0xc7, 0x2b, 0x32, 0x4a,
+    0x8c, 0xb6, 0x5e, 0x5a, 0x30, 0x5e, 0x7b, 0x26, 0xb1, 0x6c, 0x49, 0x25, 0xbd, 0x3b, 0x89, 0xf9,
+    0x68, 0x52, 0x90, 0x3d, 0x6a, 0x4d, 0xf1, 0x02, 0x99, 0xb4, 0x36, 0x0f, 0x11, 0x04, 0x33, 0xd2,
+    0x05, 0x36, 0x25, 0x3e, 0x41, 0x24, 0xd3, 0xfc, 0x23, 0x28, 0xf7, 0xe8, 0x2b, 0xb1, 0x27, 0xfd,
+    0x0b, 0x90, 0x9e, 0x45, 0xa9, 0xab, 0x00, 0x7b, 0x32, 0x3c, 0xef, 0x05, 0x4d, 0x68, 0x48, 0x83,
+    0xd7, 0x90, 0x59, 0xef, 0x96, 0xc2, 0x99, 0x93, 0xb7, 0xaf, 0x3d, 0x86, 0x74, 0xa4, 0x64, 0x2d,
+    0xbd, 0x15, 0x79, 0x81, 0xb1, 0xa1, 0xa1, 0xc5, 0x04, 0x79, 0xc6, 0xb3, 0x8f, 0x84, 0x7a, 0x88,
+    0x80, 0x4e, 0xa8, 0xd1, 0x18, 0x8e, 0x43, 0x2e, 0xc4, 0x76, 0xff, 0x7e, 0x90, 0xed, 0x83, 0x66,
+    0xd4, 0x19, 0x16, 0x04, 0xd1, 0xac, 0xe3, 0x7e, 0xe0, 0xd0, 0x4b, 0xbe, 0x04, 0x9e, 0xfb, 0x48,
+    0x51, 0x15, 0x30, 0x2a, 0x83, 0x91, 0x45, 0xb1, 0x31, 0xaf, 0x8a, 0xb1, 0xbe, 0x39, 0x7e, 0xea,
+    0xd3, 0x37, 0xc7, 0x82, 0x16, 0xda, 0x7c, 0xe0, 0x5e, 0x23, 0x61, 0x44, 0x12, 0x22, 0x11, 0x19,
+    0x47, 0x41, 0x39, 0x71, 0x30, 0x46, 0x6f, 0xb4, 0xde, 0x14, 0xc6, 0x9e, 0xe2, 0xdd, 0x60, 0xb8,
+    0x42, 0x7c, 0xe8, 0xa3, 0x93, 0x39, 0x1e, 0x79, 0xe6, 0xe4, 0xcb, 0x9e, 0x66, 0xc4, 0xd5, 0x63,
+    0x19, 0xce, 0xc0, 0xbe, 0x72, 0xc8, 0x4a, 0xe0, 0xf5, 0x05, 0x7a, 0x21, 0x1b, 0x1d, 0x1b, 0x6f,
+    0xda, 0xbe, 0xf4, 0xbe, 0xa1, 0xb1, 0x9e, 0x60, 0x9f, 0x04, 0x7c, 0xe7, 0x80, 0xc6, 0xc0, 0x46,
+    0x2e, 0x31, 0x2f, 0x3e, 0x4d, 0x23, 0xf4, 0x1a, 0x44, 0x26, 0x73, 0xf8, 0xe9, 0xc7, 0x57, 0x67,
+    0x72, 0x55, 0x61, 0xf6, 0xfa, 0xb8, 0x9a, 0x24, 0xc1, 0xdc, 0x93, 0x62, 0x9a, 0x45, 0x20, 0xbb,
+    0x06, 0x85, 0x1c, 0x0a, 0xa8, 0x17, 0x6b, 0xa0, 0xe7, 0x04, 0xf3, 0x5b, 0xe9, 0xb5, 0x92, 0x22,
+    0x36, 0xad, 0x78, 0x40, 0x00, 0x55, 0x8b, 0xea, 0x4f, 0x70, 0x3e, 0x37, 0x34, 0x68, 0xfc, 0x70,
+    0xf1, 0xe6, 0x35, 0xbd, 0x8a, 0xa2, 0x49, 0x8f, 0xc0, 0x70, 0xed, 0xa9, 0x13, 0xda, 0xdf, 0x15,
+    0xf6, 0x3f, 0x47, 0x21, 0xff, 0xb3, 0x33, 0x12, 0x91, 0x86, 0xb4, 0x3f, 0xef, 0x05, 0x36, 0x0f,
+    0xce, 0x2c, 0xed, 0x6c, 0xd8, 0x5b, 0x77, 0xab, 0x3b, 0xbc, 0xbd, 0xbe, 0x3e, 0xe9, 0x3f, 0xe1,
+    0xf0, 0x2f, 0xfd, 0xfe, 0x0b, 0x30, 0x69, 0xae, 0xab, 0x92, 0x12, 0x00, 0x00,
+};
+
+// logo.svg: 2923 bytes, 1121 compressed.
+const uint8_t webAssetLogoSvg[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x56, 0x4d, 0x6f, 0xdc, 0x36,
+    0x10, 0xbd, 0xf7, 0x57, 0x10, 0xe8, 0x41, 0x27, 0x72, 0x39, 0xc3, 0xe1, 0x57, 0xe0, 0xf5, 0xa1,
+    0xed, 0xa1, 0x40, 0x53, 0x14, 0xe8, 0xa5, 0x67, 0xc7, 0xb5, 0x2d, 0x03, 0x72, 0x13, 0x39, 0x0b,
+    0x6d, 0xea, 0x5f, 0xdf, 0x37, 0xa4, 0xec, 0xec, 0xae, 0x1d, 0xc0, 0x49, 0x4f, 0x39, 0xec, 0x62,
+    0x48, 0x0d, 0xe7, 0xe3, 0xf1, 0xcd, 0x93, 0xce, 0x3e, 0x2e, 0x37, 0xe6, 0xd3, 0xdd, 0xf4, 0xcf,
+    0xc7, 0xed, 0x30, 0xee, 0x76, 0x1f, 0xde, 0x6c, 0x36, 0xfb, 0xfd, 0xde, 0xed, 0x83, 0x7b, 0x7f,
+    0x7f, 0xb3, 0x61, 0xef, 0xfd, 0x06, 0x1e, 0x83, 0x59, 0x6e, 0xaf, 0xf6, 0x3f, 0xbd, 0xff, 0xb4,
+    0x1d, 0xbc, 0xf1, 0x46, 0x4a, 0xfb, 0x0d, 0xe7, 0x67, 0x1f, 0x2e, 0x76, 0xa3, 0xf9, 0x7b, 0x3b,
+    0xfc, 0x8e, 0xed, 0x11, 0x5b, 0x0b, 0x7e, 0xbf, 0xfa, 0x87, 0x61, 0x73, 0x7e, 0x76, 0x63, 0xae,
+    0x6f, 0xa7, 0x69, 0x3b, 0xfc, 0x78, 0x7d, 0x7d, 0x7d, 0xe8, 0x49, 0xd1, 0xbb, 0x54, 0xd9, 0x50,
+    0x0a, 0x4e, 0x88, 0x46, 0x9b, 0x5c, 0x4c, 0x61, 0xb2, 0x44, 0x2e, 0x32, 0xdb, 0x50, 0x1c, 0x0b,
+    0xcf, 0xd6, 0x15, 0xb6, 0xec, 0xa2, 0x58, 0x72, 0x25, 0x24, 0x38, 0x89, 0x4f, 0xb0, 0x3d, 0x25,
+    0x1b, 0x5c, 0x49, 0x59, 0xed, 0x18, 0xad, 0xb8, 0x24, 0x15, 0xce, 0xc9, 0x44, 0x47, 0x31, 0xe3,
+    0x48, 0x0e, 0xd1, 0x20, 0x16, 0xd7, 0xb7, 0x44, 0xd1, 0x15, 0x5a, 0x13, 0x7d, 0xce, 0x03, 0xc7,
+    0x1a, 0x6d, 0xcc, 0x8e, 0x7c, 0x1d, 0xb3, 0xf3, 0x81, 0xa6, 0xea, 0x3c, 0x8b, 0x09, 0xd1, 0x71,
+    0x0e, 0x33, 0x12, 0xe6, 0x68, 0xb2, 0x13, 0x66, 0xa3, 0xe1, 0xc4, 0x10, 0x02, 0x84, 0x62, 0x7a,
+    0x46, 0x9c, 0x93, 0x62, 0x82, 0x23, 0x8e, 0x16, 0x0f, 0x6a, 0x91, 0x89, 0xbc, 0xe3, 0x20, 0x36,
+    0x88, 0xcb, 0x9c, 0xd7, 0x90, 0xd8, 0xcb, 0xc2, 0x1a, 0xd3, 0xcb, 0x1a, 0x32, 0xe1, 0xbc, 0xe8,
+    0xc9, 0xd4, 0x42, 0xa6, 0x4c, 0xea, 0x62, 0x23, 0xba, 0xcc, 0xc8, 0x54, 0x28, 0x68, 0xc0, 0x48,
+    0x69, 0x2a, 0x1a, 0xd6, 0x86, 0x56, 0x69, 0x8f, 0xf7, 0x30, 0x98, 0x8b, 0xfb, 0xdb, 0x0b, 0x3b,
+    0x5d, 0xbc, 0xbb, 0x02, 0xa8, 0x7f, 0x29, 0xc2, 0x4f, 0x90, 0x72, 0x2a, 0x88, 0x96, 0x11, 0x14,
+    0x15, 0x50, 0x99, 0xbd, 0x86, 0xcf, 0x44, 0x68, 0xb9, 0x22, 0x23, 0x03, 0xd9, 0xc4, 0xba, 0x20,
+    0x41, 0x5f, 0x25, 0xb2, 0xa5, 0xea, 0x38, 0x96, 0xc7, 0x05, 0xbb, 0x44, 0xd9, 0x78, 0xdd, 0x95,
+    0xca, 0xe8, 0x30, 0x01, 0xa0, 0x04, 0xdc, 0xb5, 0x5b, 0xe0, 0xb9, 0xda, 0x88, 0x93, 0x6b, 0xf3,
+    0x43, 0xdb, 0xa2, 0xfd, 0xa0, 0x2b, 0xdd, 0x4d, 0x9e, 0xd7, 0x85, 0x1e, 0x4d, 0x06, 0x71, 0x62,
+    0x78, 0xb4, 0xd9, 0x05, 0x9f, 0x40, 0x1a, 0x4d, 0xc9, 0x9a, 0x91, 0xc2, 0xae, 0x97, 0xd2, 0xeb,
+    0x7a, 0xb8, 0xb3, 0x02, 0x08, 0x7c, 0x31, 0x5e, 0x0b, 0xef, 0xd1, 0xc4, 0x55, 0xc6, 0xcd, 0xe5,
+    0x56, 0x18, 0x16, 0x89, 0x70, 0xbf, 0x55, 0x5b, 0x14, 0x17, 0x00, 0x65, 0x5f, 0x68, 0xb9, 0x41,
+    0x43, 0x63, 0x13, 0x1c, 0x69, 0x9b, 0x3b, 0x71, 0x45, 0xc0, 0x9a, 0x76, 0x74, 0xf6, 0x9d, 0x56,
+    0xc1, 0x3e, 0xed, 0x4a, 0x52, 0xdb, 0x4b, 0xf7, 0xb6, 0x38, 0x0a, 0x20, 0xd6, 0x45, 0x6b, 0x5f,
+    0xfb, 0x13, 0x27, 0x31, 0xe8, 0x7d, 0x91, 0x32, 0xac, 0xa2, 0xee, 0xee, 0xd0, 0x6d, 0x6a, 0xdc,
+    0x38, 0xb9, 0x91, 0x3f, 0x8e, 0x6e, 0x84, 0xa2, 0x38, 0x02, 0x11, 0x59, 0x04, 0x17, 0x2a, 0x73,
+    0xab, 0x91, 0x64, 0xc5, 0x44, 0x21, 0x6b, 0x76, 0x4c, 0xca, 0x33, 0xdc, 0x0d, 0xb3, 0xf3, 0xb9,
+    0xdb, 0xa3, 0x32, 0xb4, 0xf0, 0xd2, 0x18, 0x4a, 0x23, 0x92, 0xc5, 0x19, 0x80, 0x07, 0x14, 0x66,
+    0x18, 0xa4, 0xf2, 0x01, 0x7e, 0xa1, 0x84, 0x5d, 0xfb, 0xd7, 0xad, 0xc4, 0x11, 0x20, 0x2a, 0x4d,
+    0x58, 0x79, 0xd8, 0x9b, 0xa6, 0xac, 0xcc, 0x4a, 0x4a, 0xd2, 0xd4, 0x26, 0x08, 0x18, 0x17, 0xfd,
+    0x4f, 0x48, 0x8d, 0xad, 0x24, 0xdd, 0x1e, 0xd1, 0x75, 0x8a, 0x8b, 0x34, 0xdf, 0xb1, 0x38, 0x5f,
+    0xf2, 0x4c, 0x9d, 0xaf, 0x5e, 0x3b, 0x55, 0x82, 0x68, 0x3d, 0x0d, 0x01, 0x3d, 0xdf, 0x46, 0x4d,
+    0x4d, 0x3c, 0x0c, 0x3e, 0x9e, 0xc0, 0xf0, 0xcb, 0x11, 0x0c, 0x21, 0x54, 0xd7, 0xe6, 0x47, 0x73,
+    0x94, 0x85, 0xc1, 0xca, 0xa8, 0x83, 0x98, 0x84, 0x96, 0xc7, 0x09, 0xa4, 0x56, 0xc6, 0x8c, 0x79,
+    0x69, 0x1c, 0x30, 0xd4, 0xc9, 0x20, 0x18, 0xc9, 0x80, 0x4c, 0x3e, 0xd4, 0x66, 0xcb, 0x6a, 0x83,
+    0x4f, 0x44, 0xa6, 0x11, 0x25, 0x70, 0xd6, 0x4e, 0xa5, 0x88, 0x1e, 0x0a, 0x84, 0xa1, 0xeb, 0x67,
+    0x79, 0xed, 0xac, 0x55, 0x3f, 0x29, 0x5d, 0x0b, 0x17, 0xdb, 0xb2, 0x3f, 0xdc, 0x79, 0xf4, 0x00,
+    0x10, 0xc7, 0x8a, 0xec, 0x34, 0xb7, 0xe1, 0xd2, 0x70, 0x1e, 0x01, 0x54, 0x71, 0x72, 0x0e, 0x18,
+    0x51, 0x2e, 0x64, 0xdb, 0x44, 0xae, 0x76, 0x71, 0xa1, 0x56, 0xe3, 0x57, 0xf8, 0x70, 0x1b, 0x09,
+    0x5b, 0xd4, 0xcd, 0xa6, 0x53, 0x56, 0xe7, 0xdd, 0x37, 0x73, 0xc4, 0xa3, 0x14, 0xc2, 0x09, 0x30,
+    0x7f, 0x1e, 0x4f, 0xac, 0x52, 0x1e, 0x0c, 0x66, 0x4c, 0x45, 0x81, 0xe6, 0x28, 0xf5, 0x30, 0x11,
+    0x8d, 0x7a, 0xa5, 0x28, 0xf5, 0xb8, 0x54, 0x64, 0x93, 0x66, 0xc6, 0x6e, 0x51, 0x97, 0x9e, 0xd6,
+    0x3b, 0x93, 0x4e, 0x04, 0xab, 0xd6, 0xe1, 0x1a, 0x44, 0xd1, 0x81, 0x76, 0x29, 0x65, 0xab, 0xa2,
+    0xb1, 0x1a, 0xed, 0xa2, 0x4c, 0x93, 0x03, 0x54, 0x84, 0xe2, 0x48, 0xea, 0xa2, 0xb7, 0x39, 0x2b,
+    0xe3, 0x21, 0x69, 0x20, 0x0c, 0xb7, 0x21, 0x48, 0xf2, 0xb4, 0x78, 0xae, 0x06, 0x31, 0xd9, 0xce,
+    0xa1, 0x43, 0x5b, 0xd5, 0x00, 0x12, 0xe2, 0xd1, 0x2d, 0xd0, 0x5d, 0x71, 0xc2, 0x05, 0x48, 0xaa,
+    0xa6, 0xa1, 0xa2, 0xd7, 0x6c, 0x54, 0x09, 0xc8, 0x76, 0x81, 0xec, 0xad, 0x40, 0xe1, 0xb4, 0x44,
+    0xa4, 0x2c, 0x65, 0x5d, 0xa8, 0xdc, 0xc5, 0x7e, 0xf5, 0x4a, 0x6f, 0x0d, 0x85, 0x6b, 0x53, 0xfc,
+    0x95, 0x76, 0xd8, 0x9a, 0x55, 0xff, 0x8b, 0x9e, 0xf5, 0xd2, 0x2a, 0xac, 0xb9, 0xdb, 0x27, 0x20,
+    0xff, 0x7c, 0x32, 0x84, 0x38, 0xa5, 0xb2, 0x8e, 0xb1, 0x3d, 0xd6, 0xc4, 0xf0, 0x4d, 0x9a, 0xf8,
+    0x19, 0x05, 0xbc, 0x14, 0x0e, 0x50, 0x78, 0x85, 0x26, 0xc6, 0xae, 0x89, 0xf4, 0xb8, 0x50, 0x51,
+    0x8c, 0xab, 0x28, 0x52, 0xfd, 0x1a, 0x55, 0xe4, 0x43, 0x55, 0xfc, 0x92, 0x28, 0xf2, 0x57, 0x8b,
+    0x22, 0x35, 0x55, 0x8c, 0xaf, 0x54, 0xc5, 0xf4, 0x6d, 0xaa, 0x88, 0x7a, 0x00, 0x9d, 0x01, 0x51,
+    0x51, 0x47, 0x78, 0x52, 0x80, 0xae, 0x07, 0x91, 0x94, 0xb2, 0x23, 0xb7, 0x97, 0xde, 0xd2, 0xb2,
+    0x9c, 0x04, 0x7b, 0x7b, 0x1c, 0x0c, 0x51, 0x2a, 0x04, 0x14, 0x22, 0x88, 0x46, 0x73, 0x9b, 0x76,
+    0xc2, 0xfb, 0x1d, 0x82, 0xa8, 0x9f, 0x0e, 0xfd, 0x25, 0xd6, 0x07, 0x40, 0xc5, 0x81, 0x17, 0x68,
+    0x2c, 0x7c, 0xbb, 0xfc, 0x1c, 0xe5, 0x5e, 0x18, 0xe3, 0xcd, 0x13, 0x32, 0x97, 0x0a, 0x99, 0xd0,
+    0xc5, 0xb8, 0x4a, 0x07, 0x2b, 0xd5, 0xa0, 0xe2, 0x8a, 0xcd, 0x49, 0x35, 0xbf, 0xbd, 0x38, 0xd0,
+    0x81, 0x75, 0xa0, 0x5f, 0x9a, 0xe7, 0x97, 0xc7, 0x39, 0xff, 0xcf, 0x71, 0x2e, 0xcf, 0xc6, 0x39,
+    0x1d, 0x8e, 0x73, 0xfa, 0xfe, 0xc7, 0x79, 0x73, 0xf3, 0xec, 0x5b, 0xf2, 0xf2, 0xf6, 0xfe, 0x72,
+    0xba, 0x32, 0x97, 0xf8, 0x1c, 0x0d, 0x18, 0xc6, 0x12, 0x07, 0x73, 0xf9, 0x6f, 0xb3, 0x6b, 0x2a,
+    0x83, 0xb9, 0xdf, 0x0e, 0xb0, 0x7c, 0xd2, 0xd3, 0x07, 0xae, 0x82, 0xb7, 0x50, 0x2d, 0xab, 0x6b,
+    0xd1, 0x74, 0x5f, 0x74, 0x3d, 0x8c, 0x2a, 0xa2, 0x5f, 0x72, 0xaf, 0x8a, 0xaa, 0xae, 0x85, 0x8f,
+    0x5d, 0xb5, 0x7c, 0xfd, 0x84, 0x3e, 0xff, 0xe1, 0x3f, 0x18, 0xdb, 0x17, 0xb8, 0x6b, 0x0b, 0x00,
+    0x00,
+};
+
+const WebAsset webAssets[WEB_ASSET_COUNT] = {
+    {"/assets/config.css", "text/css; charset=utf-8", "\"6b0aa66fc4da3aa3\"", webAssetConfigCss, sizeof(webAssetConfigCss)},
+    {"/assets/config.js", "application/javascript; charset=utf-8", "\"e57d6bcbd4dddca5\"", webAssetConfigJs, sizeof(webAssetConfigJs)},
+    {"/assets/logo.svg", "image/svg+xml; charset=utf-8", "\"50ae47062c89911b\"", webAssetLogoSvg, sizeof(webAssetLogoSvg)},
+};
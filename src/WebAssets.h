@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// This file was generated by tools/web_assets.py from the files in web/.
+
+// A file of web/, compressed with gzip.
+struct WebAsset
+{
+  // Path it is served at, without the version.
+  const char *path;
+  // MIME type of the file, before compression.
+  const char *type;
+  // Strong ETag, quoted.
+  const char *etag;
+  const uint8_t *data;
+  size_t length;
+};
+
+#define WEB_ASSET_COUNT 3
+extern const WebAsset webAssets[WEB_ASSET_COUNT];
+
+// URLs to reference the assets with, the version in the query.
+#define WEB_ASSET_CONFIG_CSS "/assets/config.css?v=6b0aa66fc4da3aa3"
+#define WEB_ASSET_CONFIG_JS "/assets/config.js?v=e57d6bcbd4dddca5"
+#define WEB_ASSET_LOGO_SVG "/assets/logo.svg?v=50ae47062c89911b"
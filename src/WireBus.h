@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Wire.h>
+
+#include "I2CBus.h"
+
+//
+// I2CBus on an Arduino TwoWire, e.g. Wire. The bus must be started with
+// begin() first.
+//
+class WireBus : public I2CBus
+{
+public:
+  explicit WireBus(TwoWire &wire) : _wire(wire) {}
+
+  bool readRegisters(uint8_t address, uint8_t reg, uint8_t *data, uint8_t length) override
+  {
+    _wire.beginTransmission(address);
+    _wire.write(reg);
+    // repeated start, so no other master gets in between
+    if (_wire.endTransmission(false) != 0)
+      return false;
+    if (_wire.requestFrom(address, length) != length)
+      return false;
+    for (uint8_t i = 0; i < length; i++)
+      data[i] = _wire.read();
+    return true;
+  }
+
+  bool writeRegisters(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t length) override
+  {
+    _wire.beginTransmission(address);
+    _wire.write(reg);
+    _wire.write(data, length);
+    return _wire.endTransmission() == 0;
+  }
+
+private:
+  TwoWire &_wire;
+};
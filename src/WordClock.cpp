@@ -2,9 +2,13 @@
 #include "Display.h"
 #include "ClockFace.h"
 #include "iot_config.h"
+#include "RtcClock.h"
+#include "WireBus.h"
 
 #include <IotWebConf.h>
 #include <NeoPixelBus.h>
+#include <Wire.h>
+#include <esp_timer.h>
 
 // Baud rate of the serial output.
 #define SERIAL_BAUD_RATE 115200
@@ -17,11 +21,17 @@
 // #define NEOPIXEL_COUNT 114
 // Number of LEDs in a single row of the grid.
 // #define PIXEL_GRID_WIDTH 11
+// I2C pins of the DS3231 RTC.
+#define I2C_SDA_PIN 21
+#define I2C_SCL_PIN 22
 
 namespace {
   EnglishClockFace clockFace(ClockFace::LightSensorPosition::Bottom);
-  Display display(clockFace);
-  IotConfig iot_config(&display);
+  DisplayOutput output(ClockFace::pixelCount(), {NEOPIXEL_PINS});
+  Display display(clockFace, output);
+  WireBus i2c(Wire);
+  RtcClock rtc(i2c);
+  IotConfig iot_config(&display, &rtc);
 }  // namespace
 
 // Initializes sketch.
@@ -30,12 +40,21 @@ void setup() {
     Serial.begin(SERIAL_BAUD_RATE);
     while (!Serial);
 
+    // The RTC has the time before there is any network.
+    Wire.begin(I2C_SDA_PIN, I2C_SCL_PIN);
+    if (!rtc.begin(esp_timer_get_time())) {
+      Serial.println(rtc.isPresent() ? "[WARN] RTC lost its time, waiting for NTP."
+                                     : "[INFO] No RTC found.");
+    }
+    display.setRtc(&rtc);
+
     display.setup();
     iot_config.setup();
 }
 
 // Executes the event loop once.
 void loop() {
+  rtc.loop(esp_timer_get_time());
   iot_config.loop();
   display.loop();
 }
@@ -1,22 +1,32 @@
 #include "iot_config.h"
 //#include "clock.h"
+#include "ConfigPage.h"
 #include "Display.h"
+#include "JsonReader.h"
+#include "TimezoneSearch.h"
 #include "Timezones.h"
 #include "Clockmodes.h"
+#include "Transitions.h"
 
 #include <IotWebConf.h>
 #include <WiFi.h>
 #include <RTClib.h> // RVG: only for data structures
 
+#include <esp_timer.h>
+
+#include <memory>
+
 // Name of this IoT object.
 #define THING_NAME "WordClockLTX"
 // Initial WiFi access point password.
 #define INITIAL_WIFI_AP_PASSWORD "12345678"
 // IoT configuration version. Change this whenever IotWebConf object's
 // configuration structure changes.
-#define CONFIG_VERSION "v1"
-// Default timezone index from Timezones.h (Paris).
-#define DEFAULT_TIMEZONE "351" // 351=Amsterdam 385=Paris 153=New York
+#define CONFIG_VERSION "v4"
+// Default timezone, a name from Timezones.h.
+#define DEFAULT_TIMEZONE "Europe/Amsterdam" // or "Europe/Paris", "America/New York"
+// Most time zones /api/tz returns.
+#define TIMEZONE_SEARCH_RESULTS 10
 // Port used by the IotWebConf HTTP server.
 #define WEB_SERVER_PORT 80
 // -- Status indicator pin.
@@ -38,134 +48,55 @@
 #define NTP_STATUS_PIN 16
 #define NTP_BLINK_MS 300
 #define NTP_POLL_SHORT_DELAY_SECONDS 20 // Once every 20s
-#define NTP_POLL_LONG_DELAY_SECONDS 3*3600 // Once every 3 hours
+#define NTP_POLL_LONG_DELAY_SECONDS 3*3600 // Once every 3 hours, until the drift is known
+// Bounds of the NTP sync interval once the drift of the clock is known, and
+// the error [us] the clock may build up in between.
+#define NTP_POLL_MIN_SECONDS 15*60
+#define NTP_POLL_MAX_SECONDS 24*3600
+#define NTP_TIME_BUDGET_US 100000
 
 // HTTP OK status code.
 #define HTTP_OK 200
+// HTTP status code of a cached copy that is still good.
+#define HTTP_NOT_MODIFIED 304
+// HTTP status code of a request the API cannot read.
+#define HTTP_BAD_REQUEST 400
 
 // HTTP MIME type.
 #define MIME_HTTP "text/html"
+#define MIME_JSON "application/json"
+
+// Changes made through the API are saved once none came for this long, so
+// that a color picker does not write the flash for every step.
+#define API_SAVE_DELAY_MS 5000
 
 // NTP CLOCK ========================================================================
-// NTP server. Maintains local time plus timezone settings
-#define NTP_SVR   "pool.ntp.org"
-// NTP servers
-//#define NTP_SVR   "pool.ntp.org"
-//#define NTP_SVR   "europe.pool.ntp.org"
-//#define NTP_SVR   "north-america.pool.ntp.org"
-
-// Time zone settings
-//#define CLK_TZ     "CET-1CEST,M3.5.0,M10.5.0/3" // Amsterdam
-#define CLK_TZ     "EST5EDT,M3.2.0,M11.1.0" // America/New-York
+// NTP servers. Every sync asks all of them, and takes the time from the one
+// with the shortest round trip. The pool names give other servers each time.
+//#define NTP_SERVERS "europe.pool.ntp.org", "0.europe.pool.ntp.org", "1.europe.pool.ntp.org"
+//#define NTP_SERVERS "north-america.pool.ntp.org", "0.north-america.pool.ntp.org", "1.north-america.pool.ntp.org"
+#define NTP_SERVERS "0.pool.ntp.org", "1.pool.ntp.org", "2.pool.ntp.org"
+
 //#define NTP_LT_TIMEOUT 3000 // [ms] waiting time for time from NTP server
 
 namespace {
-  // An SVG logo for the Word Clock
-  const char LOGO_DATA_URI[] PROGMEM = "data:image/svg+xml,%3Csvg xmlns='http://www.w3.org/2000/svg' viewBox='0 0 480 480'%3E%3Cpath d='M0 0h480v480H0z'/%3E%3Cg fill='%23fff'%3E%3Cpath d='M150.692 163.411h-6.563l-11.522-38.242q-.82-2.54-1.836-6.406-1.016-3.867-1.055-4.649-.86 5.157-2.735 11.29L115.81 163.41h-6.563l-15.195-57.109h7.031l9.024 35.273q1.875 7.422 2.734 13.438 1.055-7.148 3.125-13.984l10.234-34.727h7.031l10.742 35.04q1.875 6.054 3.164 13.671.742-5.547 2.813-13.516l8.984-35.195h7.031z' aria-label='W'/%3E%3Cpath d='M268.677 134.718q0 13.711-6.954 21.562-6.914 7.852-19.258 7.852-12.617 0-19.492-7.695-6.835-7.735-6.835-21.797 0-13.945 6.875-21.602 6.875-7.696 19.53-7.696 12.306 0 19.22 7.813t6.914 21.562zm-45.508 0q0 11.602 4.921 17.617 4.961 5.977 14.375 5.977 9.493 0 14.336-5.977t4.844-17.617q0-11.523-4.844-17.46-4.804-5.977-14.258-5.977-9.492 0-14.453 6.015-4.922 5.977-4.922 17.422z' aria-label='O'/%3E%3Cpath d='M154.135 244.514q0 14.14-7.696 21.64-7.656 7.462-22.07 7.462h-15.82v-57.11h17.5q13.32 0 20.703 7.383t7.383 20.625zm-7.032.234q0-11.172-5.625-16.836-5.586-5.664-16.64-5.664h-9.65v45.625h8.087q11.875 0 17.852-5.82 5.976-5.86 5.976-17.305z' aria-label='D'/%3E%3Cpath d='M339.34 139.658v23.75h-6.641v-57.109h15.664q10.508 0 15.508 4.023 5.039 4.024 5.039 12.11 0 11.327-11.484 15.311l15.508 25.664h-7.852l-13.828-23.75zm0-5.703h9.101q7.031 0 10.312-2.773 3.281-2.813 3.281-8.399 0-5.664-3.36-8.164-3.32-2.5-10.702-2.5h-8.633z' aria-label='R'/%3E%3Cpath d='M245.577 219.873q-9.414 0-14.883 6.289-5.43 6.25-5.43 17.148 0 11.211 5.235 17.344 5.273 6.094 15 6.094 5.976 0 13.633-2.149v5.82q-5.938 2.227-14.648 2.227-12.617 0-19.492-7.656-6.836-7.656-6.836-21.758 0-8.828 3.281-15.469 3.32-6.64 9.531-10.234 6.25-3.594 14.688-3.594 8.985 0 15.703 3.282l-2.812 5.703q-6.485-3.047-12.97-3.047z' aria-label='C'/%3E%3Cpath d='M156.44 354.9q0 13.711-6.953 21.562-6.914 7.852-19.258 7.852-12.617 0-19.492-7.696-6.836-7.734-6.836-21.797 0-13.945 6.875-21.602 6.875-7.695 19.531-7.695 12.305 0 19.219 7.813t6.914 21.562zm-45.508 0q0 11.602 4.922 17.617 4.96 5.977 14.375 5.977 9.492 0 14.336-5.977t4.844-17.617q0-11.523-4.844-17.461-4.805-5.977-14.258-5.977-9.492 0-14.453 6.016-4.922 5.977-4.922 17.422z' aria-label='O'/%3E%3Cpath d='M336.73 273.613v-57.109h6.641v51.094h25.195v6.016z' aria-label='L'/%3E%3Cpath d='M373.956 383.337h-7.813l-20.82-27.695-5.976 5.312v22.383h-6.64v-57.109h6.64v28.32l25.898-28.32h7.852l-22.97 24.805z' aria-label='K'/%3E%3Cpath d='M245.577 329.87q-9.414 0-14.883 6.29-5.43 6.25-5.43 17.147 0 11.211 5.235 17.344 5.273 6.094 15 6.094 5.976 0 13.633-2.148v5.82q-5.938 2.226-14.648 2.226-12.617 0-19.492-7.656-6.836-7.656-6.836-21.758 0-8.828 3.281-15.469 3.32-6.64 9.531-10.234 6.25-3.594 14.688-3.594 8.985 0 15.703 3.282l-2.812 5.703q-6.485-3.047-12.97-3.047z' aria-label='C'/%3E%3C/g%3E%3Cg fill='%23fff'%3E%3Ccircle cx='37.785' cy='37.968' r='7.906'/%3E%3Ccircle cx='439.98' cy='38.047' r='7.906'/%3E%3Ccircle cx='37.785' cy='440.74' r='7.906'/%3E%3Ccircle cx='439.98' cy='440.82' r='7.906'/%3E%3C/g%3E%3C/svg%3E";
-  
-  // Custom meta tags to be inserted in the head.
-  const char CUSTOM_HTML_META_START[] = "<meta name=\"theme-color\" content=\"#121212\" />\n<link rel=\"icon\" href=\"";
-  const char CUSTOM_HTML_META_END[] = "\" type=\"image/svg+xml\" />\n";
-  
-  // Custom Javascript block that will be added to the header.
-  // See customconfig.js for human-readable version.
-  const char CUSTOMHTML_SCRIPT_INNER[] PROGMEM = "document.addEventListener(\"DOMContentLoaded\",function(d){if(d=document.querySelector(\"label[for=iwcThingName]\"))d.innerText=\"Clock name\";if(d=document.querySelector(\"label[for=iwcApPassword]\"))d.innerText=\"AP password (login: admin)\";document.querySelectorAll(\"input[type=password]\").forEach(function(a){var b=document.createElement(\"input\");b.classList.add(\"pwtoggle\");b.type=\"button\";b.value=\"\\ud83d\\udc41\\ufe0f\";a.insertAdjacentElement(\"afterend\",b);b.onclick=function(){\"password\"===a.type?(a.type=\
-  \"text\",b.value=\"\\ud83d\\udd12\"):(a.type=\"password\",b.value=\"\\ud83d\\udc41\\ufe0f\")}});(d=document.querySelector(\"form\"))&&d.addEventListener(\"submit\",function(){var a=document.querySelector(\"button[type=submit]\");a.innerText=\"Saving...\";a.toggleAttribute(\"disabled\",!0)});document.querySelectorAll(\"input[data-options]\").forEach(function(a){var b=a.value,h=a.getAttribute(\"data-options\").split(\"|\"),f=document.createElement(\"select\");f.name=a.name;f.id=a.id;\"\"===b&&f.appendChild(document.createElement(\"option\"));\
-  var c=null;h.forEach(function(m,n){var e=m.split(\"/\"),g=m;1<e.length?(g=e.splice(0,1)[0],c&&g==c.label||(c&&f.appendChild(c),c=document.createElement(\"optgroup\"),c.label=g),g=e.join(\" / \")):c&&(f.appendChild(c),c=null);e=document.createElement(\"option\");e.value=n;e.innerText=g;n==b&&e.toggleAttribute(\"selected\");c?c.appendChild(e):f.appendChild(e)});c&&f.appendChild(c);a.id+=\"-d\";a.insertAdjacentElement(\"beforebegin\",f);a.parentElement.removeChild(a)});document.querySelectorAll(\"input[type=range]\").forEach(function(a){var b=\
-  a.getAttribute(\"data-labels\"),h=b&&b.split(\"|\");b=function(){a.setAttribute(\"data-label\",h?h[parseInt(a.value,10)]||a.value:a.value)};a.oninput=b;b()});var k=document.getElementById(\"ntp_enabled\");if(k){var p=function(a){document.querySelectorAll(\"#date, #time\").forEach(function(b){b.parentElement.style.display=a?\"none\":\"\"});document.getElementById(\"timezone\").parentElement.style.display=a?\"\":\"none\"};k.addEventListener(\"change\",function(a){p(1==k.value)});p(1==k.value)}var l=document.querySelector(\"input[type=color]\");\
-  l&&(d=function(){document.querySelector(\".logoContainer\").style.backgroundColor=l.value},l.addEventListener(\"input\",d),d())});";
-  
-  // Custom style added to the style tag.
-  const char CUSTOMHTML_STYLE_INNER[] PROGMEM = "\n\
-  body {\
-    color: #eee;\
-    margin: 0;\
-  background: #121212;\
-    font: 100% system-ui;}\
-  a {\
-    color: #16a1e7;}\
-  div {\
-    padding: 0;}\
-  .logo {\
-    width: 80vw;\
-    max-width: 160px;\
-    display: block;\
-    mix-blend-mode: multiply;}\
-  .logoContainer {\
-    background: white;\
-    transition: background 3s;\
-    display: inline-block;\
-    margin: 40px auto;\
-    padding: 0;}\
-  .logoContainer, fieldset {\
-    box-shadow: 0px 0px 15px 1px #ffffff7d;}\
-  .pwtoggle {\
-    padding: 0 5px;\
-    position: absolute;\
-    right: 3px;\
-    top: 40px;\
-    border: none;\
-    background: transparent;\
-    height: 34px;\
-    outline: none;}\
-  fieldset {\
-    padding: 40px 15px 20px;\
-    margin-bottom: 40px;\
-    border: none;\
-    background: black;\
-    border-radius: 0;\
-    position: relative;\
-    width: calc(100vw - 100px);\
-    max-width: 440px;}\
-  fieldset > div {\
-    position: relative;\
-    margin: 0;\
-    padding: 0;\
-    display: flex;\
-    flex-direction: column;}\
-  input, select {\
-    margin: 0;\
-    padding: 5px;\
-    width: auto;\
-    line-height: 20px;}\
-  input[type=\"range\"] {\
-    margin-left: 30px;\
-    position: relative;\
-    padding: 0;}\
-  input[type=\"range\"]:before {\
-    content: attr(data-label);\
-    color: #eee;\
-    position: absolute;\
-    left: -30px;\
-    display: inline;\
-    width: 25px;\
-    line-height: 20px;}\
-  label {margin: 15px 0 5px;}\
-  legend, fieldset:first-child:after {\
-    font-weight: lighter;\
-    padding: 0;\
-    font-size: 1.2em;\
-    text-align: center;\
-    position: absolute;\
-    top: 15px;\
-    display: block;\
-    left: 0;\
-    right: 0;\
-    text-transform: uppercase;}\
-  fieldset:first-child:after {content: \"Network\";}\
-  button {\
-    border-radius: 0;\
-    text-transform: uppercase;}\
-  form + div {padding: 20px 0 15px 0;}\
-  body > div > div:last-child {\
-    margin-top: -20px;\
-    float: right;}\
-  }\n";
-  
+  const char* const NTP_SERVER_NAMES[] = {NTP_SERVERS};
+
+  // Custom meta tags to be inserted in the head. The script, the style and
+  // the logo are files of web/, see tools/web_assets.py.
+  const char CUSTOMHTML_HEAD[] PROGMEM =
+    "<meta name=\"theme-color\" content=\"#121212\" />\n"
+    "<link rel=\"icon\" href=\"" WEB_ASSET_LOGO_SVG "\" type=\"image/svg+xml\" />\n";
+  // Added after the style of IotWebConf, to override it.
+  const char CUSTOMHTML_HEAD_EXTENSION[] PROGMEM =
+    "<link rel=\"stylesheet\" href=\"" WEB_ASSET_CONFIG_CSS "\" />\n"
+    "<script src=\"" WEB_ASSET_CONFIG_JS "\"></script>\n";
+
   // Custom HTML element will be added at the beginning of the body element.
-  const char CUSTOMHTML_BODY_INNER_START[] PROGMEM = "<header><div class=\"logoContainer\"><img class=\"logo\" src=\"";
-  const char CUSTOMHTML_BODY_INNER_END[] PROGMEM = "\"/></div></header>\n";
-  
+  const char CUSTOMHTML_BODY_INNER[] PROGMEM =
+    "<header><div class=\"logoContainer\"><img class=\"logo\" src=\""
+    WEB_ASSET_LOGO_SVG "\"/></div></header>\n";
+
   class CustomHtmlFormatProvider : public IotWebConfHtmlFormatProvider
   {
     protected:
@@ -173,25 +104,15 @@ namespace {
       {
         String head = IotWebConfHtmlFormatProvider::getHead();
         head.replace("{v}", THING_NAME);
-        return head + String(FPSTR(CUSTOM_HTML_META_START)) +
-               String(FPSTR(LOGO_DATA_URI)) +
-               String(FPSTR(CUSTOM_HTML_META_END));
-      }
-      String getScriptInner() override
-      {
-        return IotWebConfHtmlFormatProvider::getScriptInner() +
-               String(FPSTR(CUSTOMHTML_SCRIPT_INNER));
+        return head + String(FPSTR(CUSTOMHTML_HEAD));
       }
-      String getStyleInner() override
+      String getHeadExtension() override
       {
-        return IotWebConfHtmlFormatProvider::getStyleInner() +
-               String(FPSTR(CUSTOMHTML_STYLE_INNER));
+        return String(FPSTR(CUSTOMHTML_HEAD_EXTENSION));
       }
       String getBodyInner() override
       {
-        return String(FPSTR(CUSTOMHTML_BODY_INNER_START)) +
-               String(FPSTR(LOGO_DATA_URI)) +
-               String(FPSTR(CUSTOMHTML_BODY_INNER_END)) +
+        return String(FPSTR(CUSTOMHTML_BODY_INNER)) +
                IotWebConfHtmlFormatProvider::getBodyInner();
       }
   };
@@ -319,6 +240,37 @@ namespace {
 //    return static_cast<bool>(parseNumberValue(str, 0, 1, 0));
 //  }
 
+  // Whether `str` is a color as stored by the color parameter, #RRGGBB.
+  bool isColorValue(const char* str) {
+    if (str[0] != '#' || strlen(str) != 7) return false;
+    for (int i = 1; i <= 6; i++) {
+      if (!isxdigit(str[i])) return false;
+    }
+    return true;
+  }
+
+  // Copies `str` into `out` as a JSON string, quotes included. Control
+  // characters are left out.
+  void toJsonString(const char* str, char* out, size_t size) {
+    size_t n = 0;
+    out[n++] = '"';
+    for (; *str != '\0' && n + 3 < size; str++) {
+      if (static_cast<unsigned char>(*str) < 0x20) continue;
+      if (*str == '"' || *str == '\\') out[n++] = '\\';
+      out[n++] = *str;
+    }
+    out[n++] = '"';
+    out[n] = '\0';
+  }
+
+  // Whether `str` is a time zone ID, as stored before zones were stored by
+  // name.
+  bool isTimezoneId(const char* str) {
+    char* end_ptr = nullptr;
+    long id = strtol(str, &end_ptr, 10);
+    return end_ptr != str && *end_ptr == 0 && id >= 0 && id < TIMEZONE_COUNT;
+  }
+
 }  // namespace
 
 
@@ -353,8 +305,8 @@ namespace {
   //     const char* id, char* valueBuffer, int length, const char* customHtml,
   //     const char* type = "text");
 
-IotConfig::IotConfig(Display* display)
-  : web_server_(WEB_SERVER_PORT), display_(display),
+IotConfig::IotConfig(Display* display, RtcClock* rtc)
+  : sntp_(ntp_transport_), web_server_(WEB_SERVER_PORT), rtc_(rtc), display_(display),
     datetime_separator_("Date and time"),
     // date_param_("Date", "date", date_value_, IOT_CONFIG_VALUE_LENGTH, "date",
     //             "yyyy-mm-dd", nullptr, "pattern='\\d{4}-\\d{1,2}-\\d{1,2}'"),
@@ -366,17 +318,25 @@ IotConfig::IotConfig(Display* display)
     //            "pattern='[01]' min='0' max='1' "
     //            "style='max-width: 2em; display: block;'"),
     timezone_param_("Time zone", "timezone", timezone_value_, IOT_CONFIG_VALUE_LENGTH,
-                    "number", DEFAULT_TIMEZONE, DEFAULT_TIMEZONE, locationOptions),
+                    "text", DEFAULT_TIMEZONE, DEFAULT_TIMEZONE,
+                    "data-tz autocomplete='off' spellcheck='false'"),
     display_separator_("Display"),
     show_ampm_param_(
        "AM/PM indicator", "show_ampm", show_ampm_value_,
        IOT_CONFIG_VALUE_LENGTH, "range", "0", "0",
        "pattern='[01]' min='0' max='1' "
        "style='width: 40px;' data-labels='Off|On' min='0' max='1' step='1'"),
+    transition_param_(
+      "Transition", "transition", transition_value_,
+      IOT_CONFIG_VALUE_LENGTH, "number", "0", "0", transitionStyleOptions),
     ldr_sensitivity_param_(
        "Light sensor sensitivity", "ldr_sensitivity", ldr_sensitivity_value_,
        IOT_CONFIG_VALUE_LENGTH, "range", "5", "5",
        "min='0' max='10' step='1' data-labels='Off'"),    
+    power_limit_param_(
+       "LED current limit (mA, 0=off)", "power_limit", power_limit_value_,
+       IOT_CONFIG_VALUE_LENGTH, "number", "2000", "2000",
+       "min='0' max='10000' step='100'"),
     // palette_id_param_(
     //   "Color palette number (0=custom)", "palette_id", palette_id_value_,
     //   IOT_CONFIG_VALUE_LENGTH, "number", "1", "1",
@@ -393,7 +353,7 @@ IotConfig::IotConfig(Display* display)
     test_separator_("Test"),
     clock_mode_param_(
       "Clock mode", "clock_mode", clock_mode_value_,
-      IOT_CONFIG_VALUE_LENGTH, "number", "0", "0", clockModeOptions),
+      IOT_CONFIG_VALUE_LENGTH, "number", "0", "0", Display::Modes::options()),
       // "pattern='\\d+' min='0' max='6' "
       // "style='max-width: 2em; display: block;'"),
     // fast_time_factor_param_(
@@ -404,11 +364,19 @@ IotConfig::IotConfig(Display* display)
     find_word_param_(
       "Find word", "find_word", find_word_value_,
       IOT_CONFIG_VALUE_LENGTH, "text", "", ""),
+    stress_rate_param_(
+      "Stress rate (updates/s, 0=max)", "stress_rate", stress_rate_value_,
+      IOT_CONFIG_VALUE_LENGTH, "number", "10", "10",
+      "min='0' max='1000' step='1'"),
     iot_web_conf_(THING_NAME, &dns_server_, &web_server_,
                   INITIAL_WIFI_AP_PASSWORD, CONFIG_VERSION)
 {
   this->show_ampm_value_[0] = '\0';
+  this->transition_value_[0] = '\0';
   this->ldr_sensitivity_value_[0] = '\0';
+  this->power_limit_value_[0] = '\0';
+  this->stress_rate_value_[0] = '\0';
+  ntpPollSeconds_ = NTP_POLL_LONG_DELAY_SECONDS;
 }
 
 IotConfig::~IotConfig() {}
@@ -425,10 +393,8 @@ void IotConfig::updateClockFromParams_() {
   Serial.println("=IotConfig::updateClockFromParams_()");
   //parseAndSetDateTime(word_clock_, date_value_, time_value_);
 
-  display_->setClockMode(static_cast<ClockMode>(
-                            parseNumberValue(clock_mode_value_, 0,
-                                  static_cast<int>(ClockMode::MAX_VALUE),
-                                  static_cast<int>(ClockMode::REAL_TIME))));
+  display_->setClockMode(parseNumberValue(clock_mode_value_, 0,
+                                           Display::Modes::MaxValue, 0));
 //  word_clock_->setDst(static_cast<bool>(
 //                        parseNumberValue(dst_value_, 0, 1, 0)));
 
@@ -437,6 +403,8 @@ void IotConfig::updateClockFromParams_() {
   // member function rather than calling the word_clock object
   //    word_clock_->setTimezone(
   //            parseNumberValue(timezone_value_, DEFAULT_TIMEZONE, 0, 459));
+  // The clock converts to local time itself, see PosixTimeZone.
+  display_->setTimeZone(timezoneRule(resolveTimezone_()));
   connectNTP_();
 
 //  word_clock_->setFastTimeFactor(
@@ -452,12 +420,19 @@ void IotConfig::updateClockFromParams_() {
   display_->setColor(parseColorValue(color_value_, RgbColor(239, 235, 216)));
   display_->setShowAmPm(static_cast<bool>(
                         parseNumberValue(show_ampm_value_, 0, 1, 0)));
+  display_->setTransitionStyle(static_cast<TransitionStyle>(
+                        parseNumberValue(transition_value_, 0,
+                                  static_cast<int>(TransitionStyle::MAX_VALUE),
+                                  static_cast<int>(TransitionStyle::FADE))));
   display_->setSensorSensitivity(parseNumberValue(ldr_sensitivity_value_, 0, 10, 5)); 
+  display_->setPowerLimit(parseNumberValue(power_limit_value_, 0, 10000,
+                                           LED_DEFAULT_LIMIT_MILLIAMPS));
   display_->setFindWord(find_word_value_, IOT_CONFIG_VALUE_LENGTH); 
+  display_->setStressRate(parseNumberValue(stress_rate_value_, 0, 1000, 10));
 }
 
 void IotConfig::handleHttpToRoot_() {
-  static const char html[] =
+  static const char html_start[] =
     "<!DOCTYPE html>"
     "<html lang='en'>"
     "<head>"
@@ -467,20 +442,273 @@ void IotConfig::handleHttpToRoot_() {
     "</head>"
     "<body>"
     "<h1>Word Clock LT</h1>"
-    "<ul><li><a href='config'>Settings</a></li></ul>"
+    "<ul><li><a href='config'>Settings</a></li>"
+    "<li><a href='ambient'>Ambient light</a></li></ul>";
+  static const char html_end[] =
     "</body>"
     "</html>\n";
 
   if (iot_web_conf_.handleCaptivePortal()) return;
-  web_server_.send(HTTP_OK, MIME_HTTP, html);
+
+  const Display::PowerBudget& power = display_->powerBudget();
+  ClockDiscipline& time_base = display_->timeBase();
+  const char* rtc_state = !rtc_->isPresent() ? "not found"
+                        : !rtc_->isValid() ? "time lost, waiting for NTP"
+                        : "running";
+  char status[768];
+  snprintf(status, sizeof(status),
+    "<h2>Status</h2><ul>"
+    "<li>LED current: %u mA (requested %u mA, limit %u mA)</li>"
+    "<li>LED energy: %.1f mWh in the last %lu h, %.1f mWh in the 24 h before</li>"
+    "<li>Clock drift: %.2f ppm from %u syncs, error within %.1f ms, next sync in %u s</li>"
+    "<li>RTC: %s, %.1f ms off at the last check, aging offset %d</li>"
+    "<li>NTP: last sync from %s, round trip %.1f ms</li>"
+    "</ul>",
+    power.milliamps(), power.requestedMilliamps(), power.limit(),
+    power.energyToday(), (millis() - power.dayStart()) / 3600000UL,
+    power.energyYesterday(),
+    time_base.driftPpm(), time_base.sampleCount(),
+    time_base.isSynced() ? time_base.uncertaintyUs(esp_timer_get_time()) / 1000.0 : 0.0,
+    ntpPollSeconds_,
+    rtc_state, rtc_->lastErrorUs() / 1000.0, rtc_->agingOffset(),
+    time_base.isSynced() ? sntp_.server(sntp_.lastSample().server) : "none",
+    sntp_.lastSample().delayUs / 1000.0);
+
+  web_server_.send(HTTP_OK, MIME_HTTP, String(html_start) + status + html_end);
 }
 
 void IotConfig::handleHttpToConfig_() {
   clearTransientParams_();
-  iot_web_conf_.handleConfig();
+  if (iot_web_conf_.handleCaptivePortal()) return;
+  // Saving, and the form with its errors if the values are not valid, is
+  // left to IotWebConf.
+  if (web_server_.method() == HTTP_POST) {
+    iot_web_conf_.handleConfig();
+    return;
+  }
+  if (!authenticate_()) return;
+
+  // The form is sent as it is rendered: the memory it takes does not grow
+  // with the page.
+  ChunkedResponse response(web_server_);
+  response.begin(HTTP_OK, MIME_HTTP);
+  ConfigPage page(response);
+  page.begin(iot_web_conf_.getThingName());
+  response.write(CUSTOMHTML_HEAD);
+  response.write(CUSTOMHTML_HEAD_EXTENSION);
+  page.beginForm(CUSTOMHTML_BODY_INNER);
+
+  IotWebConfParameter* system_params[] = {
+    iot_web_conf_.getThingNameParameter(),
+    iot_web_conf_.getApPasswordParameter(),
+    iot_web_conf_.getWifiSsidParameter(),
+    iot_web_conf_.getWifiPasswordParameter(),
+    iot_web_conf_.getApTimeoutParameter(),
+  };
+  for (IotWebConfParameter* param : system_params) {
+    page.parameter(param);
+  }
+  for (uint8_t i = 0; i < parameter_count_; i++) {
+    page.parameter(parameters_[i]);
+  }
+  page.end(CONFIG_VERSION);
+}
+
+void IotConfig::handleHttpToAsset_(const WebAsset& asset) {
+  web_server_.sendHeader("ETag", asset.etag);
+  // the page asks with the version in the URL, the copy never goes stale
+  web_server_.sendHeader("Cache-Control", "public, max-age=31536000, immutable");
+  if (web_server_.header("If-None-Match") == asset.etag) {
+    web_server_.send(HTTP_NOT_MODIFIED, asset.type, "");
+    return;
+  }
+  web_server_.sendHeader("Content-Encoding", "gzip");
+  web_server_.send_P(HTTP_OK, asset.type,
+                     reinterpret_cast<const char*>(asset.data), asset.length);
+}
+
+void IotConfig::handleHttpToTimezoneSearch_() {
+  uint16_t ids[TIMEZONE_SEARCH_MAX_RESULTS];
+  uint8_t count = TimezoneSearch::search(web_server_.arg("q").c_str(), ids,
+                                         TIMEZONE_SEARCH_RESULTS);
+  char json[TIMEZONE_SEARCH_RESULTS * 64];
+  TimezoneSearch::toJson(ids, count, json, sizeof(json));
+  web_server_.send(HTTP_OK, MIME_JSON, json);
+}
+
+int16_t IotConfig::resolveTimezone_() {
+  int16_t id = TimezoneSearch::find(timezone_value_);
+  if (id >= 0) {
+    return id;
+  }
+  Serial.printf("[INFO] Unknown time zone \"%s\", using %s.\n", timezone_value_,
+                DEFAULT_TIMEZONE);
+  return TimezoneSearch::find(DEFAULT_TIMEZONE);
+}
+
+void IotConfig::migrateTimezone_() {
+  if (TimezoneSearch::find(timezone_value_) >= 0 ||
+      !isTimezoneId(timezone_value_)) {
+    return;
+  }
+  // stored by an older version: keep the zone, by its name from now on
+  int16_t id = atoi(timezone_value_);
+  Serial.printf("Time zone %s stored as %s\n", timezone_value_, timezoneName(id));
+  strncpy(timezone_value_, timezoneName(id), IOT_CONFIG_VALUE_LENGTH - 1);
+  timezone_value_[IOT_CONFIG_VALUE_LENGTH - 1] = '\0';
+  iot_web_conf_.configSave();
+}
+
+bool IotConfig::validateForm_() {
+  // only names from the list, a typo would silently give the default zone
+  if (TimezoneSearch::find(web_server_.arg(timezone_param_.getId()).c_str()) < 0) {
+    timezone_param_.errorMessage = "Unknown time zone, pick one from the list.";
+    return false;
+  }
+  return true;
+}
+
+void IotConfig::handleHttpToAmbient_() {
+  const AmbientHistogram& histogram =
+      display_->brightnessController().ambientHistogram();
+  size_t length = histogram.toJson(nullptr, 0);
+  std::unique_ptr<char[]> json(new char[length + 1]);
+  histogram.toJson(json.get(), length + 1);
+  web_server_.send(HTTP_OK, MIME_JSON, json.get());
+}
+
+void IotConfig::handleHttpToStress_() {
+  Serial.println("=IotConfig::handleHttpToStress_()");
+  char json[384];
+  display_->stressMetrics().toJson(json, sizeof(json), esp_timer_get_time(),
+                                   display_->droppedFrames(),
+                                   display_->committedFrames());
+  web_server_.send(HTTP_OK, MIME_JSON, json);
+}
+
+bool IotConfig::authenticate_() {
+  if (iot_web_conf_.getState() == IOTWEBCONF_STATE_ONLINE &&
+      !web_server_.authenticate(IOTWEBCONF_ADMIN_USER_NAME,
+          iot_web_conf_.getApPasswordParameter()->valueBuffer)) {
+    web_server_.requestAuthentication();
+    return false;
+  }
+  return true;
+}
+
+void IotConfig::handleHttpToApiState_() {
+  if (!authenticate_()) return;
+  sendApiState_();
+}
+
+void IotConfig::sendApiState_() {
+  char word[2 * IOT_CONFIG_VALUE_LENGTH + 3];
+  toJsonString(find_word_value_, word, sizeof(word));
+  uint8_t mode = parseNumberValue(clock_mode_value_, 0,
+                                  Display::Modes::MaxValue, 0);
+  char json[256];
+  snprintf(json, sizeof(json),
+           "{\"mode\":%u,\"modeName\":\"%s\",\"color\":\"%s\",\"word\":%s,"
+           "\"sensitivity\":%d,\"savePending\":%s}",
+           mode, Display::Modes::label(mode), color_value_, word,
+           parseNumberValue(ldr_sensitivity_value_, 0, 10, 5),
+           api_save_pending_ ? "true" : "false");
+  web_server_.send(HTTP_OK, MIME_JSON, json);
+}
+
+void IotConfig::handleHttpToApiColor_() {
+  if (!authenticate_()) return;
+  ApiRequest request(web_server_);
+  char color[8];
+  if (!request.json.get("color").copyTo(color, sizeof(color)) ||
+      !isColorValue(color)) {
+    sendApiError_("expected {\"color\":\"#RRGGBB\"}");
+    return;
+  }
+  strcpy(color_value_, color);
+  display_->setColor(parseColorValue(color_value_, RgbColor(239, 235, 216)));
+  handleApiChange_(request.json);
+}
+
+void IotConfig::handleHttpToApiMode_() {
+  if (!authenticate_()) return;
+  ApiRequest request(web_server_);
+  // by its number, or by its label as in /api/state
+  JsonValue value = request.json.get("mode");
+  int32_t mode = -1;
+  for (uint8_t id = 0; id <= Display::Modes::MaxValue; id++) {
+    if (value.equals(Display::Modes::label(id))) mode = id;
+  }
+  if (mode < 0 && !value.toInt(0, Display::Modes::MaxValue, mode)) {
+    sendApiError_("expected {\"mode\":<number or name>}");
+    return;
+  }
+  snprintf(clock_mode_value_, IOT_CONFIG_VALUE_LENGTH, "%d", mode);
+  display_->setClockMode(mode);
+  handleApiChange_(request.json);
+}
+
+void IotConfig::handleHttpToApiWord_() {
+  if (!authenticate_()) return;
+  ApiRequest request(web_server_);
+  char word[IOT_CONFIG_VALUE_LENGTH];
+  if (!request.json.get("word").copyTo(word, sizeof(word))) {
+    sendApiError_("expected {\"word\":\"<text>\"}");
+    return;
+  }
+  strcpy(find_word_value_, word);
+  display_->setFindWord(find_word_value_, IOT_CONFIG_VALUE_LENGTH);
+  handleApiChange_(request.json);
+}
+
+void IotConfig::handleHttpToApiBrightness_() {
+  if (!authenticate_()) return;
+  ApiRequest request(web_server_);
+  int32_t sensitivity;
+  if (!request.json.get("sensitivity").toInt(0, 10, sensitivity)) {
+    sendApiError_("expected {\"sensitivity\":<0-10>}");
+    return;
+  }
+  snprintf(ldr_sensitivity_value_, IOT_CONFIG_VALUE_LENGTH, "%d", sensitivity);
+  display_->setSensorSensitivity(sensitivity);
+  handleApiChange_(request.json);
+}
+
+void IotConfig::handleApiChange_(const JsonReader& request) {
+  bool save = true;
+  request.get("save").toBool(save);
+  if (save) {
+    api_save_pending_ = true;
+    last_api_change_ = millis();
+  }
+  sendApiState_();
+}
+
+void IotConfig::sendApiError_(const char* message) {
+  char json[128];
+  snprintf(json, sizeof(json), "{\"error\":\"%s\"}", message);
+  web_server_.send(HTTP_BAD_REQUEST, MIME_JSON, json);
+}
+
+void IotConfig::saveApiChanges_() {
+  api_save_pending_ = false;
+  // the changes are in effect already, nothing to update after the save
+  saving_api_changes_ = true;
+  iot_web_conf_.configSave();
+  saving_api_changes_ = false;
+}
+
+void IotConfig::addParameter_(IotWebConfParameter* param) {
+  iot_web_conf_.addParameter(param);
+  if (parameter_count_ < IOT_CONFIG_MAX_PARAMETERS) {
+    parameters_[parameter_count_++] = param;
+  }
 }
 
 void IotConfig::handleConfigSaved_() {
+  // the form saved the API's changes too
+  api_save_pending_ = false;
+  if (saving_api_changes_) return;
   updateClockFromParams_();
 }
 
@@ -490,15 +718,7 @@ void IotConfig::handleWifiConnected_() {
   connectNTP_();
 }
 
-// Default NTP poll time is SNTP_UPDATE_DELAY (sntp.c, value 3600000 ms or 1 hour).
-// Change with sntp_set_update_delay(ms)
-//  RVG changed this since Arduino time implementation doesn't seem to support the function prototype below
-//  configTime(CLK_TZ, CLK_SVR1, CLK_SVR2, CLK_SVR3);
 void IotConfig::connectNTP_() {
-  struct tm timeinfo;
-  bool gotLocalTime = false;
-  //  String timezone(CLK_TZ);
-
   if (WiFi.status() != WL_CONNECTED)
   {
     Serial.println("Wifi not connected, cannot set time from NTP server.");
@@ -506,34 +726,48 @@ void IotConfig::connectNTP_() {
     return;
   }
 
-  Serial.println((String)"connectNTP_: Connecting to NTP server: " + NTP_SVR);
-  configTime(0, 0, NTP_SVR);    // First connect to NTP server, with 0 TZ offset
+  // The answers come in while the loop goes on; loop() calls
+  // handleNTPSync_() back once they are in.
+  sntp_.sync(esp_timer_get_time());
+  lastNTPConnect_ = millis();
+}
 
-  // Timezone
-  int tz = parseNumberValue(timezone_value_, 0, 459, 0);
-  Serial.printf(" Setting Timezone to %s (%d)\n",  posix[tz], tz);
-  configTzTime(posix[tz], NTP_SVR);
-  //  Serial.printf(" Setting Timezone to %s\n",  timezone.c_str());
-  //  setenv("TZ", timezone.c_str(),1);  //  Now adjust the TZ.  Clock settings are adjusted to show the new local time
-  //  tzset();
-
-  //  Serial.print(" NTP: Obtaining local time");
-  //  gotLocalTime = getLocalTime(&timeinfo, 10);
-  //  Serial.print(&timeinfo, " %A, %B %d %Y %H:%M:%S");
-  //  Serial.printf(" (%d)\n", gotLocalTime);
-
-  if (isNTPConnected_()) {
-    NTPState_ = NTP_Connected;
-  } else {
-    NTPState_ = NTP_Connecting;
-  }
+void IotConfig::handleNTPSync_(int64_t monotonic_us, int64_t utc_us) {
+  ClockDiscipline& time_base = display_->timeBase();
+  time_base.addSample(monotonic_us, utc_us);
+  // the RTC keeps the time for the next boot
+  rtc_->discipline(monotonic_us, utc_us);
+
+  ntpPollSeconds_ = time_base.holdoverSeconds(NTP_TIME_BUDGET_US,
+                                              NTP_POLL_MAX_SECONDS);
+  if (ntpPollSeconds_ < NTP_POLL_MIN_SECONDS)
+    ntpPollSeconds_ = NTP_POLL_MIN_SECONDS;
   lastNTPConnect_ = millis();
+
+  Serial.printf("NTP sync: drift %.2f ppm, next sync in %u s\n",
+                time_base.driftPpm(), ntpPollSeconds_);
 }
 
-bool IotConfig::isNTPConnected_() {
-  struct tm timeinfo;
-  bool getLTStatus = getLocalTime(&timeinfo, 10);
-  return getLTStatus;
+void IotConfig::handleNTPState_(SntpClient::State state) {
+  switch (state) {
+    case SntpClient::State::QUERYING:
+      // a sync while the time is there keeps the LED on
+      if (NTPState_ != NTP_Connected) {
+        NTPState_ = NTP_Connecting;
+      }
+      break;
+    case SntpClient::State::SYNCED:
+      if (NTPState_ != NTP_Connected) {
+        Serial.println("NTP connection succesful");
+      }
+      NTPState_ = NTP_Connected;
+      break;
+    case SntpClient::State::FAILED:
+      Serial.println("[WARN] No answer from the NTP servers, trying again.");
+      break;
+    default:
+      break;
+  }
 }
 
 void IotConfig::updateNTPLEDStatus_() {
@@ -578,31 +812,49 @@ void IotConfig::setup() {
   iot_web_conf_.setConfigPin(IOT_AP_CONFIG_PIN);
   iot_web_conf_.setStatusPin(IOT_WEB_STATUS_PIN);
 
-  iot_web_conf_.addParameter(&datetime_separator_);
-  // iot_web_conf_.addParameter(&date_param_);
-  // iot_web_conf_.addParameter(&time_param_);
-  // iot_web_conf_.addParameter(&dst_param_);
-  iot_web_conf_.addParameter(&timezone_param_);
-  iot_web_conf_.addParameter(&display_separator_);
-  iot_web_conf_.addParameter(&show_ampm_param_);
-  iot_web_conf_.addParameter(&ldr_sensitivity_param_); 
-//  iot_web_conf_.addParameter(&palette_id_param_);
-  iot_web_conf_.addParameter(&color_param_);
-//  iot_web_conf_.addParameter(&period_param_);
-  iot_web_conf_.addParameter(&test_separator_);
-  iot_web_conf_.addParameter(&clock_mode_param_);
-  iot_web_conf_.addParameter(&find_word_param_);
-  // iot_web_conf_.addParameter(&fast_time_factor_param_);
+  addParameter_(&datetime_separator_);
+  // addParameter_(&date_param_);
+  // addParameter_(&time_param_);
+  // addParameter_(&dst_param_);
+  addParameter_(&timezone_param_);
+  addParameter_(&display_separator_);
+  addParameter_(&show_ampm_param_);
+  addParameter_(&transition_param_);
+  addParameter_(&ldr_sensitivity_param_); 
+  addParameter_(&power_limit_param_);
+//  addParameter_(&palette_id_param_);
+  addParameter_(&color_param_);
+//  addParameter_(&period_param_);
+  addParameter_(&test_separator_);
+  addParameter_(&clock_mode_param_);
+  addParameter_(&find_word_param_);
+  addParameter_(&stress_rate_param_);
+  // addParameter_(&fast_time_factor_param_);
 
-  iot_web_conf_.setConfigSavedCallback([this]() {
-    handleConfigSaved_();
-  });
   iot_web_conf_.setWifiConnectionCallback([this]() {
     handleWifiConnected_();
   });
+  iot_web_conf_.setFormValidator([this]() {
+    return validateForm_();
+  });
   iot_web_conf_.setHtmlFormatProvider(&customHtmlFormatProvider);
 
+  sntp_.setServers(NTP_SERVER_NAMES,
+                   sizeof(NTP_SERVER_NAMES) / sizeof(NTP_SERVER_NAMES[0]));
+  sntp_.onSync([this](const SntpClient::Sample& sample) {
+    handleNTPSync_(sample.monotonicUs, sample.utcUs);
+  });
+  sntp_.onStateChange([this](SntpClient::State state) {
+    handleNTPState_(state);
+  });
+
   iot_web_conf_.init();
+  // before the saved callback is set: saving here must not apply the
+  // configuration a second time
+  migrateTimezone_();
+  iot_web_conf_.setConfigSavedCallback([this]() {
+    handleConfigSaved_();
+  });
 
   clearTransientParams_();
   updateClockFromParams_();
@@ -613,6 +865,38 @@ void IotConfig::setup() {
   web_server_.on("/config", [this]() {
     handleHttpToConfig_();
   });
+  web_server_.on("/ambient", [this]() {
+    handleHttpToAmbient_();
+  });
+  web_server_.on("/stress", [this]() {
+    handleHttpToStress_();
+  });
+  web_server_.on("/api/tz", [this]() {
+    handleHttpToTimezoneSearch_();
+  });
+  web_server_.on("/api/state", HTTP_GET, [this]() {
+    handleHttpToApiState_();
+  });
+  web_server_.on("/api/color", HTTP_POST, [this]() {
+    handleHttpToApiColor_();
+  });
+  web_server_.on("/api/mode", HTTP_POST, [this]() {
+    handleHttpToApiMode_();
+  });
+  web_server_.on("/api/word", HTTP_POST, [this]() {
+    handleHttpToApiWord_();
+  });
+  web_server_.on("/api/brightness", HTTP_POST, [this]() {
+    handleHttpToApiBrightness_();
+  });
+  for (const WebAsset& asset : webAssets) {
+    web_server_.on(asset.path, [this, &asset]() {
+      handleHttpToAsset_(asset);
+    });
+  }
+  // the only request header the handlers look at
+  static const char* headers[] = {"If-None-Match"};
+  web_server_.collectHeaders(headers, 1);
   web_server_.onNotFound([this]() {
     iot_web_conf_.handleNotFound();
   });
@@ -629,22 +913,24 @@ void IotConfig::loop() {
   }
 
   now = millis();
-  // Do a regular NTP re-connect as long as we're not connected to the NTP server
-  if (NTPState_ == NTP_Connecting &&
+  // Try again soon while there is no time from NTP, or the last sync failed
+  if ((NTPState_ == NTP_Connecting ||
+       sntp_.state() == SntpClient::State::FAILED) &&
       now - lastNTPConnect_ > NTP_POLL_SHORT_DELAY_SECONDS * 1000) {
     connectNTP_();
   }
-  // Every so many hours, we want to reconnect to the NTP server
-  if (now - lastNTPConnect_ > NTP_POLL_LONG_DELAY_SECONDS * 1000) {
+  // Sync again once the clock may have drifted too far
+  if (now - lastNTPConnect_ > ntpPollSeconds_ * 1000UL) {
     connectNTP_();
   }
 
+  // closes the sync when the answers are in, and calls back
+  sntp_.loop(esp_timer_get_time());
+
   updateNTPLEDStatus_(); // controls the LED pin
-  if (NTPState_ == NTP_Connecting) {
-    if (isNTPConnected_()) {
-      Serial.println("NTP connection succesful");
-      NTPState_ = NTP_Connected;
-    }
+
+  if (api_save_pending_ && now - last_api_change_ >= API_SAVE_DELAY_MS) {
+    saveApiChanges_();
   }
 
   iot_web_conf_.doLoop();
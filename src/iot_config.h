@@ -2,12 +2,20 @@
 #define WORDCLOCK_IOT_CONFIG_H_
 
 //#include "clock.h"
+#include "AsyncUdpTransport.h"
 #include "Display.h"
+#include "JsonReader.h"
+#include "RtcClock.h"
+#include "SntpClient.h"
+#include "WebAssets.h"
 
 #include <IotWebConf.h>
 
 // Maximum length of a single IoT configuration value.
 #define IOT_CONFIG_VALUE_LENGTH 32
+// Maximum number of custom parameters (and separators) on the configuration
+// page.
+#define IOT_CONFIG_MAX_PARAMETERS 24
 
 enum NTPState {NTP_Waiting, NTP_Connecting, NTP_Connected};
 
@@ -20,7 +28,7 @@ class IotConfig {
   public:
     // Constructs a new IoT configuration with the provided dependencies.
 //    IotConfig(WordClock* word_clock);
-    IotConfig(Display* display);
+    IotConfig(Display* display, RtcClock* rtc);
     ~IotConfig();
 
     IotConfig(const IotConfig&) = delete;
@@ -44,18 +52,76 @@ class IotConfig {
 
     // Handles HTTP requests to web server's "/" path.
     void handleHttpToRoot_();
-    // Handles HTTP requests to web server's "/config" path.
+    // Handles HTTP requests to web server's "/config" path. The page is
+    // streamed in chunks; a posted form is handled by IotWebConf.
     void handleHttpToConfig_();
+    // Adds a parameter to IotWebConf, and to the configuration page.
+    void addParameter_(IotWebConfParameter* param);
+    // Handles HTTP requests to web server's "/ambient" path: the ambient light
+    // histogram and the brightness calibration, as JSON.
+    void handleHttpToAmbient_();
+    // Handles HTTP requests to web server's "/stress" path: the metrics of the
+    // last run of a stress mode, as JSON.
+    void handleHttpToStress_();
+    // Handles HTTP requests to web server's "/api/tz?q=<text>" path: the time
+    // zones matching the text, as JSON, for the typeahead of the time zone.
+    void handleHttpToTimezoneSearch_();
+    // Whether the request comes with the admin password, which is asked for
+    // once the clock is online (as IotWebConf does for its pages). Asks for it
+    // if not.
+    bool authenticate_();
+    // Handles HTTP requests to web server's "/api/state" path: the settings
+    // the API changes, as JSON.
+    void handleHttpToApiState_();
+    // Answers an API request with the state.
+    void sendApiState_();
+    // Handle POST requests to web server's "/api/color", "/api/mode",
+    // "/api/word" and "/api/brightness" paths, with a JSON object such as
+    // {"color":"#RRGGBB"}. The change is shown at once, and saved a while
+    // later unless the object has "save":false. Answer with the state.
+    void handleHttpToApiColor_();
+    void handleHttpToApiMode_();
+    void handleHttpToApiWord_();
+    void handleHttpToApiBrightness_();
+    // The body of an API request, and the JSON object in it. The body is a
+    // copy: WebServer::arg() returns the request's by value, and there is no
+    // other way to get it.
+    struct ApiRequest {
+      explicit ApiRequest(WebServer& server)
+          : body(server.arg("plain")), json(body.c_str(), body.length()) {}
+      const String body;
+      const JsonReader json;
+    };
+    // Schedules the save of a change made through the API, and answers with
+    // the state.
+    void handleApiChange_(const JsonReader& request);
+    // Answers an API request with an error.
+    void sendApiError_(const char* message);
+    // Saves the configuration, with the changes made through the API.
+    void saveApiChanges_();
+    // Handles HTTP requests to a file of web/ (see WebAssets.h), compressed,
+    // or "not modified" if the browser has it.
+    void handleHttpToAsset_(const WebAsset& asset);
+    // ID of the time zone stored in the configuration, or of the default zone.
+    int16_t resolveTimezone_();
+    // Stores a zone stored by its ID (older versions) by its name from now on.
+    // Called once by setup().
+    void migrateTimezone_();
+    // Checks the values of the configuration page before they are saved.
+    bool validateForm_();
     // Handles configuration changes.
     void handleConfigSaved_();
     // Handles after WiFi connection is established.
     void handleWifiConnected_();
-    // To connect to the NTP server and set timezone
+    // Starts a sync with the NTP servers, if WiFi is connected.
     void connectNTP_();
-    // Check if NTP connection is established
-    bool isNTPConnected_();
+    // Follows the state of the NTP client, for the status LED.
+    void handleNTPState_(SntpClient::State state);
     // To update the LED status based on the NTP connection status
     void updateNTPLEDStatus_();
+    // Feeds a completed NTP sync to the display's time base and to the RTC,
+    // and sets the next sync as far out as the time base's estimate allows.
+    void handleNTPSync_(int64_t monotonic_us, int64_t utc_us);
 
     // Whether IoT configuration was initialized.
     bool initialized_ = false;
@@ -65,6 +131,12 @@ class IotConfig {
     NTPState NTPState_ = NTP_Waiting;
     // For updating NTP connection regularly
     unsigned long lastNTPConnect_ = 0;
+    // Time between two NTP syncs, adapted to the drift of the clock.
+    uint32_t ntpPollSeconds_;
+    // Sends the NTP requests and takes the answers, in the AsyncUDP task.
+    AsyncUdpTransport ntp_transport_;
+    // Asks the NTP servers for the time.
+    SntpClient sntp_;
 
     // Configuration portal's DNS server.
     DNSServer dns_server_;
@@ -72,7 +144,7 @@ class IotConfig {
     WebServer web_server_;
 
     // RTC chip interface.
-//    RTC_DS3231* rtc_ = nullptr;
+    RtcClock* rtc_ = nullptr;
     // Word clock state.
 //    WordClock* word_clock_ = nullptr;
     Display* display_ = nullptr;
@@ -95,9 +167,9 @@ class IotConfig {
     // Daylight saving time parameter value.
     //char dst_value_[IOT_CONFIG_VALUE_LENGTH];
 
-    // Configuration portal's timezone index from available options.
+    // Configuration portal's timezone, by name (see Timezones.h).
     IotWebConfParameter timezone_param_;
-    // Index of the selected timezone.
+    // Name of the selected timezone.
     char timezone_value_[IOT_CONFIG_VALUE_LENGTH];
   
     // Configuration portal's appearance parameter separator.
@@ -107,11 +179,21 @@ class IotConfig {
     IotWebConfParameter show_ampm_param_;
     // Value of the show AMPM parameter.
     char show_ampm_value_[IOT_CONFIG_VALUE_LENGTH];
+
+    // Transition style when the time changes.
+    IotWebConfParameter transition_param_;
+    // Value of the transition style parameter.
+    char transition_value_[IOT_CONFIG_VALUE_LENGTH];
   
     // Sensitivity parameter for the LDR.
     IotWebConfParameter ldr_sensitivity_param_;
     // Value of the LDR sensitivity parameter.
     char ldr_sensitivity_value_[IOT_CONFIG_VALUE_LENGTH];
+
+    // Maximum current the LEDs may draw.
+    IotWebConfParameter power_limit_param_;
+    // Value of the power limit parameter, in mA.
+    char power_limit_value_[IOT_CONFIG_VALUE_LENGTH];
   
     // Configuration portal's palette parameter definition.
     // IotWebConfParameter palette_id_param_;
@@ -141,13 +223,29 @@ class IotConfig {
     // Find word parameter value
     char find_word_value_[IOT_CONFIG_VALUE_LENGTH];
 
+    // Updates per second of the stress modes.
+    IotWebConfParameter stress_rate_param_;
+    // Stress rate parameter value.
+    char stress_rate_value_[IOT_CONFIG_VALUE_LENGTH];
+
     // Configuration portal's fast time factor parameter definition.
     // IotWebConfParameter fast_time_factor_param_;
     // Fast time factor parameter value.
     // char fast_time_factor_value_[IOT_CONFIG_VALUE_LENGTH];
 
+    // Whether changes made through the API are still to be saved.
+    bool api_save_pending_ = false;
+    // Whether the configuration is being saved by saveApiChanges_().
+    bool saving_api_changes_ = false;
+    // When the last change to be saved was made through the API.
+    unsigned long last_api_change_ = 0;
+
     // IotWebConf interface handle.
     IotWebConf iot_web_conf_;
+    // The custom parameters, in the order of the configuration page.
+    IotWebConfParameter* parameters_[IOT_CONFIG_MAX_PARAMETERS];
+    // Number of parameters in parameters_.
+    uint8_t parameter_count_ = 0;
 };
 
 #endif  // WORDCLOCK_IOT_CONFIG_H_
@@ -3,8 +3,8 @@
 // Define debug to turn on debug logging.
 // #define DEBUG 1
 
-// DLOG and DLOGLN are equivalent of Serial.print and println, but turned off by
-// the DEBUG macro absence.
+// DLOG, DLOGLN and DLOGF are equivalent of Serial.print, println and printf,
+// but turned off by the DEBUG macro absence.
 // DCHECK only log if the first parameter is false.
 // setupLogin() must be called from setup() for everything to work.
 
@@ -14,6 +14,7 @@
 
 #define DLOG(...) Serial.print(__VA_ARGS__)
 #define DLOGLN(...) Serial.println(__VA_ARGS__)
+#define DLOGF(...) Serial.printf(__VA_ARGS__)
 #define DCHECK(condition, ...) \
     if (!(condition))          \
     {                          \
@@ -36,6 +37,7 @@
 
 #define DLOG(...)
 #define DLOGLN(...)
+#define DLOGF(...)
 #define DCHECK(condition, ...)
 
 #define setupLogging()
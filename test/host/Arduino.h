@@ -0,0 +1,56 @@
+#pragma once
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <esp_timer.h>
+
+//
+// Stand-in for the parts of the Arduino core that the modules under test use,
+// in the native tests. Time comes from esp_timer_get_time() (see esp_timer.h),
+// and the analog input from hostAnalogRead.
+//
+
+#define PROGMEM
+#define INPUT 0x01
+#define OUTPUT 0x03
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::max;
+using std::min;
+
+// 32 bits, as unsigned long is on the ESP32: differences wrap the same way.
+inline uint32_t micros() { return static_cast<uint32_t>(esp_timer_get_time()); }
+inline uint32_t millis() { return static_cast<uint32_t>(esp_timer_get_time() / 1000); }
+
+inline void pinMode(uint8_t, uint8_t) {}
+
+inline uint32_t esp_random() { return static_cast<uint32_t>(rand()); }
+
+// What analogRead() returns, for every pin.
+inline int (*hostAnalogRead)(uint8_t pin) = nullptr;
+
+inline uint16_t analogRead(uint8_t pin) { return hostAnalogRead != nullptr ? hostAnalogRead(pin) : 0; }
+
+// Prints to stdout.
+class HostSerial
+{
+public:
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    va_list args;
+    va_start(args, format);
+    int n = vprintf(format, args);
+    va_end(args);
+    return n > 0 ? n : 0;
+  }
+};
+
+inline HostSerial Serial;
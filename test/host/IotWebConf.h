@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+//
+// Stand-in for the parameters of IotWebConf 2.3.3 in the native tests, with
+// the fields the configuration page renders.
+//
+
+class IotWebConfParameter
+{
+public:
+  IotWebConfParameter(const char *label, const char *id, char *valueBuffer, int length,
+                      const char *type = "text", const char *placeholder = nullptr,
+                      const char *defaultValue = nullptr, const char *customHtml = nullptr,
+                      bool visible = true)
+      : label(label), valueBuffer(valueBuffer), length(length), type(type),
+        placeholder(placeholder), customHtml(customHtml), visible(visible), _id(id) {}
+
+  const char *getId() { return _id; }
+
+  const char *label;
+  char *valueBuffer;
+  int length;
+  const char *type;
+  const char *placeholder;
+  const char *customHtml;
+  bool visible;
+  const char *errorMessage = nullptr;
+
+private:
+  const char *_id = nullptr;
+};
+
+// Starts a new group of parameters.
+class IotWebConfSeparator : public IotWebConfParameter
+{
+public:
+  explicit IotWebConfSeparator(const char *label = nullptr)
+      : IotWebConfParameter(label, nullptr, nullptr, 0, nullptr) {}
+};
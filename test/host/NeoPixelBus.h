@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Stand-in for the color types of NeoPixelBus in the native tests, enough for
+// the output code (see FakeChannel) and the modes. The conversion and the
+// blend compute what NeoPixelBus does.
+//
+
+struct HslColor
+{
+  HslColor(float h, float s, float l) : H(h), S(s), L(l) {}
+
+  float H;
+  float S;
+  float L;
+};
+
+struct RgbColor
+{
+  RgbColor(uint8_t brightness = 0) : R(brightness), G(brightness), B(brightness) {}
+  RgbColor(uint8_t r, uint8_t g, uint8_t b) : R(r), G(g), B(b) {}
+
+  RgbColor(const HslColor &color)
+  {
+    float r = color.L, g = color.L, b = color.L;
+    if (color.S != 0.0f && color.L != 0.0f)
+    {
+      float q = color.L < 0.5f ? color.L * (1.0f + color.S) : color.L + color.S - color.L * color.S;
+      float p = 2.0f * color.L - q;
+      r = hue(p, q, color.H + 1.0f / 3.0f);
+      g = hue(p, q, color.H);
+      b = hue(p, q, color.H - 1.0f / 3.0f);
+    }
+    R = static_cast<uint8_t>(r * 255.0f);
+    G = static_cast<uint8_t>(g * 255.0f);
+    B = static_cast<uint8_t>(b * 255.0f);
+  }
+
+  static RgbColor LinearBlend(const RgbColor &left, const RgbColor &right, float progress)
+  {
+    return RgbColor(left.R + (right.R - left.R) * progress,
+                    left.G + (right.G - left.G) * progress,
+                    left.B + (right.B - left.B) * progress);
+  }
+
+  bool operator==(const RgbColor &other) const { return R == other.R && G == other.G && B == other.B; }
+  bool operator!=(const RgbColor &other) const { return !(*this == other); }
+
+  uint8_t R;
+  uint8_t G;
+  uint8_t B;
+
+private:
+  static float hue(float p, float q, float t)
+  {
+    if (t < 0.0f)
+      t += 1.0f;
+    if (t > 1.0f)
+      t -= 1.0f;
+    if (t < 1.0f / 6.0f)
+      return p + (q - p) * 6.0f * t;
+    if (t < 0.5f)
+      return q;
+    if (t < 2.0f / 3.0f)
+      return p + (q - p) * (2.0f / 3.0f - t) * 6.0f;
+    return p;
+  }
+};
+
+struct NeoGrbFeature
+{
+  typedef RgbColor ColorObject;
+  static const size_t PixelSize = 3;
+};
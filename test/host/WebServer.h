@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+//
+// Stand-in for the response side of the ESP32 WebServer in the native tests:
+// records what a handler sends instead of sending it.
+//
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer
+{
+public:
+  void setContentLength(size_t length) { contentLength = length; }
+
+  void send(int code, const char *type, const char *content)
+  {
+    this->code = code;
+    this->type = type;
+    body = content;
+  }
+
+  // Every call is one chunk of a response of unknown length.
+  void sendContent(const char *content, size_t length) { chunks.emplace_back(content, length); }
+
+  size_t contentLength = 0;
+  int code = 0;
+  std::string type;
+  std::string body;
+  std::vector<std::string> chunks;
+};
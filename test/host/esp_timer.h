@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <chrono>
+
+//
+// Stand-in for the ESP-IDF timer API in the native tests (see the native env
+// in platformio.ini).
+//
+// The time is the host's monotonic clock, unless a test runs it by hand:
+// with hostTimeUs set to 0 or more, that is the time. The periodic timer does
+// not run on its own either: a test calls hostTimerCallback(hostTimerArg)
+// for every period it wants to pass.
+//
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+typedef enum
+{
+  ESP_TIMER_TASK
+} esp_timer_dispatch_t;
+typedef struct
+{
+  esp_timer_cb_t callback;
+  void *arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char *name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+typedef int esp_err_t;
+#define ESP_OK 0
+
+inline int64_t hostTimeUs = -1;
+inline esp_timer_cb_t hostTimerCallback = nullptr;
+inline void *hostTimerArg = nullptr;
+
+inline int64_t esp_timer_get_time()
+{
+  if (hostTimeUs >= 0)
+    return hostTimeUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *timer)
+{
+  hostTimerCallback = args->callback;
+  hostTimerArg = args->arg;
+  *timer = reinterpret_cast<esp_timer_handle_t>(&hostTimerCallback);
+  return ESP_OK;
+}
+
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t, uint64_t) { return ESP_OK; }
+inline esp_err_t esp_timer_stop(esp_timer_handle_t) { return ESP_OK; }
+
+inline esp_err_t esp_timer_delete(esp_timer_handle_t)
+{
+  hostTimerCallback = nullptr;
+  hostTimerArg = nullptr;
+  return ESP_OK;
+}
@@ -0,0 +1,172 @@
+//
+// AmbientHistogram replaying three synthetic days of a room, a filtered
+// sensor value a second: day, evening and night levels with 5% noise. The
+// calibration must come from the 5th, 50th and 95th percentiles of the
+// samples it took.
+//
+
+#include <math.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <unity.h>
+
+#include "AmbientHistogram.h"
+
+namespace
+{
+  const unsigned long HOUR_MS = 3600000UL;
+  const unsigned long DAY_MS = 24 * HOUR_MS;
+
+  // Light of the room at uptime `ms`, before the noise.
+  double roomLevel(unsigned long ms)
+  {
+    double hour = fmod(ms / static_cast<double>(HOUR_MS), 24);
+    if (hour > 8 && hour < 20)
+      return 2500;
+    if (hour > 20 && hour < 23)
+      return 400;
+    return 30;
+  }
+
+  // Replays the room for `days` days from uptime 0, every `stepMs`. Returns
+  // the values the histogram took.
+  std::vector<uint16_t> replay(AmbientHistogram &histogram, unsigned long days, unsigned long stepMs)
+  {
+    std::mt19937 random(1);
+    std::normal_distribution<double> noise(0, 0.05);
+    std::vector<uint16_t> taken;
+    for (unsigned long ms = 0; ms < days * DAY_MS; ms += stepMs)
+    {
+      uint16_t value = static_cast<uint16_t>(std::min(4095.0, roomLevel(ms) * exp(noise(random))));
+      if (histogram.record(ms, value))
+        taken.push_back(value);
+    }
+    return taken;
+  }
+
+  // One past the highest ADC value of a bin, the way calibrate() takes it.
+  uint16_t binEnd(uint8_t bin)
+  {
+    return bin + 1 < AmbientHistogram::BINS ? AmbientHistogram::binStart(bin + 1) : 4096;
+  }
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_bins()
+{
+  for (uint16_t value = 0; value < 4096; value++)
+  {
+    uint8_t bin = AmbientHistogram::binOf(value);
+    TEST_ASSERT_TRUE(bin < AmbientHistogram::BINS);
+    TEST_ASSERT_TRUE(AmbientHistogram::binStart(bin) <= value);
+    // the lowest bins all start at 0, and only the first of them is used
+    uint8_t next = bin + 1;
+    while (next < AmbientHistogram::BINS && AmbientHistogram::binStart(next) == AmbientHistogram::binStart(bin))
+      next++;
+    TEST_ASSERT_TRUE(next == AmbientHistogram::BINS || value < AmbientHistogram::binStart(next));
+  }
+  // a quarter octave apart, once the values are large enough
+  for (uint8_t bin = 28; bin + 4 < AmbientHistogram::BINS; bin++)
+    TEST_ASSERT_UINT32_WITHIN(2, 2 * AmbientHistogram::binStart(bin), AmbientHistogram::binStart(bin + 4));
+}
+
+void test_one_sample_a_minute()
+{
+  AmbientHistogram histogram;
+  TEST_ASSERT_TRUE(histogram.record(0, 100));
+  TEST_ASSERT_FALSE(histogram.record(59999, 100));
+  TEST_ASSERT_TRUE(histogram.record(60000, 100));
+  TEST_ASSERT_EQUAL_UINT32(2, histogram.samples());
+  TEST_ASSERT_EQUAL_UINT16(2, histogram.count(0, AmbientHistogram::binOf(100)));
+}
+
+void test_not_valid_before_6_hours()
+{
+  AmbientHistogram histogram;
+  for (unsigned long minute = 0; minute + 1 < AMBIENT_MIN_SAMPLES; minute++)
+    histogram.record(minute * 60000, 500);
+  TEST_ASSERT_FALSE(histogram.calibrate().valid);
+  histogram.record(AMBIENT_MIN_SAMPLES * 60000UL, 500);
+  TEST_ASSERT_TRUE(histogram.calibrate().valid);
+}
+
+void test_calibration_of_three_days()
+{
+  AmbientHistogram histogram;
+  std::vector<uint16_t> taken = replay(histogram, 3, 1000);
+  TEST_ASSERT_EQUAL_UINT32(3 * 24 * 60, taken.size());
+  TEST_ASSERT_EQUAL_UINT32(taken.size(), histogram.samples());
+  for (uint8_t day = 0; day < 3; day++)
+  {
+    uint32_t count = 0;
+    for (uint8_t bin = 0; bin < AmbientHistogram::BINS; bin++)
+      count += histogram.count(day, bin);
+    TEST_ASSERT_EQUAL_UINT32(24 * 60, count);
+  }
+
+  std::sort(taken.begin(), taken.end());
+  size_t n = taken.size();
+  uint16_t p5 = taken[(n * 5 + 99) / 100 - 1];
+  uint16_t p50 = taken[(n * 50 + 99) / 100 - 1];
+  uint16_t p95 = taken[(n * 95 + 99) / 100 - 1];
+  uint8_t medianBin = AmbientHistogram::binOf(p50);
+
+  AmbientCalibration calibration = histogram.calibrate();
+  TEST_ASSERT_TRUE(calibration.valid);
+  TEST_ASSERT_EQUAL_UINT16(AmbientHistogram::binStart(AmbientHistogram::binOf(p5)), calibration.low);
+  TEST_ASSERT_EQUAL_UINT16(binEnd(AmbientHistogram::binOf(p95)) - 1, calibration.high);
+  TEST_ASSERT_EQUAL_UINT16((binEnd(medianBin) - AmbientHistogram::binStart(medianBin)) / 2,
+                           calibration.hysteresis);
+
+  // the night at the bottom, the day at the top, within a bin
+  TEST_ASSERT_TRUE(calibration.low <= 30 && calibration.low >= 20);
+  TEST_ASSERT_TRUE(calibration.high >= 2500 && calibration.high < 3600);
+  // the day is half of the samples, so the median is in the evening
+  // light, and the hysteresis half its bin
+  TEST_ASSERT_TRUE(p50 > 300 && p50 < 500);
+  TEST_ASSERT_UINT16_WITHIN(4, 32, calibration.hysteresis);
+}
+
+void test_a_week_is_kept()
+{
+  AmbientHistogram histogram;
+  replay(histogram, 9, 60000);
+  TEST_ASSERT_EQUAL_UINT32(AMBIENT_DAYS * 24 * 60, histogram.samples());
+  TEST_ASSERT_EQUAL_UINT16(0, histogram.count(AMBIENT_DAYS, 0));
+}
+
+void test_json()
+{
+  AmbientHistogram histogram;
+  replay(histogram, 3, 60000);
+  size_t length = histogram.toJson(nullptr, 0);
+  std::vector<char> json(length + 1);
+  TEST_ASSERT_EQUAL_UINT32(length, histogram.toJson(json.data(), json.size()));
+  TEST_ASSERT_EQUAL_UINT32(length, strlen(json.data()));
+  TEST_ASSERT_EQUAL_INT(0, strncmp(json.data(), "{\"sampleMinutes\":1,\"binStart\":[0,", 33));
+  TEST_ASSERT_NOT_NULL(strstr(json.data(), "\"calibration\":{\"valid\":true,"));
+  TEST_ASSERT_EQUAL_INT(0, strcmp(json.data() + length - 2, "}}"));
+
+  // cut short, and still terminated
+  char small[16];
+  TEST_ASSERT_EQUAL_UINT32(length, histogram.toJson(small, sizeof(small)));
+  TEST_ASSERT_EQUAL_UINT32(sizeof(small) - 1, strlen(small));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_bins);
+  RUN_TEST(test_one_sample_a_minute);
+  RUN_TEST(test_not_valid_before_6_hours);
+  RUN_TEST(test_calibration_of_three_days);
+  RUN_TEST(test_a_week_is_kept);
+  RUN_TEST(test_json);
+  return UNITY_END();
+}
@@ -0,0 +1,138 @@
+//
+// ClockDiscipline against a simulated oscillator.
+//
+// The monotonic clock runs 23 ppm slow plus a slow random walk of its
+// frequency, and every sync carries 3 ms of Gaussian noise. The syncs are
+// planned by holdoverSeconds(), for an error budget of 100 ms.
+//
+
+#include <math.h>
+
+#include <random>
+
+#include <unity.h>
+
+#include "ClockDiscipline.h"
+
+namespace
+{
+  const int64_t SECOND_US = 1000000;
+  const int64_t DAY_S = 86400;
+  const int64_t BUDGET_US = 100000;
+
+  struct Oscillator
+  {
+    double ppm = -23.0;
+    double utcUs = 1.7e15;
+    double nowUs = 1e6;
+
+    // The frequency error as ClockDiscipline::driftPpm() gives it.
+    double driftPpm() const { return -ppm / (1 + ppm * 1e-6); }
+
+    void second(std::mt19937 &random, std::normal_distribution<double> &walk)
+    {
+      ppm += walk(random) / 3600;
+      utcUs += SECOND_US;
+      nowUs += SECOND_US * (1 + ppm * 1e-6);
+    }
+  };
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_not_synced_without_samples()
+{
+  ClockDiscipline discipline;
+  TEST_ASSERT_FALSE(discipline.isSynced());
+  discipline.addSample(SECOND_US, 1700000000 * SECOND_US);
+  TEST_ASSERT_TRUE(discipline.isSynced());
+  TEST_ASSERT_EQUAL_INT64(1700000001 * SECOND_US, discipline.utc(2 * SECOND_US));
+}
+
+void test_two_weeks_of_drift()
+{
+  std::mt19937 random(7);
+  std::normal_distribution<double> noise(0, 3000);
+  std::normal_distribution<double> walk(0, 0.02);
+
+  ClockDiscipline discipline;
+  Oscillator oscillator;
+  int64_t nextSync = 0;
+  int64_t lastUtc = 0;
+  double worstUs = 0;
+  for (int64_t s = 0; s < 14 * DAY_S; s++)
+  {
+    oscillator.second(random, walk);
+    int64_t nowUs = static_cast<int64_t>(oscillator.nowUs);
+    if (s == nextSync)
+    {
+      discipline.addSample(nowUs, static_cast<int64_t>(oscillator.utcUs + noise(random)));
+      uint32_t holdover = discipline.holdoverSeconds(BUDGET_US, DAY_S);
+      nextSync = s + (holdover < 3600 ? 3600 : holdover);
+      if (discipline.sampleCount() == 3)
+        TEST_ASSERT_FLOAT_WITHIN(0.2, oscillator.driftPpm(), discipline.driftPpm());
+    }
+
+    int64_t utc = discipline.utc(nowUs);
+    TEST_ASSERT_TRUE(utc >= lastUtc);
+    lastUtc = utc;
+    if (s > DAY_S)
+    {
+      double errorUs = fabs(utc - oscillator.utcUs);
+      if (errorUs > worstUs)
+        worstUs = errorUs;
+      // the uncertainty is a fair bound
+      TEST_ASSERT_TRUE(errorUs < 2 * discipline.uncertaintyUs(nowUs));
+    }
+  }
+
+  TEST_ASSERT_FLOAT_WITHIN(0.05, oscillator.driftPpm(), discipline.driftPpm());
+  TEST_ASSERT_TRUE(worstUs < 10000);
+  // the drift is known well enough for the longest interval
+  TEST_ASSERT_EQUAL_UINT32(DAY_S, discipline.holdoverSeconds(BUDGET_US, DAY_S));
+}
+
+void test_corrections_are_slewed()
+{
+  ClockDiscipline discipline;
+  int64_t utc0 = 1700000000 * SECOND_US;
+  const int64_t hourUs = 3600 * SECOND_US;
+  discipline.addSample(0, utc0);
+  discipline.addSample(hourUs, utc0 + hourUs);
+  // 200 ms off: no jump, utc() moves at most DISCIPLINE_MAX_SLEW_PPM (plus the
+  // new frequency) faster than the clock until it caught up
+  discipline.addSample(2 * hourUs, utc0 + 2 * hourUs + 200000);
+  const int64_t maxStepUs = SECOND_US * (DISCIPLINE_MAX_SLEW_PPM + DISCIPLINE_CRYSTAL_PPM) / 1000000;
+  int64_t last = discipline.utc(2 * hourUs);
+  for (int64_t nowUs = 2 * hourUs + SECOND_US; nowUs < 3 * hourUs; nowUs += SECOND_US)
+  {
+    int64_t utc = discipline.utc(nowUs);
+    TEST_ASSERT_INT64_WITHIN(maxStepUs, SECOND_US, utc - last);
+    last = utc;
+  }
+  // and it caught up with the line through the offsets 0, 0 and 200 ms:
+  // 100 ms an hour, 266.7 ms at 3 h
+  TEST_ASSERT_INT64_WITHIN(1000, utc0 + 3 * hourUs + 266667, discipline.utc(3 * hourUs));
+}
+
+void test_large_corrections_are_stepped()
+{
+  ClockDiscipline discipline;
+  int64_t utc0 = 1700000000 * SECOND_US;
+  discipline.addSample(0, utc0);
+  discipline.addSample(10 * SECOND_US, utc0 + 10 * SECOND_US + 5 * SECOND_US);
+  TEST_ASSERT_EQUAL_INT64(utc0 + 20 * SECOND_US, discipline.utc(15 * SECOND_US));
+  TEST_ASSERT_EQUAL_INT(1, discipline.sampleCount());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_not_synced_without_samples);
+  RUN_TEST(test_two_weeks_of_drift);
+  RUN_TEST(test_corrections_are_slewed);
+  RUN_TEST(test_large_corrections_are_stepped);
+  return UNITY_END();
+}
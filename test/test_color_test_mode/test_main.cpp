@@ -0,0 +1,146 @@
+//
+// The color test on a mock display, on a clock run by hand (see test/host):
+// with the seed fixed by setColorTestSeed(), a run is replayed frame by frame.
+//
+
+#include <Arduino.h>
+
+#include <vector>
+
+#include <unity.h>
+
+#include "ColorTestMode.h"
+#include "GridSize.h"
+
+namespace
+{
+  typedef WordClockGrid Grid;
+
+  // Time between two frames [us].
+  const int64_t FRAME_US = 16000;
+
+  class MockDisplay
+  {
+  public:
+    struct Compositor
+    {
+      enum LayerId
+      {
+        BASE,
+        EFFECT,
+        OVERLAY,
+
+        LAYER_COUNT
+      };
+    };
+
+    struct Layer
+    {
+      void setPixel(uint16_t index, const RgbColor &color) { pixels[index] = color; }
+      RgbColor getPixel(uint16_t index) const { return pixels[index]; }
+      void clear()
+      {
+        for (RgbColor &pixel : pixels)
+          pixel = RgbColor(0);
+      }
+
+      RgbColor pixels[Grid::PixelCount];
+    };
+
+    // Takes the colors as they are.
+    struct Brightness
+    {
+      void loop() {}
+      RgbColor correct(const RgbColor &color) const { return color; }
+    };
+
+    explicit MockDisplay(uint32_t seed) : _seed(seed) {}
+
+    void transition(uint16_t, bool) {}
+    uint32_t colorTestSeed() const { return _seed; }
+    Brightness &brightnessController() { return _brightness; }
+    Layer &layer(typename Compositor::LayerId) { return _effect; }
+    AnimationTimeline &animations(typename Compositor::LayerId) { return _animations; }
+
+  private:
+    uint32_t _seed;
+    Brightness _brightness;
+    Layer _effect;
+    AnimationTimeline _animations{Grid::PixelCount};
+  };
+
+  // The effect layer after each of `frames` frames of the color test, run
+  // with `seed`.
+  std::vector<uint8_t> run(uint32_t seed, uint32_t frames)
+  {
+    hostTimeUs = 1000;
+    MockDisplay display(seed);
+    ColorTestMode<Grid> mode;
+    std::vector<uint8_t> trace;
+    mode.enter(display);
+    for (uint32_t i = 0; i < frames; i++)
+    {
+      hostTimeUs += FRAME_US;
+      mode.tick(display);
+      display.animations(MockDisplay::Compositor::EFFECT).update(micros());
+      for (const RgbColor &pixel : display.layer(MockDisplay::Compositor::EFFECT).pixels)
+      {
+        trace.push_back(pixel.R);
+        trace.push_back(pixel.G);
+        trace.push_back(pixel.B);
+      }
+    }
+    mode.exit(display);
+    return trace;
+  }
+
+  // Pixels lit after the `frame`th frame of a trace.
+  uint16_t lit(const std::vector<uint8_t> &trace, uint32_t frame)
+  {
+    uint16_t count = 0;
+    const uint8_t *pixel = trace.data() + frame * Grid::PixelCount * 3;
+    for (uint16_t i = 0; i < Grid::PixelCount; i++, pixel += 3)
+    {
+      if (pixel[0] != 0 || pixel[1] != 0 || pixel[2] != 0)
+        count++;
+    }
+    return count;
+  }
+} // namespace
+
+void setUp() {}
+
+void tearDown() { hostTimeUs = -1; }
+
+void test_a_seed_replays_the_run()
+{
+  // 5 s: pixels started, faded out and started again
+  std::vector<uint8_t> first = run(1234, 300);
+  std::vector<uint8_t> second = run(1234, 300);
+  TEST_ASSERT_EQUAL_UINT32(first.size(), second.size());
+  TEST_ASSERT_TRUE(first == second);
+}
+
+void test_another_seed_gives_another_run()
+{
+  TEST_ASSERT_FALSE(run(1234, 300) == run(4321, 300));
+}
+
+void test_the_pixels_fill_up_and_fade()
+{
+  std::vector<uint8_t> trace = run(1234, 300);
+  // the corners from the first frame on, then a pixel every 60 ms at most
+  TEST_ASSERT_TRUE(lit(trace, 0) >= Grid::Signals);
+  TEST_ASSERT_TRUE(lit(trace, 0) <= Grid::Signals + 1);
+  // a fade takes 1.7 to 2.1 s, so after that about 30 pixels are lit
+  TEST_ASSERT_UINT16_WITHIN(8, 32, lit(trace, 299));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_a_seed_replays_the_run);
+  RUN_TEST(test_another_seed_gives_another_run);
+  RUN_TEST(test_the_pixels_fill_up_and_fade);
+  return UNITY_END();
+}
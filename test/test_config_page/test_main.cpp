@@ -0,0 +1,112 @@
+//
+// The configuration page, rendered into a stand-in WebServer that keeps the
+// chunks it is sent (see test/host).
+//
+
+#include <string>
+
+#include <unity.h>
+
+#include "ConfigPage.h"
+
+namespace
+{
+  char name[] = "Clock \"<1>\"";
+  char password[] = "secret";
+  char brightness[] = "5";
+  char hidden[] = "x";
+
+  IotWebConfParameter nameParam("Name", "name", name, 32);
+  IotWebConfParameter passwordParam("Password & PIN", "pass", password, 16, "password");
+  IotWebConfSeparator clockSeparator("Clock");
+  IotWebConfParameter brightnessParam("Brightness", "bright", brightness, 4, "number", "1..10",
+                                      nullptr, "min='1' max='10'");
+  IotWebConfParameter hiddenParam("Hidden", "hidden", hidden, 4, "text", nullptr, nullptr,
+                                  nullptr, false);
+
+  const char EXPECTED[] =
+      "<!DOCTYPE html><html lang=\"en\"><head><meta charset=\"UTF-8\"/>"
+      "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1, "
+      "user-scalable=no\"/><title>Word &amp; Clock</title>\n"
+      "<link rel=\"stylesheet\" href=\"/c.css\"/>"
+      "</head><body><header/>"
+      "<div style=\"text-align:left;display:inline-block;min-width:260px;\">\n"
+      "<form action=\"\" method=\"post\">"
+      "<input type=\"hidden\" name=\"iotSave\" value=\"true\">"
+      "<fieldset id=\"iwcSys\"><legend>System configuration</legend>\n"
+      "<div><label for=\"name\">Name</label><input type=\"text\" id=\"name\" "
+      "name=\"name\" maxlength=\"31\" placeholder=\"\" "
+      "value=\"Clock &quot;&lt;1&gt;&quot;\" /><div class=\"em\"></div></div>\n"
+      "<div><label for=\"pass\">Password &amp; PIN</label><input type=\"password\" "
+      "id=\"pass\" name=\"pass\" maxlength=\"15\" placeholder=\"\" value=\"\" />"
+      "<div class=\"em\"></div></div>\n"
+      "</fieldset><fieldset><legend>Clock</legend>\n"
+      "<div class=\"de\"><label for=\"bright\">Brightness</label><input type=\"number\" "
+      "id=\"bright\" name=\"bright\" maxlength=\"3\" placeholder=\"1..10\" value=\"5\" "
+      "min='1' max='10'/><div class=\"em\">Too &lt; 1</div></div>\n"
+      "</fieldset><button type=\"submit\">Apply</button></form>\n"
+      "<div style=\"font-size: .6em;\">Firmware config version 'v4'</div>\n"
+      "</div></body></html>\n";
+
+  void render(WebServer &server)
+  {
+    ChunkedResponse response(server);
+    response.begin(200, "text/html");
+    ConfigPage page(response);
+    page.begin("Word & Clock");
+    response.write("<link rel=\"stylesheet\" href=\"/c.css\"/>");
+    page.beginForm("<header/>");
+    for (IotWebConfParameter *param :
+         {&nameParam, &passwordParam, static_cast<IotWebConfParameter *>(&clockSeparator),
+          &brightnessParam, &hiddenParam})
+      page.parameter(param);
+    page.end("v4");
+  }
+} // namespace
+
+void setUp() { brightnessParam.errorMessage = "Too < 1"; }
+
+void tearDown() {}
+
+void test_markup()
+{
+  WebServer server;
+  render(server);
+
+  std::string page;
+  for (const std::string &chunk : server.chunks)
+    page += chunk;
+  TEST_ASSERT_EQUAL_STRING(EXPECTED, page.c_str());
+  TEST_ASSERT_TRUE(page.find("<form action=\"\" method=\"post\"><input type=\"hidden\" "
+                             "name=\"iotSave\" value=\"true\">") != std::string::npos);
+  // the password is never sent back
+  TEST_ASSERT_TRUE(page.find(password) == std::string::npos);
+}
+
+void test_chunks()
+{
+  WebServer server;
+  render(server);
+
+  TEST_ASSERT_EQUAL_INT(200, server.code);
+  TEST_ASSERT_EQUAL_STRING("text/html", server.type.c_str());
+  TEST_ASSERT_TRUE(server.contentLength == CONTENT_LENGTH_UNKNOWN);
+  TEST_ASSERT_EQUAL_STRING("", server.body.c_str());
+
+  size_t count = server.chunks.size();
+  size_t length = strlen(EXPECTED);
+  TEST_ASSERT_EQUAL_UINT32((length + CHUNKED_RESPONSE_BUFFER - 1) / CHUNKED_RESPONSE_BUFFER + 1, count);
+  for (size_t i = 0; i + 2 < count; i++)
+    TEST_ASSERT_EQUAL_UINT32(CHUNKED_RESPONSE_BUFFER, server.chunks[i].size());
+  TEST_ASSERT_EQUAL_UINT32(length % CHUNKED_RESPONSE_BUFFER, server.chunks[count - 2].size());
+  // the empty chunk ends the response
+  TEST_ASSERT_EQUAL_UINT32(0, server.chunks[count - 1].size());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_markup);
+  RUN_TEST(test_chunks);
+  return UNITY_END();
+}
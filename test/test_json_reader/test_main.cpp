@@ -0,0 +1,165 @@
+//
+// JsonReader on well formed and broken documents, as the bodies of the
+// control API requests come in.
+//
+
+#include <string.h>
+
+#include <unity.h>
+
+#include "JsonReader.h"
+
+namespace
+{
+  JsonReader read(const char *text) { return JsonReader(text, strlen(text)); }
+
+  void checkInvalid(const char *text) { TEST_ASSERT_FALSE_MESSAGE(read(text).valid(), text); }
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_members()
+{
+  const char *body =
+      " {\"mode\": 2, \"on\":true, \"off\" : false, \"none\":null,"
+      "\"word\":\"TIJD\", \"list\":[1, [2, {}], \"x\"], \"obj\":{\"mode\":7},"
+      "\"neg\":-2147483648, \"big\":2147483648, \"frac\":1.5, \"exp\":1e3}\r\n";
+  JsonReader request = read(body);
+  TEST_ASSERT_TRUE(request.valid());
+
+  int32_t number;
+  TEST_ASSERT_TRUE(request.get("mode").toInt(0, 9, number));
+  TEST_ASSERT_EQUAL_INT32(2, number);
+  TEST_ASSERT_FALSE(request.get("mode").toInt(3, 9, number));
+  TEST_ASSERT_TRUE(request.get("neg").toInt(INT32_MIN, 0, number));
+  TEST_ASSERT_EQUAL_INT32(INT32_MIN, number);
+  TEST_ASSERT_FALSE(request.get("big").toInt(INT32_MIN, INT32_MAX, number));
+  TEST_ASSERT_FALSE(request.get("frac").toInt(0, 9, number));
+  TEST_ASSERT_FALSE(request.get("exp").toInt(0, 9999, number));
+  TEST_ASSERT_FALSE(request.get("word").toInt(0, 9, number));
+
+  bool flag = false;
+  TEST_ASSERT_TRUE(request.get("on").toBool(flag));
+  TEST_ASSERT_TRUE(flag);
+  TEST_ASSERT_TRUE(request.get("off").toBool(flag));
+  TEST_ASSERT_FALSE(flag);
+  TEST_ASSERT_FALSE(request.get("mode").toBool(flag));
+
+  TEST_ASSERT_TRUE(request.get("none").type == JsonValue::Type::Null);
+  TEST_ASSERT_TRUE(request.get("list").type == JsonValue::Type::Array);
+  TEST_ASSERT_TRUE(request.get("obj").type == JsonValue::Type::Object);
+  TEST_ASSERT_FALSE(request.get("missing").exists());
+  // only members of the object itself, not of the ones in it
+  TEST_ASSERT_TRUE(request.get("mode").toInt(0, 9, number));
+  TEST_ASSERT_EQUAL_INT32(2, number);
+
+  char word[8];
+  TEST_ASSERT_TRUE(request.get("word").copyTo(word, sizeof(word)));
+  TEST_ASSERT_EQUAL_STRING("TIJD", word);
+  TEST_ASSERT_FALSE(request.get("word").copyTo(word, 4));
+  TEST_ASSERT_FALSE(request.get("mode").copyTo(word, sizeof(word)));
+  TEST_ASSERT_TRUE(request.get("word").equals("TIJD"));
+  TEST_ASSERT_FALSE(request.get("word").equals("TIJ"));
+  TEST_ASSERT_FALSE(request.get("word").equals("TIJDS"));
+}
+
+void test_escapes()
+{
+  JsonReader request = read("{\"w\\u006Frd\":\"a\\\"b\\\\c\\/d\\n\\t\", \"e\":\"\\u00e9\\u20AC\","
+                            "\"smile\":\"\\ud83d\\ude00!\"}");
+  TEST_ASSERT_TRUE(request.valid());
+
+  char text[16];
+  TEST_ASSERT_TRUE(request.get("word").copyTo(text, sizeof(text)));
+  TEST_ASSERT_EQUAL_STRING("a\"b\\c/d\n\t", text);
+  TEST_ASSERT_TRUE(request.get("e").copyTo(text, sizeof(text)));
+  TEST_ASSERT_EQUAL_STRING("\xC3\xA9\xE2\x82\xAC", text);
+  TEST_ASSERT_TRUE(request.get("e").equals("\xC3\xA9\xE2\x82\xAC"));
+  // one character outside the basic plane, from a surrogate pair
+  TEST_ASSERT_TRUE(request.get("smile").copyTo(text, sizeof(text)));
+  TEST_ASSERT_EQUAL_STRING("\xF0\x9F\x98\x80!", text);
+}
+
+void test_broken_documents()
+{
+  checkInvalid("");
+  checkInvalid("   ");
+  checkInvalid("[]");
+  checkInvalid("1");
+  checkInvalid("\"text\"");
+  checkInvalid("{");
+  checkInvalid("{\"a\":1");
+  checkInvalid("{\"a\":1,}");
+  checkInvalid("{\"a\" 1}");
+  checkInvalid("{a:1}");
+  checkInvalid("{\"a\":1} x");
+  checkInvalid("{\"a\":[1,2}");
+  checkInvalid("{\"a\":tru}");
+  checkInvalid("{\"a\":nul}");
+  checkInvalid("{\"a\":01}");
+  checkInvalid("{\"a\":1.}");
+  checkInvalid("{\"a\":-}");
+  checkInvalid("{\"a\":1e}");
+  checkInvalid("{\"a\":\"open}");
+  checkInvalid("{\"a\":\"tab\there\"}");
+  checkInvalid("{\"a\":\"\\x\"}");
+  checkInvalid("{\"a\":\"\\u12G4\"}");
+  checkInvalid("{\"a\":\"\\u12\"}");
+  // a NUL would cut the string short
+  checkInvalid("{\"a\":\"\\u0000\"}");
+  checkInvalid("{\"a\":\"x\\u0000y\"}");
+  // halves of surrogate pairs
+  checkInvalid("{\"a\":\"\\ud800\"}");
+  checkInvalid("{\"a\":\"\\ud800x\"}");
+  checkInvalid("{\"a\":\"\\ud800\\u0041\"}");
+  checkInvalid("{\"a\":\"\\udc00\"}");
+  checkInvalid("{\"a\":\"\\ude00\\ud83d\"}");
+  TEST_ASSERT_FALSE(read("{\"a\":1} x").get("a").exists());
+}
+
+void test_depth()
+{
+  // the object itself is the first level
+  char text[64] = "{\"a\":";
+  for (int i = 1; i < JSON_READER_MAX_DEPTH; i++)
+    strcat(text, "[");
+  strcat(text, "1");
+  for (int i = 1; i < JSON_READER_MAX_DEPTH; i++)
+    strcat(text, "]");
+  strcat(text, "}");
+  TEST_ASSERT_TRUE(read(text).valid());
+
+  strcpy(text, "{\"a\":");
+  for (int i = 0; i < JSON_READER_MAX_DEPTH; i++)
+    strcat(text, "[");
+  for (int i = 0; i < JSON_READER_MAX_DEPTH; i++)
+    strcat(text, "]");
+  strcat(text, "}");
+  TEST_ASSERT_FALSE(read(text).valid());
+}
+
+void test_not_past_the_length()
+{
+  // the body is not terminated: only `length` bytes are read
+  const char body[] = "{\"a\":12}{\"b\":3}";
+  JsonReader request(body, 8);
+  TEST_ASSERT_TRUE(request.valid());
+  int32_t number;
+  TEST_ASSERT_TRUE(request.get("a").toInt(0, 99, number));
+  TEST_ASSERT_EQUAL_INT32(12, number);
+  TEST_ASSERT_FALSE(JsonReader(body, 7).valid());
+  TEST_ASSERT_FALSE(JsonReader(body, 5).valid());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_members);
+  RUN_TEST(test_escapes);
+  RUN_TEST(test_broken_documents);
+  RUN_TEST(test_depth);
+  RUN_TEST(test_not_past_the_length);
+  return UNITY_END();
+}
@@ -0,0 +1,113 @@
+//
+// LDRReader on a simulated sensor: the room gives `roomLight` ADC counts,
+// and the LEDs add LDR_SELF_ILLUMINATION counts per A of their current. The
+// sampling timer is run by hand, one sample per frame.
+//
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "LDRReader.h"
+
+namespace
+{
+  const uint16_t ROOM = 300;
+  // The LEDs at full brightness.
+  const uint16_t MAX_LED_MILLIAMPS = 2000;
+
+  uint16_t roomLight = 0;
+  uint16_t ledMilliamps = 0;
+
+  int sensor(uint8_t)
+  {
+    return min(4095, roomLight + ledMilliamps * LDR_SELF_ILLUMINATION / 1000);
+  }
+
+  // Runs `seconds` of samples, with the LEDs as bright as the reading says.
+  // With `compensate`, the reader is told their current.
+  void run(LDRReader &reader, float seconds, bool compensate)
+  {
+    for (int i = 0; i < seconds * LDR_SAMPLE_RATE_HZ; i++)
+    {
+      hostTimerCallback(hostTimerArg);
+      ledMilliamps = MAX_LED_MILLIAMPS * reader.reading() / 255;
+      if (compensate)
+        reader.setLedCurrent(ledMilliamps);
+    }
+  }
+} // namespace
+
+void setUp()
+{
+  hostAnalogRead = sensor;
+  roomLight = ROOM;
+  ledMilliamps = 0;
+}
+
+void tearDown() { hostAnalogRead = nullptr; }
+
+void test_starts_at_the_first_reading()
+{
+  LDRReader reader(33, 1.0f, 4);
+  reader.setup();
+  TEST_ASSERT_NOT_NULL(hostTimerCallback);
+  TEST_ASSERT_EQUAL_UINT16(ROOM, reader.value());
+}
+
+void test_follows_a_step_with_the_time_constant()
+{
+  LDRReader reader(33, 1.0f, 1);
+  reader.setup();
+  roomLight = ROOM + 1000;
+  run(reader, 1.0f, true);
+  // 1 - 1/e of the way
+  TEST_ASSERT_UINT16_WITHIN(20, ROOM + 632, reader.value());
+  run(reader, 10.0f, true);
+  TEST_ASSERT_UINT16_WITHIN(2, ROOM + 1000, reader.value());
+}
+
+void test_own_light_is_taken_out()
+{
+  LDRReader reader(33, 1.0f, 4);
+  reader.setup();
+  run(reader, 60.0f, true);
+  TEST_ASSERT_TRUE(ledMilliamps > 500);
+  TEST_ASSERT_UINT16_WITHIN(2, ROOM, reader.value());
+}
+
+void test_own_light_feeds_back_without_the_current()
+{
+  LDRReader reader(33, 1.0f, 4);
+  reader.setup();
+  run(reader, 60.0f, false);
+  TEST_ASSERT_TRUE(reader.value() > ROOM + 100);
+}
+
+void test_response_curves()
+{
+  LDRReader reader(33, 1.0f, 1);
+  TEST_ASSERT_EQUAL_UINT8(0, reader.response(0));
+  TEST_ASSERT_EQUAL_UINT8(128, reader.response(2048));
+  TEST_ASSERT_EQUAL_UINT8(255, reader.response(4095));
+
+  // higher levels respond more to low light
+  reader.setSensitivity(4);
+  TEST_ASSERT_TRUE(reader.response(300) > 128);
+  TEST_ASSERT_EQUAL_UINT8(255, reader.response(4095));
+
+  reader.setSensitivity(0);
+  TEST_ASSERT_EQUAL_UINT8(255, reader.response(0));
+  reader.setSensitivity(LDR_MAX_SENSITIVITY + 5);
+  TEST_ASSERT_EQUAL_INT(LDR_MAX_SENSITIVITY, reader.sensitivity());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_starts_at_the_first_reading);
+  RUN_TEST(test_follows_a_step_with_the_time_constant);
+  RUN_TEST(test_own_light_is_taken_out);
+  RUN_TEST(test_own_light_feeds_back_without_the_current);
+  RUN_TEST(test_response_curves);
+  return UNITY_END();
+}
@@ -0,0 +1,261 @@
+//
+// MinuteClock stepped from boundary to boundary, as RealTimeMode does, over
+// three days around each DST transition of 2026 in Central Europe, against
+// glibc; and RealTimeMode on a mock display, for when a change of brightness
+// is shown.
+//
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <random>
+#include <vector>
+
+#include <unity.h>
+
+#include "MinuteClock.h"
+#include "RealTimeMode.h"
+
+namespace
+{
+  const int64_t US_PER_S = 1000000;
+  const char *const CET = "CET-1CEST,M3.5.0,M10.5.0/3";
+  const int64_t MARCH_28_2026 = 1774656000;
+  const int64_t OCTOBER_24_2026 = 1792800000;
+  const int64_t LEAD_US = MINUTE_LEAD_MS * 1000LL;
+
+  struct tm glibcLocal(int64_t utc)
+  {
+    time_t t = static_cast<time_t>(utc);
+    struct tm local;
+    localtime_r(&t, &local);
+    return local;
+  }
+
+  // Steps through three days of boundaries from `fromUtc`, with the wall
+  // clock corrected by up to 20 ms (NTP) at every one.
+  void checkThreeDays(int64_t fromUtc)
+  {
+    setenv("TZ", CET, 1);
+    tzset();
+    MinuteClock clock;
+    TEST_ASSERT_TRUE(clock.setTimeZone(CET));
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int64_t> correction(-20000, 20000);
+    // wall clock minus monotonic clock
+    int64_t wallOffsetUs = fromUtc * US_PER_S - 5 * US_PER_S + 123456;
+    int64_t nowUs = 5 * US_PER_S;
+    TEST_ASSERT_TRUE(clock.sync(nowUs, nowUs + wallOffsetUs));
+
+    int transitions = 0;
+    int32_t offset = clock.utcOffset();
+    for (int minute = 0; minute < 3 * 24 * 60; minute++)
+    {
+      int64_t boundaryUtc = (clock.nextBoundary() + wallOffsetUs) / US_PER_S;
+      TEST_ASSERT_EQUAL_INT64(0, (clock.nextBoundary() + wallOffsetUs) % (60 * US_PER_S));
+
+      // a second before it, the local time is that of the minute before
+      // (localTime() takes the offset of the boundary: not across a
+      // transition)
+      nowUs = clock.nextBoundary() - US_PER_S;
+      struct tm before = glibcLocal(boundaryUtc - 1);
+      MinuteClock::LocalTime time = clock.localTime(nowUs);
+      if (before.tm_gmtoff == clock.utcOffset())
+      {
+        TEST_ASSERT_EQUAL_INT(before.tm_hour, time.hour);
+        TEST_ASSERT_EQUAL_INT(before.tm_min, time.minute);
+        TEST_ASSERT_EQUAL_INT(59, time.second);
+      }
+
+      // rendered ahead: the minute the boundary starts
+      nowUs = clock.nextBoundary() - LEAD_US;
+      struct tm local = glibcLocal(boundaryUtc);
+      time = clock.nextTime();
+      TEST_ASSERT_EQUAL_INT(local.tm_hour, time.hour);
+      TEST_ASSERT_EQUAL_INT(local.tm_min, time.minute);
+      TEST_ASSERT_EQUAL_INT(0, time.second);
+      TEST_ASSERT_EQUAL_INT32(local.tm_gmtoff, clock.utcOffset());
+      if (clock.utcOffset() != offset)
+      {
+        transitions++;
+        offset = clock.utcOffset();
+      }
+
+      wallOffsetUs += correction(random);
+      TEST_ASSERT_TRUE(clock.sync(nowUs, nowUs + wallOffsetUs, 2 * LEAD_US));
+      TEST_ASSERT_EQUAL_INT64((boundaryUtc + 60) * US_PER_S,
+                              clock.nextBoundary() + wallOffsetUs);
+    }
+    TEST_ASSERT_EQUAL_INT(1, transitions);
+  }
+
+  //
+  // What RealTimeMode uses of the display, with a face that changes every
+  // minute and a time base that is UTC0 at monotonic 0.
+  //
+  const int64_t UTC0_US = (MARCH_28_2026 + 45) * US_PER_S;
+
+  struct MockDisplay
+  {
+    struct Face
+    {
+      void resetTime() {}
+    };
+
+    struct TimeBase
+    {
+      bool isSynced() const { return true; }
+      int64_t utc(int64_t nowUs) const { return UTC0_US + nowUs; }
+    };
+
+    // A change of color is reported as one of brightness too (see
+    // Display::setColor()).
+    struct Brightness
+    {
+      void loop() {}
+      bool hasChanged()
+      {
+        bool was = changed;
+        changed = false;
+        return was;
+      }
+      bool changed = false;
+    };
+
+    Face &clockFace() { return face; }
+    TimeBase &timeBase() { return timeBase_; }
+    RtcClock *rtc() { return nullptr; }
+    Brightness &brightnessController() { return brightness; }
+
+    bool updateWithTime(int hour, int minute, int second)
+    {
+      return updateWithTimeAt(static_cast<uint32_t>(hostTimeUs), hour, minute, second);
+    }
+
+    bool updateWithTimeAt(uint32_t startUs, int hour, int minute, int second)
+    {
+      int shown = hour * 60 + minute;
+      if (shown == minute_)
+        return false;
+      minute_ = shown;
+      fadeStarts.push_back(startUs);
+      return true;
+    }
+
+    void transition(int animationSpeed) { transitions.push_back(hostTimeUs); }
+
+    Face face;
+    TimeBase timeBase_;
+    Brightness brightness;
+    int minute_ = -1;
+    std::vector<uint32_t> fadeStarts;
+    std::vector<int64_t> transitions;
+  };
+
+  // Ticks the mode every millisecond until `untilUs`.
+  void runUntil(RealTimeMode &mode, MockDisplay &display, int64_t untilUs)
+  {
+    while (hostTimeUs < untilUs)
+    {
+      hostTimeUs += 1000;
+      mode.tick(display);
+    }
+  }
+} // namespace
+
+void setUp() { hostTimeUs = 0; }
+
+void tearDown() { hostTimeUs = -1; }
+
+void test_boundaries_around_the_march_transition() { checkThreeDays(MARCH_28_2026); }
+
+void test_boundaries_around_the_october_transition() { checkThreeDays(OCTOBER_24_2026); }
+
+void test_the_boundary_after_the_lead()
+{
+  MinuteClock clock;
+  // 10 ms before a minute, with 50 ms of lead: the one after it
+  int64_t wallUs = (MARCH_28_2026 + 60) * US_PER_S - 10000;
+  TEST_ASSERT_TRUE(clock.sync(0, wallUs, LEAD_US));
+  TEST_ASSERT_EQUAL_INT64(120 * US_PER_S - (wallUs - MARCH_28_2026 * US_PER_S), clock.nextBoundary());
+  MinuteClock::LocalTime time = clock.nextTime();
+  TEST_ASSERT_EQUAL_INT(0, time.hour);
+  TEST_ASSERT_EQUAL_INT(2, time.minute);
+}
+
+void test_not_set_before_2020()
+{
+  MinuteClock clock;
+  TEST_ASSERT_FALSE(clock.sync(0, 1000 * US_PER_S));
+  TEST_ASSERT_FALSE(clock.isSet());
+  TEST_ASSERT_TRUE(clock.sync(0, MARCH_28_2026 * US_PER_S));
+  TEST_ASSERT_TRUE(clock.isSet());
+  clock.reset();
+  TEST_ASSERT_FALSE(clock.isSet());
+  TEST_ASSERT_FALSE(clock.setTimeZone("M13"));
+}
+
+void test_brightness_waits_for_the_fade()
+{
+  RealTimeMode mode;
+  MockDisplay display;
+  mode.setTimeZone("UTC0");
+  mode.enter(display);
+
+  // the time is shown right away, and fades in
+  runUntil(mode, display, 1000);
+  TEST_ASSERT_EQUAL_UINT32(1, display.fadeStarts.size());
+  int64_t fadeEndUs = 1000 + TIME_CHANGE_ANIMATION_SPEED * 1000LL;
+
+  display.brightness.changed = true;
+  runUntil(mode, display, fadeEndUs - 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, display.transitions.size());
+  runUntil(mode, display, fadeEndUs);
+  TEST_ASSERT_EQUAL_UINT32(1, display.transitions.size());
+  TEST_ASSERT_EQUAL_INT64(fadeEndUs, display.transitions[0]);
+
+  // with no fade running, right away
+  runUntil(mode, display, 5 * US_PER_S);
+  display.brightness.changed = true;
+  runUntil(mode, display, 5 * US_PER_S + 1000);
+  TEST_ASSERT_EQUAL_UINT32(2, display.transitions.size());
+}
+
+void test_brightness_waits_for_the_minute_rendered_ahead()
+{
+  RealTimeMode mode;
+  MockDisplay display;
+  mode.setTimeZone("UTC0");
+  mode.enter(display);
+  runUntil(mode, display, 5 * US_PER_S);
+
+  // the minute starts 15 s after UTC0, and is rendered MINUTE_LEAD_MS ahead
+  int64_t boundaryUs = 15 * US_PER_S;
+  runUntil(mode, display, boundaryUs - LEAD_US + 1000);
+  TEST_ASSERT_EQUAL_UINT32(2, display.fadeStarts.size());
+  TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(boundaryUs), display.fadeStarts[1]);
+
+  // a change before the boundary, and one during the fade
+  display.brightness.changed = true;
+  runUntil(mode, display, boundaryUs + US_PER_S);
+  display.brightness.changed = true;
+  int64_t fadeEndUs = boundaryUs + TIME_CHANGE_ANIMATION_SPEED * 1000LL;
+  runUntil(mode, display, fadeEndUs - 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, display.transitions.size());
+  runUntil(mode, display, fadeEndUs + 100000);
+  TEST_ASSERT_EQUAL_UINT32(1, display.transitions.size());
+  TEST_ASSERT_EQUAL_INT64(fadeEndUs, display.transitions[0]);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_boundaries_around_the_march_transition);
+  RUN_TEST(test_boundaries_around_the_october_transition);
+  RUN_TEST(test_the_boundary_after_the_lead);
+  RUN_TEST(test_not_set_before_2020);
+  RUN_TEST(test_brightness_waits_for_the_fade);
+  RUN_TEST(test_brightness_waits_for_the_minute_rendered_ahead);
+  return UNITY_END();
+}
@@ -0,0 +1,99 @@
+//
+// ChannelBackend over FakeChannels, on a clock run by hand (see test/host):
+// a commit never waits for the wire, a frame drawn while the strip is busy
+// is kept, and it goes out, with what was drawn since, on a later commit.
+//
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "FakeChannel.h"
+#include "GridSize.h"
+#include "OutputBackend.h"
+
+namespace
+{
+  typedef WordClockGrid Grid;
+  typedef ChannelBackend<NeoGrbFeature, FakeChannel<NeoGrbFeature>, 2> Backend;
+
+  // Every pixel of the channels is the pixel of the backend's frame.
+  void checkSent(Backend &backend)
+  {
+    for (uint16_t i = 0; i < Grid::PixelCount; i++)
+      TEST_ASSERT_TRUE(backend.output().GetPixelColor(i) == backend.getPixel(i));
+  }
+} // namespace
+
+void setUp() { hostTimeUs = 1000; }
+
+void tearDown() { hostTimeUs = -1; }
+
+void test_a_commit_sends_the_frame()
+{
+  Backend backend(Grid::PixelCount, {1, 2});
+  backend.begin();
+  TEST_ASSERT_FALSE(backend.isBusy());
+  for (uint16_t i = 0; i < Grid::PixelCount; i++)
+    backend.setPixel(i, RgbColor(i, 0, 255 - i));
+  TEST_ASSERT_TRUE(backend.beginCommit());
+  TEST_ASSERT_TRUE(backend.isBusy());
+  checkSent(backend);
+  TEST_ASSERT_EQUAL_UINT32(1, backend.output().channel(0).showCount());
+  TEST_ASSERT_EQUAL_UINT32(1, backend.output().channel(1).showCount());
+}
+
+void test_a_busy_strip_keeps_the_frame()
+{
+  Backend backend(Grid::PixelCount, {1, 2});
+  backend.begin();
+  backend.setPixel(10, RgbColor(1, 2, 3));
+  TEST_ASSERT_TRUE(backend.beginCommit());
+
+  // drawn while the first frame is on the wire
+  backend.setPixel(10, RgbColor(4, 5, 6));
+  TEST_ASSERT_FALSE(backend.beginCommit());
+  TEST_ASSERT_TRUE(backend.output().GetPixelColor(10) == RgbColor(1, 2, 3));
+  backend.setPixel(11, RgbColor(7, 8, 9));
+
+  hostTimeUs += backend.output().channel(0).wireUs();
+  TEST_ASSERT_FALSE(backend.isBusy());
+  TEST_ASSERT_TRUE(backend.beginCommit());
+  TEST_ASSERT_TRUE(backend.output().GetPixelColor(10) == RgbColor(4, 5, 6));
+  TEST_ASSERT_TRUE(backend.output().GetPixelColor(11) == RgbColor(7, 8, 9));
+  TEST_ASSERT_EQUAL_UINT32(2, backend.output().channel(0).showCount());
+}
+
+void test_frames_faster_than_the_wire_never_stall()
+{
+  Backend backend(Grid::PixelCount, {1, 2});
+  backend.begin();
+  uint32_t wireUs = backend.output().channel(0).wireUs();
+  // a frame every 1 ms for a second, a good deal faster than the wire
+  TEST_ASSERT_TRUE(wireUs > 1000);
+  uint32_t committed = 0;
+  for (uint16_t frame = 0; frame < 1000; frame++)
+  {
+    backend.setPixel(frame % Grid::PixelCount, RgbColor(frame & 0xFF));
+    if (backend.beginCommit())
+      committed++;
+    hostTimeUs += 1000;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, backend.output().channel(0).stallUs());
+  TEST_ASSERT_EQUAL_UINT32(0, backend.output().channel(1).stallUs());
+  // as many frames as the wire takes, each commit as soon as it is free
+  uint32_t slotUs = (wireUs + 999) / 1000 * 1000;
+  TEST_ASSERT_EQUAL_UINT32((1000000 + slotUs - 1) / slotUs, committed);
+
+  hostTimeUs += wireUs;
+  TEST_ASSERT_TRUE(backend.beginCommit());
+  checkSent(backend);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_a_commit_sends_the_frame);
+  RUN_TEST(test_a_busy_strip_keeps_the_frame);
+  RUN_TEST(test_frames_faster_than_the_wire_never_stall);
+  return UNITY_END();
+}
@@ -0,0 +1,116 @@
+//
+// ParallelOutput over FakeChannels, on the host's clock: the pixels land on
+// the right channel, and a frame takes the wire time of the longest channel,
+// not of the whole strip.
+//
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "FakeChannel.h"
+#include "GridSize.h"
+#include "OutputChannels.h"
+
+namespace
+{
+  typedef FakeChannel<NeoGrbFeature> Channel;
+
+  const uint16_t PIXELS = WordWallGrid32x16::PixelCount;
+  const uint8_t FRAMES = 10;
+
+  template <uint8_t TChannelCount>
+  using Output = ParallelOutput<NeoGrbFeature, Channel, TChannelCount>;
+
+  template <uint8_t TChannelCount>
+  void checkPixels()
+  {
+    Output<TChannelCount> output(PIXELS, {1, 2, 3, 4, 5, 6, 7, 8});
+    output.Begin();
+    TEST_ASSERT_EQUAL_UINT16(PIXELS, output.PixelCount());
+    TEST_ASSERT_EQUAL_UINT16((PIXELS + TChannelCount - 1) / TChannelCount, output.pixelsPerChannel());
+
+    uint16_t total = 0;
+    for (uint8_t i = 0; i < TChannelCount; i++)
+    {
+      TEST_ASSERT_EQUAL_UINT8(i + 1, output.channel(i).pin());
+      total += output.channel(i).PixelCount();
+    }
+    TEST_ASSERT_EQUAL_UINT16(PIXELS, total);
+
+    for (uint16_t i = 0; i < PIXELS; i++)
+      output.SetPixelColor(i, RgbColor(i & 0xFF, i >> 8, 0));
+    for (uint16_t i = 0; i < PIXELS; i++)
+      TEST_ASSERT_TRUE(output.GetPixelColor(i) == RgbColor(i & 0xFF, i >> 8, 0));
+    // in consecutive runs
+    TEST_ASSERT_TRUE(output.channel(TChannelCount - 1).GetPixelColor(0) ==
+                     output.GetPixelColor((TChannelCount - 1) * output.pixelsPerChannel()));
+  }
+
+  // Time [us] per frame of FRAMES frames sent back to back.
+  template <uint8_t TChannelCount>
+  uint32_t frameUs(Output<TChannelCount> &output)
+  {
+    uint32_t startUs = micros();
+    for (uint8_t i = 0; i < FRAMES; i++)
+      output.Show();
+    while (!output.CanShow())
+      ;
+    return (micros() - startUs) / FRAMES;
+  }
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_pixels_on_one_channel() { checkPixels<1>(); }
+
+void test_pixels_on_three_channels() { checkPixels<3>(); }
+
+void test_pixels_on_eight_channels() { checkPixels<8>(); }
+
+void test_wire_time()
+{
+  // 24 bits of 1.25us per pixel, then the latch
+  Channel channel(PIXELS, 1);
+  TEST_ASSERT_EQUAL_UINT32(PIXELS * 30 + 300, channel.wireUs());
+  Channel empty(0, 1);
+  TEST_ASSERT_EQUAL_UINT32(300, empty.wireUs());
+}
+
+void test_frame_time_of_the_longest_channel()
+{
+  Output<1> one(PIXELS, {1});
+  Output<8> eight(PIXELS, {1, 2, 3, 4, 5, 6, 7, 8});
+  uint32_t oneUs = frameUs(one);
+  uint32_t eightUs = frameUs(eight);
+
+  TEST_ASSERT_UINT32_WITHIN(500, one.channel(0).wireUs(), oneUs);
+  TEST_ASSERT_UINT32_WITHIN(500, eight.channel(0).wireUs(), eightUs);
+  TEST_ASSERT_TRUE(eightUs * 4 < oneUs);
+}
+
+void test_stalls_are_counted()
+{
+  Channel channel(PIXELS, 1);
+  channel.Show();
+  TEST_ASSERT_EQUAL_UINT32(0, channel.stallUs());
+  TEST_ASSERT_FALSE(channel.CanShow());
+  // waits for the first frame to be out
+  channel.Show();
+  TEST_ASSERT_EQUAL_UINT32(2, channel.showCount());
+  TEST_ASSERT_UINT32_WITHIN(500, channel.wireUs(), channel.stallUs());
+  TEST_ASSERT_EQUAL_UINT32(channel.lastShowUs() + channel.wireUs(), channel.lastDoneUs());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_pixels_on_one_channel);
+  RUN_TEST(test_pixels_on_three_channels);
+  RUN_TEST(test_pixels_on_eight_channels);
+  RUN_TEST(test_wire_time);
+  RUN_TEST(test_frame_time_of_the_longest_channel);
+  RUN_TEST(test_stalls_are_counted);
+  return UNITY_END();
+}
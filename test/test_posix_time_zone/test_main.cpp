@@ -0,0 +1,111 @@
+//
+// PosixTimeZone against the C library (glibc), for every zone of Timezones.h.
+//
+// Every zone is compared every 3 hours from 2020 through 2033, and one second
+// either side of each of its transitions. glibc reads the same rule from TZ.
+//
+
+#include <stdlib.h>
+#include <time.h>
+
+#include <unity.h>
+
+#include "PosixTimeZone.h"
+#include "Timezones.h"
+
+namespace
+{
+  const int64_t FROM = 1577836800; // 2020-01-01
+  const int64_t UNTIL = 2019686400; // 2034-01-01
+  const int64_t STEP = 3 * 3600;
+
+  // Offset [s] from UTC glibc gives at `utc`, in the zone set with setZone().
+  int32_t glibcOffset(int64_t utc)
+  {
+    time_t t = static_cast<time_t>(utc);
+    struct tm local;
+    localtime_r(&t, &local);
+    return local.tm_gmtoff;
+  }
+
+  void setZone(const char *rule)
+  {
+    setenv("TZ", rule, 1);
+    tzset();
+  }
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_every_zone_parses()
+{
+  PosixTimeZone zone;
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+    TEST_ASSERT_TRUE_MESSAGE(zone.parse(timezoneRule(id)), timezoneName(id));
+}
+
+void test_offsets_match_glibc()
+{
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+  {
+    setZone(timezoneRule(id));
+    PosixTimeZone zone;
+    zone.parse(timezoneRule(id));
+    for (int64_t utc = FROM; utc < UNTIL; utc += STEP)
+      TEST_ASSERT_EQUAL_INT32_MESSAGE(glibcOffset(utc), zone.offsetAt(utc), timezoneName(id));
+  }
+}
+
+void test_transitions_match_glibc()
+{
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+  {
+    setZone(timezoneRule(id));
+    PosixTimeZone zone;
+    zone.parse(timezoneRule(id));
+    for (int64_t utc = FROM;;)
+    {
+      int64_t transition = zone.nextTransition(utc);
+      if (transition >= UNTIL)
+        break;
+      TEST_ASSERT_EQUAL_INT32_MESSAGE(glibcOffset(transition - 1), zone.offsetAt(transition - 1),
+                                      timezoneName(id));
+      TEST_ASSERT_EQUAL_INT32_MESSAGE(glibcOffset(transition), zone.offsetAt(transition),
+                                      timezoneName(id));
+      TEST_ASSERT_TRUE_MESSAGE(zone.offsetAt(transition - 1) != zone.offsetAt(transition),
+                               timezoneName(id));
+      utc = transition;
+    }
+  }
+}
+
+void test_zone_without_dst_has_no_transitions()
+{
+  PosixTimeZone zone;
+  TEST_ASSERT_TRUE(zone.parse("<+0530>-5:30"));
+  TEST_ASSERT_FALSE(zone.hasDst());
+  TEST_ASSERT_EQUAL_INT32(5 * 3600 + 30 * 60, zone.offsetAt(FROM));
+  TEST_ASSERT_TRUE(zone.nextTransition(FROM) == PosixTimeZone::NEVER);
+}
+
+void test_invalid_rule_keeps_the_zone()
+{
+  PosixTimeZone zone;
+  TEST_ASSERT_TRUE(zone.parse("CET-1CEST,M3.5.0,M10.5.0/3"));
+  TEST_ASSERT_FALSE(zone.parse("CET-1CEST,M13.5.0,M10.5.0/3"));
+  TEST_ASSERT_FALSE(zone.parse(""));
+  TEST_ASSERT_EQUAL_INT32(3600, zone.offsetAt(FROM));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_every_zone_parses);
+  RUN_TEST(test_offsets_match_glibc);
+  RUN_TEST(test_transitions_match_glibc);
+  RUN_TEST(test_zone_without_dst_has_no_transitions);
+  RUN_TEST(test_invalid_rule_keeps_the_zone);
+  return UNITY_END();
+}
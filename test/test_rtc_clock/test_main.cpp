@@ -0,0 +1,197 @@
+//
+// RtcClock against FakeDS3231, on a clock run by hand (see test/host).
+//
+// The monotonic clock runs 40 ppm fast, the chip's crystal 43 ppm: the RTC
+// gains 3 ppm on UTC until its aging offset takes it out.
+//
+
+#include <math.h>
+
+#include <random>
+
+#include <unity.h>
+
+#include "FakeDS3231.h"
+#include "PosixTimeZone.h"
+#include "RtcClock.h"
+
+namespace
+{
+  const int64_t SECOND_US = 1000000;
+  const int64_t DAY_US = 86400 * SECOND_US;
+  // 2024-06-01 12:34:56.7
+  const int64_t UTC0_US = 1717245296LL * SECOND_US + 700000;
+  const double MONOTONIC_PPM = 40;
+
+  // UTC at monotonic time `nowUs`.
+  int64_t trueUtc(int64_t nowUs)
+  {
+    return UTC0_US + nowUs + static_cast<int64_t>(nowUs * MONOTONIC_PPM * 1e-6);
+  }
+
+  // Runs `rtc` for `us`, a loop() every millisecond.
+  void run(RtcClock &rtc, int64_t us)
+  {
+    for (int64_t end = hostTimeUs + us; hostTimeUs < end;)
+    {
+      hostTimeUs += 1000;
+      rtc.loop(hostTimeUs);
+    }
+  }
+
+  // A chip set to UTC, `errorUs` off.
+  void setChip(FakeDS3231 &chip, int64_t errorUs)
+  {
+    RtcClock rtc(chip);
+    rtc.begin(hostTimeUs);
+    rtc.set(hostTimeUs, trueUtc(hostTimeUs) + errorUs);
+    uint32_t writes = chip.writes();
+    while (chip.writes() == writes)
+    {
+      hostTimeUs += 100;
+      rtc.loop(hostTimeUs);
+    }
+  }
+} // namespace
+
+void setUp() { hostTimeUs = 1000; }
+
+void tearDown() { hostTimeUs = -1; }
+
+void test_civil_dates_round_trip()
+{
+  for (int64_t days = -800000; days < 800000; days += 13)
+  {
+    int64_t year;
+    unsigned month, day;
+    PosixTimeZone::civilFromDays(days, year, month, day);
+    TEST_ASSERT_EQUAL_INT64(days, PosixTimeZone::daysFromCivil(year, month, day));
+    TEST_ASSERT_EQUAL_INT64(year, PosixTimeZone::yearOfDay(days));
+  }
+  int64_t year;
+  unsigned month, day;
+  PosixTimeZone::civilFromDays(1717245296 / 86400, year, month, day);
+  TEST_ASSERT_EQUAL_INT64(2024, year);
+  TEST_ASSERT_EQUAL_UINT(6, month);
+  TEST_ASSERT_EQUAL_UINT(1, day);
+}
+
+void test_new_chip_has_no_time()
+{
+  FakeDS3231 chip;
+  RtcClock rtc(chip);
+  TEST_ASSERT_FALSE(rtc.begin(hostTimeUs));
+  TEST_ASSERT_TRUE(rtc.isPresent());
+  TEST_ASSERT_FALSE(rtc.isValid());
+}
+
+void test_set_writes_on_the_second()
+{
+  FakeDS3231 chip;
+  setChip(chip, 0);
+  TEST_ASSERT_FALSE(chip.lostTime());
+  TEST_ASSERT_INT64_WITHIN(1000, trueUtc(hostTimeUs), chip.utcUs());
+}
+
+void test_boot_then_tick()
+{
+  FakeDS3231 chip;
+  setChip(chip, -300000);
+  hostTimeUs += 123457;
+
+  RtcClock rtc(chip);
+  TEST_ASSERT_TRUE(rtc.begin(hostTimeUs));
+  TEST_ASSERT_TRUE(rtc.isValid());
+  TEST_ASSERT_FALSE(rtc.isTimed());
+  // the registers only have whole seconds
+  TEST_ASSERT_INT64_WITHIN(SECOND_US / 2, chip.utcUs(), rtc.utc(hostTimeUs));
+
+  run(rtc, 2 * SECOND_US);
+  TEST_ASSERT_TRUE(rtc.isTimed());
+  TEST_ASSERT_INT64_WITHIN(2000, chip.utcUs(), rtc.utc(hostTimeUs));
+}
+
+void test_discipline_over_four_days()
+{
+  FakeDS3231 chip;
+  chip.setDriftPpm(43.0f);
+  setChip(chip, -300000);
+
+  RtcClock rtc(chip);
+  TEST_ASSERT_TRUE(rtc.begin(hostTimeUs));
+
+  std::mt19937 random(1);
+  std::normal_distribution<double> noise(0, 3000);
+  int64_t nextSync = hostTimeUs + 60 * SECOND_US;
+  int64_t worstTrackingUs = 0;
+  uint32_t reads = chip.reads();
+  for (int64_t end = hostTimeUs + 4 * DAY_US; hostTimeUs < end;)
+  {
+    // some frames are long
+    hostTimeUs += 1000 + (random() % 16 == 0 ? 7000 : 0);
+    rtc.loop(hostTimeUs);
+    if (rtc.isTimed())
+    {
+      int64_t trackingUs = llabs(rtc.utc(hostTimeUs) - chip.utcUs());
+      if (trackingUs > worstTrackingUs)
+        worstTrackingUs = trackingUs;
+    }
+    if (hostTimeUs >= nextSync)
+    {
+      // NTP every 3 hours
+      rtc.discipline(hostTimeUs, trueUtc(hostTimeUs) + static_cast<int64_t>(noise(random)));
+      nextSync = hostTimeUs + 3 * 3600 * SECOND_US;
+    }
+  }
+
+  // 3 ppm in steps of 0.1 ppm
+  TEST_ASSERT_INT_WITHIN(3, 30, rtc.agingOffset());
+  TEST_ASSERT_EQUAL_INT(rtc.agingOffset(), chip.agingOffset());
+  TEST_ASSERT_INT64_WITHIN(10000, trueUtc(hostTimeUs), chip.utcUs());
+  TEST_ASSERT_TRUE(worstTrackingUs < 5000);
+  // polling only around the ticks
+  TEST_ASSERT_TRUE((chip.reads() - reads) / 4 < 50000);
+}
+
+void test_lost_time_is_restored()
+{
+  FakeDS3231 chip;
+  setChip(chip, 0);
+  chip.losePower();
+
+  RtcClock rtc(chip);
+  TEST_ASSERT_FALSE(rtc.begin(hostTimeUs));
+  TEST_ASSERT_TRUE(rtc.isPresent());
+  rtc.discipline(hostTimeUs, trueUtc(hostTimeUs));
+  run(rtc, 2 * SECOND_US);
+  TEST_ASSERT_TRUE(rtc.isValid());
+  TEST_ASSERT_FALSE(chip.lostTime());
+  TEST_ASSERT_INT64_WITHIN(2000, trueUtc(hostTimeUs), chip.utcUs());
+}
+
+void test_no_chip()
+{
+  FakeDS3231 chip(UTC0_US / SECOND_US);
+  chip.setPresent(false);
+
+  RtcClock rtc(chip);
+  TEST_ASSERT_FALSE(rtc.begin(hostTimeUs));
+  TEST_ASSERT_FALSE(rtc.isPresent());
+  rtc.discipline(hostTimeUs, trueUtc(hostTimeUs));
+  run(rtc, 2 * SECOND_US);
+  TEST_ASSERT_FALSE(rtc.isValid());
+  TEST_ASSERT_EQUAL_UINT32(0, chip.writes());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_civil_dates_round_trip);
+  RUN_TEST(test_new_chip_has_no_time);
+  RUN_TEST(test_set_writes_on_the_second);
+  RUN_TEST(test_boot_then_tick);
+  RUN_TEST(test_discipline_over_four_days);
+  RUN_TEST(test_lost_time_is_restored);
+  RUN_TEST(test_no_chip);
+  return UNITY_END();
+}
@@ -0,0 +1,202 @@
+//
+// SntpClient on real UDP, against three FakeNtpServers on loopback:
+//
+//   127.0.0.1  40 ms away, right
+//   127.0.0.2   5 ms away, 250 ms ahead
+//   127.0.0.3  80 ms away, 300 ms behind
+//
+// The addresses past 127.0.0.1 need a Linux host.
+//
+
+#include <time.h>
+
+#include <unity.h>
+
+#include "FakeNtpServer.h"
+#include "SntpClient.h"
+#include "SocketUdpTransport.h"
+
+namespace
+{
+  const uint16_t PORT = 12300;
+  const char *const SERVERS[] = {"127.0.0.1", "127.0.0.2", "127.0.0.3"};
+
+  FakeNtpServer a(SERVERS[0], PORT, 0, 40000);
+  FakeNtpServer b(SERVERS[1], PORT, 250000, 5000);
+  FakeNtpServer c(SERVERS[2], PORT, -300000, 80000);
+
+  // UTC of the host at monotonic time `monotonicUs`.
+  int64_t hostUtc(int64_t monotonicUs)
+  {
+    timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    return monotonicUs + now.tv_sec * 1000000LL + now.tv_nsec / 1000 - esp_timer_get_time();
+  }
+
+  struct Run
+  {
+    SocketUdpTransport transport;
+    SntpClient client{transport};
+    SntpClient::Sample sample = {};
+    int syncs = 0;
+
+    Run()
+    {
+      client.setServers(SERVERS, 3, PORT);
+      client.onSync([this](const SntpClient::Sample &s) {
+        sample = s;
+        syncs++;
+      });
+    }
+
+    // Runs the servers, the transport and the client until the round is
+    // closed.
+    void finish()
+    {
+      while (client.state() == SntpClient::State::QUERYING)
+      {
+        a.loop();
+        b.loop();
+        c.loop();
+        transport.receive();
+        client.loop(esp_timer_get_time());
+      }
+    }
+
+    void sync()
+    {
+      TEST_ASSERT_TRUE(client.sync(esp_timer_get_time()));
+      finish();
+    }
+  };
+} // namespace
+
+void setUp()
+{
+  for (FakeNtpServer *server : {&a, &b, &c})
+  {
+    server->setSilent(false);
+    server->setStratum(2);
+  }
+}
+
+void tearDown() {}
+
+void test_the_servers_listen()
+{
+  TEST_ASSERT_TRUE(a.begin());
+  TEST_ASSERT_TRUE(b.begin());
+  TEST_ASSERT_TRUE(c.begin());
+}
+
+void test_the_nearest_server_is_taken()
+{
+  Run run;
+  run.sync();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::SYNCED);
+  TEST_ASSERT_EQUAL_INT(1, run.syncs);
+  TEST_ASSERT_EQUAL_UINT8(1, run.sample.server);
+  TEST_ASSERT_EQUAL_UINT8(2, run.sample.stratum);
+  TEST_ASSERT_INT64_WITHIN(2000, 5000, run.sample.delayUs);
+  TEST_ASSERT_INT64_WITHIN(2000, 250000, run.sample.utcUs - hostUtc(run.sample.monotonicUs));
+}
+
+void test_a_silent_server_is_left_out()
+{
+  b.setSilent(true);
+  Run run;
+  run.sync();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::SYNCED);
+  TEST_ASSERT_EQUAL_UINT8(0, run.sample.server);
+  TEST_ASSERT_INT64_WITHIN(2000, 0, run.sample.utcUs - hostUtc(run.sample.monotonicUs));
+}
+
+void test_an_unsynchronized_server_is_left_out()
+{
+  b.setStratum(0);
+  Run run;
+  run.sync();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::SYNCED);
+  TEST_ASSERT_EQUAL_UINT8(0, run.sample.server);
+}
+
+void test_no_answers_fail_the_round()
+{
+  a.setSilent(true);
+  b.setSilent(true);
+  c.setSilent(true);
+  Run run;
+  int64_t startUs = esp_timer_get_time();
+  run.sync();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::FAILED);
+  TEST_ASSERT_EQUAL_INT(0, run.syncs);
+  TEST_ASSERT_TRUE(esp_timer_get_time() - startUs >= SNTP_TIMEOUT_US);
+}
+
+void test_a_forged_answer_is_ignored()
+{
+  Run run;
+  TEST_ASSERT_TRUE(run.client.sync(esp_timer_get_time()));
+  // well formed, from a synchronized server, but not the nonce sent
+  uint8_t forged[SNTP_PACKET_SIZE] = {0x24, 1};
+  forged[32] = forged[40] = 0xE0;
+  run.client.receive(1, forged, sizeof(forged), esp_timer_get_time());
+  run.finish();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::SYNCED);
+  TEST_ASSERT_EQUAL_UINT8(1, run.sample.server);
+  TEST_ASSERT_INT64_WITHIN(2000, 250000, run.sample.utcUs - hostUtc(run.sample.monotonicUs));
+}
+
+void test_an_unknown_name_fails_the_round()
+{
+  const char *const unknown[] = {"no-such-host.invalid"};
+  Run run;
+  run.client.setServers(unknown, 1, PORT);
+  TEST_ASSERT_FALSE(run.client.sync(esp_timer_get_time()));
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::FAILED);
+  TEST_ASSERT_EQUAL_INT(0, run.syncs);
+}
+
+void test_the_request_waits_for_the_lookup()
+{
+  Run run;
+  run.transport.setLookupDelay(50000);
+  TEST_ASSERT_TRUE(run.client.sync(esp_timer_get_time()));
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::QUERYING);
+  TEST_ASSERT_TRUE(run.transport.resolving(1));
+  run.finish();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::SYNCED);
+  TEST_ASSERT_EQUAL_UINT8(1, run.sample.server);
+  // the delay is from when the request went out, after the lookup
+  TEST_ASSERT_INT64_WITHIN(2000, 5000, run.sample.delayUs);
+  TEST_ASSERT_INT64_WITHIN(2000, 250000, run.sample.utcUs - hostUtc(run.sample.monotonicUs));
+}
+
+void test_an_unknown_name_fails_after_the_lookup()
+{
+  const char *const unknown[] = {"no-such-host.invalid"};
+  Run run;
+  run.client.setServers(unknown, 1, PORT);
+  run.transport.setLookupDelay(50000);
+  int64_t startUs = esp_timer_get_time();
+  TEST_ASSERT_TRUE(run.client.sync(startUs));
+  run.finish();
+  TEST_ASSERT_TRUE(run.client.state() == SntpClient::State::FAILED);
+  TEST_ASSERT_EQUAL_INT(0, run.syncs);
+  TEST_ASSERT_TRUE(esp_timer_get_time() - startUs < SNTP_TIMEOUT_US);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_the_servers_listen);
+  RUN_TEST(test_the_nearest_server_is_taken);
+  RUN_TEST(test_a_silent_server_is_left_out);
+  RUN_TEST(test_an_unsynchronized_server_is_left_out);
+  RUN_TEST(test_no_answers_fail_the_round);
+  RUN_TEST(test_a_forged_answer_is_ignored);
+  RUN_TEST(test_an_unknown_name_fails_the_round);
+  RUN_TEST(test_the_request_waits_for_the_lookup);
+  RUN_TEST(test_an_unknown_name_fails_after_the_lookup);
+  return UNITY_END();
+}
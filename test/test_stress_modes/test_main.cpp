@@ -0,0 +1,199 @@
+//
+// The four stress modes on a mock display, on a clock run by hand (see
+// test/host): the same workload as on the device, with the face reduced to
+// its five minute state and the strip to a wire time.
+//
+
+#include <set>
+#include <vector>
+
+#include <unity.h>
+
+#include "StressMode.h"
+
+namespace
+{
+  // Five minute states of the face in a day.
+  const int FACE_STATES = STRESS_DAY_MINUTES / 5;
+
+  class MockDisplay
+  {
+  public:
+    struct Face
+    {
+      void resetTime() { state = -1; }
+      int state = -1;
+    };
+
+    // Time [us] a frame keeps the strip busy.
+    int64_t wireUs = 0;
+    // Every state shown, in order, and the fade of the last update [ms].
+    std::vector<int> shown;
+    int lastAnimationSpeed = -1;
+
+    Face &clockFace() { return _face; }
+    StressMetrics &stressMetrics() { return _metrics; }
+    uint16_t stressRate() const { return _stressRate; }
+    void setStressRate(uint16_t rate) { _stressRate = rate; }
+    uint32_t committedFrames() const { return _committed; }
+    uint32_t droppedFrames() const { return _dropped; }
+
+    bool updateWithTime(int hour, int minute, int second, int animationSpeed)
+    {
+      int state = hour * 12 + minute / 5;
+      bool changed = state != _face.state;
+      _face.state = state;
+      shown.push_back(state);
+      lastAnimationSpeed = animationSpeed;
+      return changed;
+    }
+
+    // Sends a frame, or drops it while the strip is busy with the last one.
+    void frame()
+    {
+      if (hostTimeUs < _busyUntilUs)
+      {
+        _dropped++;
+        return;
+      }
+      _committed++;
+      _busyUntilUs = hostTimeUs + wireUs;
+    }
+
+  private:
+    Face _face;
+    StressMetrics _metrics;
+    uint16_t _stressRate = 0;
+    uint32_t _committed = 3;
+    uint32_t _dropped = 7;
+    int64_t _busyUntilUs = 0;
+  };
+
+  // Runs `frames` frames of `frameUs` of mode TPattern.
+  template <typename TPattern>
+  void run(MockDisplay &display, uint32_t frames, int64_t frameUs)
+  {
+    StressMode<TPattern> mode;
+    mode.enter(display);
+    for (uint32_t i = 0; i < frames; i++)
+    {
+      hostTimeUs += frameUs;
+      mode.tick(display);
+      display.frame();
+    }
+    mode.exit(display);
+  }
+
+  size_t distinct(const std::vector<int> &states)
+  {
+    return std::set<int>(states.begin(), states.end()).size();
+  }
+
+  // The value of `key` in the JSON of the metrics.
+  long field(const char *json, const char *key)
+  {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(json, pattern);
+    TEST_ASSERT_NOT_NULL_MESSAGE(p, key);
+    return strtol(p + strlen(pattern), nullptr, 10);
+  }
+} // namespace
+
+void setUp() { hostTimeUs = 1000; }
+
+void tearDown() { hostTimeUs = -1; }
+
+void test_cycle_hours_shows_every_state_in_288_steps()
+{
+  MockDisplay display;
+  run<CycleHoursStress>(display, FACE_STATES, 20000);
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, display.shown.size());
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, distinct(display.shown));
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, display.stressMetrics().transitions());
+}
+
+void test_cycle_5_minutes_shows_every_state_in_order()
+{
+  MockDisplay display;
+  run<Cycle5MinsStress>(display, FACE_STATES, 20000);
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, distinct(display.shown));
+  for (int i = 0; i < FACE_STATES; i++)
+    TEST_ASSERT_EQUAL_INT((i + 1) % FACE_STATES, display.shown[i]);
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, display.stressMetrics().transitions());
+}
+
+void test_fast_time_changes_the_face_every_5_minutes()
+{
+  MockDisplay display;
+  run<FastTimeStress>(display, STRESS_DAY_MINUTES, 20000);
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, distinct(display.shown));
+  TEST_ASSERT_EQUAL_UINT32(STRESS_DAY_MINUTES, display.stressMetrics().updates());
+  // from 00:01 round to 00:00: midnight is shown twice
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES + 1, display.stressMetrics().transitions());
+}
+
+void test_random_is_the_same_on_every_run()
+{
+  MockDisplay first;
+  run<RandomStress>(first, 5000, 20000);
+  TEST_ASSERT_EQUAL_UINT32(FACE_STATES, distinct(first.shown));
+
+  MockDisplay second;
+  run<RandomStress>(second, 5000, 20000);
+  TEST_ASSERT_TRUE(first.shown == second.shown);
+}
+
+void test_one_step_per_frame_at_rate_0()
+{
+  MockDisplay display;
+  run<Cycle5MinsStress>(display, 100, 30000);
+  const StressMetrics &metrics = display.stressMetrics();
+  TEST_ASSERT_EQUAL_UINT32(100, metrics.updates());
+  TEST_ASSERT_EQUAL_UINT32(0, metrics.missed());
+  // no fade at all
+  TEST_ASSERT_EQUAL_INT(0, display.lastAnimationSpeed);
+}
+
+void test_late_frames_miss_steps_and_drop_frames()
+{
+  // 50 steps a second, 30 ms frames, and a strip that takes 45 ms a frame
+  MockDisplay display;
+  display.setStressRate(50);
+  display.wireUs = 45000;
+  int64_t startUs = hostTimeUs;
+  run<Cycle5MinsStress>(display, 100, 30000);
+
+  const StressMetrics &metrics = display.stressMetrics();
+  TEST_ASSERT_FALSE(metrics.isRunning());
+  TEST_ASSERT_EQUAL_UINT32(100, metrics.frames());
+  TEST_ASSERT_EQUAL_UINT32(100, metrics.updates());
+  // every step due in the 3 s (151 of them) is either taken or missed
+  TEST_ASSERT_EQUAL_UINT32(51, metrics.missed());
+  TEST_ASSERT_EQUAL_UINT32(30000, metrics.maxFrameUs());
+  // the fade of a step lasts until the next one
+  TEST_ASSERT_EQUAL_INT(20, display.lastAnimationSpeed);
+
+  char json[384];
+  metrics.toJson(json, sizeof(json), hostTimeUs + 5000000, display.droppedFrames(),
+                 display.committedFrames());
+  TEST_ASSERT_EQUAL_INT(0, strncmp(json, "{\"running\":false,\"seconds\":3.000,", 33));
+  TEST_ASSERT_EQUAL_INT(hostTimeUs - startUs, 3000000);
+  // every other frame finds the strip busy
+  TEST_ASSERT_EQUAL_INT(50, field(json, "committedFrames"));
+  TEST_ASSERT_EQUAL_INT(50, field(json, "droppedFrames"));
+  TEST_ASSERT_EQUAL_INT(51, field(json, "missedSteps"));
+  TEST_ASSERT_EQUAL_INT(100, field(json, "updates"));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_cycle_hours_shows_every_state_in_288_steps);
+  RUN_TEST(test_cycle_5_minutes_shows_every_state_in_order);
+  RUN_TEST(test_fast_time_changes_the_face_every_5_minutes);
+  RUN_TEST(test_random_is_the_same_on_every_run);
+  RUN_TEST(test_one_step_per_frame_at_rate_0);
+  RUN_TEST(test_late_frames_miss_steps_and_drop_frames);
+  return UNITY_END();
+}
@@ -0,0 +1,188 @@
+//
+// TimezoneSearch over the zones of Timezones.h.
+//
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include <unity.h>
+
+#include "TimezoneSearch.h"
+#include "Timezones.h"
+
+namespace
+{
+  // How a name matches a query, in the order search() returns them.
+  enum Match
+  {
+    PREFIX,
+    WORD_START,
+    ELSEWHERE,
+    NONE
+  };
+
+  std::string fold(const char *text)
+  {
+    std::string folded;
+    for (; *text != '\0'; text++)
+      folded += *text == '_' ? ' ' : static_cast<char>(tolower(*text));
+    return folded;
+  }
+
+  Match matchOf(const char *name, const char *query)
+  {
+    std::string folded = fold(name);
+    std::string text = fold(query);
+    if (folded.compare(0, text.size(), text) == 0)
+      return PREFIX;
+    Match match = NONE;
+    for (size_t at = folded.find(text, 1); at != std::string::npos; at = folded.find(text, at + 1))
+    {
+      char before = folded[at - 1];
+      if (before == '/' || before == ' ' || before == '-')
+        return WORD_START;
+      match = ELSEWHERE;
+    }
+    return match;
+  }
+
+  uint16_t matchCount(const char *query)
+  {
+    uint16_t count = 0;
+    for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+      count += matchOf(timezoneName(id), query) != NONE;
+    return count;
+  }
+
+  // Checks the results of a query: no zone twice, each one a match, prefix
+  // matches first, then word starts, then the others, each group in the
+  // order of the names, and all of them if there is room.
+  void checkSearch(const char *query)
+  {
+    uint16_t ids[TIMEZONE_SEARCH_MAX_RESULTS];
+    uint8_t count = TimezoneSearch::search(query, ids, TIMEZONE_SEARCH_MAX_RESULTS);
+
+    uint16_t expected = matchCount(query);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(expected < TIMEZONE_SEARCH_MAX_RESULTS ? expected : TIMEZONE_SEARCH_MAX_RESULTS,
+                                  count, query);
+    for (uint8_t i = 0; i < count; i++)
+    {
+      const char *name = timezoneName(ids[i]);
+      TEST_ASSERT_TRUE_MESSAGE(matchOf(name, query) != NONE, name);
+      for (uint8_t j = 0; j < i; j++)
+        TEST_ASSERT_TRUE_MESSAGE(ids[i] != ids[j], name);
+      if (i == 0)
+        continue;
+      const char *previous = timezoneName(ids[i - 1]);
+      Match match = matchOf(name, query);
+      Match previousMatch = matchOf(previous, query);
+      TEST_ASSERT_TRUE_MESSAGE(previousMatch <= match, name);
+      if (previousMatch == match)
+        TEST_ASSERT_TRUE_MESSAGE(fold(previous) < fold(name), name);
+    }
+  }
+} // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_find_every_name()
+{
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+    TEST_ASSERT_EQUAL_INT(id, TimezoneSearch::find(timezoneName(id)));
+}
+
+void test_find_folds_case_and_underscores()
+{
+  int16_t id = TimezoneSearch::find("America/New York");
+  TEST_ASSERT_TRUE(id >= 0);
+  TEST_ASSERT_EQUAL_INT(id, TimezoneSearch::find("america/new_york"));
+  TEST_ASSERT_EQUAL_INT(id, TimezoneSearch::find("AMERICA/NEW YORK"));
+  TEST_ASSERT_EQUAL_INT(-1, TimezoneSearch::find("America/New"));
+  TEST_ASSERT_EQUAL_INT(-1, TimezoneSearch::find("Mars/Olympus Mons"));
+  TEST_ASSERT_EQUAL_INT(-1, TimezoneSearch::find(""));
+}
+
+void test_empty_query_matches_nothing()
+{
+  uint16_t ids[TIMEZONE_SEARCH_MAX_RESULTS];
+  TEST_ASSERT_EQUAL_INT(0, TimezoneSearch::search("", ids, TIMEZONE_SEARCH_MAX_RESULTS));
+}
+
+void test_prefix_then_word_start_then_elsewhere()
+{
+  uint16_t ids[TIMEZONE_SEARCH_MAX_RESULTS];
+  uint8_t count = TimezoneSearch::search("europe/a", ids, TIMEZONE_SEARCH_MAX_RESULTS);
+  TEST_ASSERT_TRUE(count > 0);
+  TEST_ASSERT_EQUAL_STRING("Europe/Amsterdam", timezoneName(ids[0]));
+
+  count = TimezoneSearch::search("york", ids, TIMEZONE_SEARCH_MAX_RESULTS);
+  TEST_ASSERT_TRUE(count > 0);
+  TEST_ASSERT_EQUAL_STRING("America/New York", timezoneName(ids[0]));
+
+  // "Sablon" starts a word, "Blanc" too: the zone once, with the word starts
+  count = TimezoneSearch::search("bl", ids, TIMEZONE_SEARCH_MAX_RESULTS);
+  uint8_t found = 0;
+  for (uint8_t i = 0; i < count; i++)
+    found += strcmp(timezoneName(ids[i]), "America/Blanc-Sablon") == 0;
+  TEST_ASSERT_EQUAL_INT(1, found);
+
+  checkSearch("europe/");
+  checkSearch("york");
+  checkSearch("an");
+}
+
+void test_every_two_letter_query()
+{
+  char query[3] = {};
+  for (char first = 'a'; first <= 'z'; first++)
+  {
+    for (char second = 'a'; second <= 'z'; second++)
+    {
+      query[0] = first;
+      query[1] = second;
+      checkSearch(query);
+    }
+  }
+}
+
+void test_results_are_cut_at_max()
+{
+  uint16_t ids[3];
+  TEST_ASSERT_EQUAL_INT(3, TimezoneSearch::search("america/", ids, 3));
+  TEST_ASSERT_EQUAL_STRING("America/Adak", timezoneName(ids[0]));
+}
+
+void test_to_json()
+{
+  uint16_t ids[2] = {0, 1};
+  char expected[128];
+  snprintf(expected, sizeof(expected), "[{\"id\":0,\"name\":\"%s\"},{\"id\":1,\"name\":\"%s\"}]",
+           timezoneName(0), timezoneName(1));
+  char json[128];
+  TEST_ASSERT_EQUAL_INT(strlen(expected), TimezoneSearch::toJson(ids, 2, json, sizeof(json)));
+  TEST_ASSERT_EQUAL_STRING(expected, json);
+
+  // cut, but still the length it needs
+  TEST_ASSERT_EQUAL_INT(strlen(expected), TimezoneSearch::toJson(ids, 2, json, 10));
+  TEST_ASSERT_EQUAL_INT(9, strlen(json));
+  TEST_ASSERT_EQUAL_INT(2, TimezoneSearch::toJson(ids, 0, json, sizeof(json)));
+  TEST_ASSERT_EQUAL_STRING("[]", json);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_find_every_name);
+  RUN_TEST(test_find_folds_case_and_underscores);
+  RUN_TEST(test_empty_query_matches_nothing);
+  RUN_TEST(test_prefix_then_word_start_then_elsewhere);
+  RUN_TEST(test_every_two_letter_query);
+  RUN_TEST(test_results_are_cut_at_max);
+  RUN_TEST(test_to_json);
+  return UNITY_END();
+}
@@ -0,0 +1,69 @@
+//
+// The string pool of Timezones.h against the header it replaced (see
+// TimezonesBefore.h): every zone ID keeps its name and rule, so a stored
+// configuration keeps its zone, and the names in ID order are the old
+// data-options list byte for byte.
+//
+
+#include <string>
+
+#include <unity.h>
+
+#include "Timezones.h"
+#include "TimezonesBefore.h"
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_the_zone_count()
+{
+  TEST_ASSERT_EQUAL_UINT32(sizeof(before::location) / sizeof(before::location[0]), TIMEZONE_COUNT);
+  TEST_ASSERT_EQUAL_UINT32(sizeof(before::posix) / sizeof(before::posix[0]), TIMEZONE_COUNT);
+}
+
+void test_every_id_keeps_its_name_and_rule()
+{
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+  {
+    TEST_ASSERT_EQUAL_STRING(before::location[id], timezoneName(id));
+    TEST_ASSERT_EQUAL_STRING(before::posix[id], timezoneRule(id));
+  }
+}
+
+void test_the_options_are_byte_identical()
+{
+  std::string options = "data-options='";
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+  {
+    if (id > 0)
+      options += '|';
+    options += timezoneName(id);
+  }
+  options += '\'';
+  TEST_ASSERT_EQUAL_UINT32(sizeof(before::locationOptions) - 1, options.size());
+  TEST_ASSERT_EQUAL_STRING(before::locationOptions, options.c_str());
+}
+
+void test_a_string_that_ends_another_shares_its_bytes()
+{
+  int16_t gmt0 = -1;
+  for (uint16_t id = 0; id < TIMEZONE_COUNT; id++)
+  {
+    if (strcmp(timezoneName(id), "Etc/GMT0") == 0)
+      gmt0 = id;
+  }
+  TEST_ASSERT_TRUE(gmt0 >= 0);
+  TEST_ASSERT_EQUAL_STRING("GMT0", timezoneRule(gmt0));
+  TEST_ASSERT_TRUE(timezoneRule(gmt0) == timezoneName(gmt0) + 4);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_the_zone_count);
+  RUN_TEST(test_every_id_keeps_its_name_and_rule);
+  RUN_TEST(test_the_options_are_byte_identical);
+  RUN_TEST(test_a_string_that_ends_another_shares_its_bytes);
+  return UNITY_END();
+}
@@ -0,0 +1,80 @@
+#
+# Tests of tools/web_assets.py, on a copy of web/ and src/WebAssets.*:
+#
+#   python3 -m unittest discover tools
+#
+# The arrays it generates must decompress to the files of web/, the committed
+# src/WebAssets.* must be what it generates, and a second run must write
+# nothing, so a build without changes to web/ compiles nothing again.
+#
+
+import gzip
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.join(TOOLS_DIR, "..")
+GENERATED_FILES = ["WebAssets.h", "WebAssets.cpp"]
+
+
+def run_script(root):
+    result = subprocess.run([sys.executable, os.path.join(root, "tools", "web_assets.py")],
+                            capture_output=True, text=True, check=True)
+    return result.stdout
+
+
+def read_arrays(source):
+    """Returns the bytes of every array of a WebAssets.cpp, by file name."""
+    arrays = {}
+    pattern = r"// (\S+): \d+ bytes, \d+ compressed\.\nconst uint8_t \w+\[\] PROGMEM = \{\n(.*?)\n\};"
+    for file_name, body in re.findall(pattern, source, re.S):
+        arrays[file_name] = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-f]{2})", body))
+    return arrays
+
+
+class WebAssetsTest(unittest.TestCase):
+
+    def setUp(self):
+        self.root = tempfile.mkdtemp()
+        os.mkdir(os.path.join(self.root, "tools"))
+        os.mkdir(os.path.join(self.root, "src"))
+        shutil.copy(os.path.join(TOOLS_DIR, "web_assets.py"), os.path.join(self.root, "tools"))
+        shutil.copytree(os.path.join(ROOT, "web"), os.path.join(self.root, "web"))
+
+    def tearDown(self):
+        shutil.rmtree(self.root)
+
+    def read(self, name):
+        with open(os.path.join(self.root, "src", name), encoding="utf-8") as f:
+            return f.read()
+
+    def test_the_arrays_decompress_to_the_files(self):
+        run_script(self.root)
+        arrays = read_arrays(self.read("WebAssets.cpp"))
+        self.assertEqual(sorted(arrays), sorted(os.listdir(os.path.join(ROOT, "web"))))
+        for file_name, data in arrays.items():
+            with open(os.path.join(ROOT, "web", file_name), "rb") as f:
+                self.assertEqual(gzip.decompress(data), f.read(), file_name)
+
+    def test_the_committed_files_are_up_to_date(self):
+        run_script(self.root)
+        for name in GENERATED_FILES:
+            with open(os.path.join(ROOT, "src", name), encoding="utf-8") as f:
+                self.assertEqual(self.read(name), f.read(), name)
+
+    def test_a_second_run_writes_nothing(self):
+        self.assertIn("wrote src/WebAssets.cpp", run_script(self.root))
+        written = [os.stat(os.path.join(self.root, "src", name)).st_mtime_ns
+                   for name in GENERATED_FILES]
+        self.assertEqual(run_script(self.root), "")
+        self.assertEqual([os.stat(os.path.join(self.root, "src", name)).st_mtime_ns
+                          for name in GENERATED_FILES], written)
+
+
+if __name__ == "__main__":
+    unittest.main()
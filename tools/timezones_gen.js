@@ -0,0 +1,123 @@
+#!/usr/bin/env node
+//
+// Generates src/Timezones.h and src/Timezones.cpp, the time zone database of
+// the clock, from zones.json of https://github.com/nayarsystems/posix_tz_db:
+//
+//   curl -LO https://raw.githubusercontent.com/nayarsystems/posix_tz_db/master/zones.json
+//   node tools/timezones_gen.js zones.json
+//
+// The ID of a zone is its position in zones.json, and the clock stores it in
+// its configuration: only add zones at the end.
+//
+// The names and rules go into one pool of strings, each string once. A
+// string that is the end of a longer one points into it. The index gives the
+// offsets of the name and the rule of every zone, 16 bits each, so the pool
+// must stay under 64 KB. For the search by name (see TimezoneSearch), the
+// IDs are also listed in the order of the names, without case.
+//
+
+const fs = require('fs');
+const path = require('path');
+
+const input = process.argv[2] || 'zones.json';
+const outputDir = path.join(__dirname, '..', 'src');
+
+const zones = Object.entries(JSON.parse(fs.readFileSync(input, 'utf8'))).map(
+  ([name, rule]) => ({ name: name.replace(/_/g, ' '), rule }));
+
+for (const zone of zones) {
+  // names end up in data-options='a|b|...' on the web page
+  if (/['|"\\]/.test(zone.name) || /["\\]/.test(zone.rule))
+    throw new Error(`unexpected character in ${zone.name} ${zone.rule}`);
+}
+
+// Every string once, in the order of the zones. A string that is the end of
+// a longer one is not stored: checking the longest strings first finds them.
+const strings = [...new Set(zones.flatMap((zone) => [zone.name, zone.rule]))];
+const longestFirst = [...strings].sort((a, b) => b.length - a.length);
+const owners = new Map();
+const stored = [];
+for (const string of longestFirst) {
+  const owner = stored.find((longer) => longer.endsWith(string));
+  if (owner !== undefined)
+    owners.set(string, owner);
+  else
+    stored.push(string);
+}
+
+const pool = strings.filter((string) => !owners.has(string));
+const offsets = new Map();
+let size = 0;
+for (const string of pool) {
+  offsets.set(string, size);
+  size += string.length + 1;
+}
+for (const [string, owner] of owners)
+  offsets.set(string, offsets.get(owner) + owner.length - string.length);
+const byName = zones.map((zone, id) => id);
+const key = (id) => zones[id].name.toLowerCase();
+byName.sort((a, b) => (key(a) < key(b) ? -1 : key(a) > key(b) ? 1 : 0));
+
+if (size > 0xFFFF)
+  throw new Error(`pool of ${size} bytes does not fit 16 bit offsets`);
+
+function chunks(values, size) {
+  const result = [];
+  for (let i = 0; i < values.length; i += size)
+    result.push(values.slice(i, i + size));
+  return result;
+}
+
+const generated =
+  '// This file was generated by the script in tools/timezones_gen.js,\n' +
+  '// based on data found in https://github.com/nayarsystems/posix_tz_db\n';
+
+const header = `#pragma once
+
+#include <stdint.h>
+
+${generated}
+// Number of zones. Zone IDs go from 0 to TIMEZONE_COUNT - 1.
+#define TIMEZONE_COUNT ${zones.length}
+
+// Offsets in timezonePool of the name of a zone (e.g. "Europe/Paris") and of
+// its POSIX TZ rule (e.g. "CET-1CEST,M3.5.0,M10.5.0/3").
+struct TimezoneEntry
+{
+  uint16_t name;
+  uint16_t rule;
+};
+
+// The names and rules, NUL terminated.
+extern const char timezonePool[];
+// The offsets of every zone, by zone ID.
+extern const TimezoneEntry timezoneIndex[TIMEZONE_COUNT];
+// Zone IDs in the order of their names, compared without case.
+extern const uint16_t timezoneByName[TIMEZONE_COUNT];
+
+inline const char *timezoneName(uint16_t id) { return timezonePool + timezoneIndex[id].name; }
+inline const char *timezoneRule(uint16_t id) { return timezonePool + timezoneIndex[id].rule; }
+`;
+
+// One literal per string, so a "\0" never runs into a digit after it.
+const source = `#include <Arduino.h>
+
+#include "Timezones.h"
+
+${generated}
+// ${size} bytes, ${pool.length} strings.
+const char timezonePool[] PROGMEM =
+${pool.map((string) => `    "${string}\\0"`).join('\n')};
+
+const TimezoneEntry timezoneIndex[TIMEZONE_COUNT] PROGMEM = {
+${zones.map((zone) => `    {${offsets.get(zone.name)}, ${offsets.get(zone.rule)}}, // ${zone.name}`).join('\n')}
+};
+
+const uint16_t timezoneByName[TIMEZONE_COUNT] PROGMEM = {
+${chunks(byName, 16).map((ids) => `    ${ids.join(', ')},`).join('\n')}
+};
+`;
+
+fs.writeFileSync(path.join(outputDir, 'Timezones.h'), header);
+fs.writeFileSync(path.join(outputDir, 'Timezones.cpp'), source);
+console.log(`${zones.length} zones, ${pool.length} strings, ${size} bytes`);
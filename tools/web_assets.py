@@ -0,0 +1,127 @@
+#
+# Compresses the files of web/ into src/WebAssets.h and src/WebAssets.cpp, to
+# be served from flash as they are, with Content-Encoding: gzip (see
+# IotConfig::handleHttpToAsset_()).
+#
+# Runs before every PlatformIO build (extra_scripts in platformio.ini), and on
+# its own with
+#
+#   python3 tools/web_assets.py
+#
+# Every asset gets a strong ETag from its content, and a URL with the ETag in
+# it: the URL changes with the content, so browsers may cache it for good.
+# The files are only written when they change, so a build without changes to
+# web/ compiles nothing again.
+#
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821, defined by SCons
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+WEB_DIR = os.path.join(ROOT, "web")
+SRC_DIR = os.path.join(ROOT, "src")
+URL_PREFIX = "/assets/"
+
+TYPES = {
+    ".css": "text/css; charset=utf-8",
+    ".js": "application/javascript; charset=utf-8",
+    ".svg": "image/svg+xml; charset=utf-8",
+}
+
+GENERATED = "// This file was generated by tools/web_assets.py from the files in web/.\n"
+
+
+def macro_name(file_name):
+    return re.sub(r"[^A-Za-z0-9]", "_", file_name).upper()
+
+
+def array_name(file_name):
+    words = re.split(r"[^A-Za-z0-9]", file_name)
+    return "webAsset" + "".join(word[:1].upper() + word[1:] for word in words)
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("web_assets: wrote %s" % os.path.relpath(path, ROOT))
+
+
+def main():
+    assets = []
+    for file_name in sorted(os.listdir(WEB_DIR)):
+        extension = os.path.splitext(file_name)[1]
+        if extension not in TYPES:
+            continue
+        with open(os.path.join(WEB_DIR, file_name), "rb") as f:
+            content = f.read()
+        # no time stamp in the header, the same content gives the same bytes
+        data = gzip.compress(content, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(content).hexdigest()[:16]
+        assets.append({
+            "file": file_name,
+            "macro": macro_name(file_name),
+            "array": array_name(file_name),
+            "type": TYPES[extension],
+            "etag": etag,
+            "data": data,
+            "size": len(content),
+        })
+
+    header = ["#pragma once\n\n#include <stddef.h>\n#include <stdint.h>\n\n", GENERATED, """
+// A file of web/, compressed with gzip.
+struct WebAsset
+{
+  // Path it is served at, without the version.
+  const char *path;
+  // MIME type of the file, before compression.
+  const char *type;
+  // Strong ETag, quoted.
+  const char *etag;
+  const uint8_t *data;
+  size_t length;
+};
+
+#define WEB_ASSET_COUNT %d
+extern const WebAsset webAssets[WEB_ASSET_COUNT];
+
+// URLs to reference the assets with, the version in the query.
+""" % len(assets)]
+    for asset in assets:
+        header.append('#define WEB_ASSET_%s "%s%s?v=%s"\n'
+                      % (asset["macro"], URL_PREFIX, asset["file"], asset["etag"]))
+
+    source = ['#include <Arduino.h>\n\n#include "WebAssets.h"\n\n', GENERATED]
+    for asset in assets:
+        source.append("\n// %s: %d bytes, %d compressed.\nconst uint8_t %s[] PROGMEM = {\n%s\n};\n"
+                      % (asset["file"], asset["size"], len(asset["data"]),
+                         asset["array"], c_bytes(asset["data"])))
+    source.append("\nconst WebAsset webAssets[WEB_ASSET_COUNT] = {\n")
+    for asset in assets:
+        source.append('    {"%s%s", "%s", "\\"%s\\"", %s, sizeof(%s)},\n'
+                      % (URL_PREFIX, asset["file"], asset["type"], asset["etag"],
+                         asset["array"], asset["array"]))
+    source.append("};\n")
+
+    write_if_changed(os.path.join(SRC_DIR, "WebAssets.h"), "".join(header))
+    write_if_changed(os.path.join(SRC_DIR, "WebAssets.cpp"), "".join(source))
+
+
+main()
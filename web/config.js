@@ -0,0 +1,132 @@
+// Script of the configuration page, served as /assets/config.js (see
+// tools/web_assets.py).
+document.addEventListener("DOMContentLoaded", function () {
+  var label = document.querySelector("label[for=iwcThingName]");
+  if (label) label.innerText = "Clock name";
+  label = document.querySelector("label[for=iwcApPassword]");
+  if (label) label.innerText = "AP password (login: admin)";
+
+  // A button to show and hide every password.
+  document.querySelectorAll("input[type=password]").forEach(function (input) {
+    var toggle = document.createElement("input");
+    toggle.classList.add("pwtoggle");
+    toggle.type = "button";
+    toggle.value = "👁️";
+    input.insertAdjacentElement("afterend", toggle);
+    toggle.onclick = function () {
+      if (input.type === "password") {
+        input.type = "text";
+        toggle.value = "🔒";
+      } else {
+        input.type = "password";
+        toggle.value = "👁️";
+      }
+    };
+  });
+
+  var form = document.querySelector("form");
+  if (form) {
+    form.addEventListener("submit", function () {
+      var button = document.querySelector("button[type=submit]");
+      button.innerText = "Saving...";
+      button.toggleAttribute("disabled", true);
+    });
+  }
+
+  // data-options='a|b|Group/c|...' turns the input into a select of the
+  // option numbers. Options with a "/" are grouped by what comes before it.
+  document.querySelectorAll("input[data-options]").forEach(function (input) {
+    var value = input.value;
+    var options = input.getAttribute("data-options").split("|");
+    var select = document.createElement("select");
+    select.name = input.name;
+    select.id = input.id;
+    if (value === "") select.appendChild(document.createElement("option"));
+
+    var group = null;
+    options.forEach(function (text, index) {
+      var parts = text.split("/");
+      var label = text;
+      if (parts.length > 1) {
+        var name = parts.splice(0, 1)[0];
+        if (!group || name != group.label) {
+          if (group) select.appendChild(group);
+          group = document.createElement("optgroup");
+          group.label = name;
+        }
+        label = parts.join(" / ");
+      } else if (group) {
+        select.appendChild(group);
+        group = null;
+      }
+      var option = document.createElement("option");
+      option.value = index;
+      option.innerText = label;
+      if (index == value) option.toggleAttribute("selected");
+      (group || select).appendChild(option);
+    });
+    if (group) select.appendChild(group);
+
+    input.id += "-d";
+    input.insertAdjacentElement("beforebegin", select);
+    input.parentElement.removeChild(input);
+  });
+
+  // Shows the value of a slider, or its label from data-labels='a|b|...'.
+  document.querySelectorAll("input[type=range]").forEach(function (input) {
+    var labels = input.getAttribute("data-labels");
+    labels = labels && labels.split("|");
+    var update = function () {
+      input.setAttribute("data-label",
+        labels ? labels[parseInt(input.value, 10)] || input.value : input.value);
+    };
+    input.oninput = update;
+    update();
+  });
+
+  var ntp = document.getElementById("ntp_enabled");
+  if (ntp) {
+    var showNtp = function (enabled) {
+      document.querySelectorAll("#date, #time").forEach(function (input) {
+        input.parentElement.style.display = enabled ? "none" : "";
+      });
+      document.getElementById("timezone").parentElement.style.display = enabled ? "" : "none";
+    };
+    ntp.addEventListener("change", function () { showNtp(ntp.value == 1); });
+    showNtp(ntp.value == 1);
+  }
+
+  // The logo takes the color of the clock.
+  var color = document.querySelector("input[type=color]");
+  if (color) {
+    var showColor = function () {
+      document.querySelector(".logoContainer").style.backgroundColor = color.value;
+    };
+    color.addEventListener("input", showColor);
+    showColor();
+  }
+
+  // Typeahead of the time zone, from /api/tz.
+  document.querySelectorAll("input[data-tz]").forEach(function (input) {
+    var list = document.createElement("datalist");
+    var timer = 0;
+    list.id = input.id + "-list";
+    input.setAttribute("list", list.id);
+    input.insertAdjacentElement("afterend", list);
+    input.addEventListener("input", function () {
+      clearTimeout(timer);
+      timer = setTimeout(function () {
+        fetch("/api/tz?q=" + encodeURIComponent(input.value))
+          .then(function (response) { return response.json(); })
+          .then(function (zones) {
+            list.innerHTML = "";
+            zones.forEach(function (zone) {
+              var option = document.createElement("option");
+              option.value = zone.name;
+              list.appendChild(option);
+            });
+          });
+      }, 150);
+    });
+  });
+});